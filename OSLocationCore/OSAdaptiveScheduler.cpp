@@ -0,0 +1,157 @@
+//
+//  OSAdaptiveScheduler.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSAdaptiveScheduler.h"
+#include "OSLocalFrame.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oslocation {
+
+static double distanceBetween(double latitude, double longitude, const Fix &fix) {
+    double east, north;
+    LocalFrame(latitude, longitude).toLocal(fix.latitude, fix.longitude, east, north);
+    return std::hypot(east, north);
+}
+
+AdaptiveScheduler::AdaptiveScheduler(const AdaptiveSchedulerOptions &options, MotionState initialState)
+    : m_options(options), m_initialState(initialState), m_state(initialState) {}
+
+const LocationSettings &AdaptiveScheduler::settingsFor(MotionState state) const {
+    switch (state) {
+        case MotionState::Stationary:
+            return m_options.stationary;
+        case MotionState::Walking:
+            return m_options.walking;
+        case MotionState::Driving:
+            return m_options.driving;
+    }
+    return m_options.walking;
+}
+
+void AdaptiveScheduler::process(FixBuffer &fixes) {
+    for (const Fix &fix : fixes) {
+        observe(fix);
+    }
+}
+
+void AdaptiveScheduler::reset() {
+    m_state = m_initialState;
+    m_hasAnchor = false;
+    m_hasBaseline = false;
+    m_speed = -1;
+    m_pendingSince = -1;
+}
+
+void AdaptiveScheduler::transition(double timestamp, MotionState state) {
+    m_log.push_back(Reconfiguration{timestamp, m_state, state, settingsFor(state), m_speed});
+    m_state = state;
+    m_pendingSince = -1;
+}
+
+void AdaptiveScheduler::updateSpeed(const Fix &fix) {
+    if (hasValidSpeed(fix)) {
+        m_speed = fix.speed;
+        return;
+    }
+    if (!m_hasBaseline || fix.timestamp < m_baselineTimestamp) {
+        m_hasBaseline = true;
+        m_baselineTimestamp = fix.timestamp;
+        m_baselineLatitude = fix.latitude;
+        m_baselineLongitude = fix.longitude;
+        return;
+    }
+    const double dt = fix.timestamp - m_baselineTimestamp;
+    if (dt >= m_options.speedBaseline) {
+        m_speed = distanceBetween(m_baselineLatitude, m_baselineLongitude, fix) / dt;
+        m_baselineTimestamp = fix.timestamp;
+        m_baselineLatitude = fix.latitude;
+        m_baselineLongitude = fix.longitude;
+    }
+}
+
+void AdaptiveScheduler::observe(const Fix &fix) {
+    if (!hasValidCoordinate(fix)) {
+        return;
+    }
+    updateSpeed(fix);
+    const double fromAnchor = m_hasAnchor ? distanceBetween(m_anchorLatitude, m_anchorLongitude, fix) : 0;
+
+    if (m_state == MotionState::Stationary) {
+        const bool moved = fromAnchor > std::max(m_options.movingRadius, fix.horizontalAccuracy) || (hasValidSpeed(fix) && fix.speed > m_options.movingSpeed);
+        if (moved) {
+            transition(fix.timestamp, m_speed > m_options.drivingSpeed ? MotionState::Driving : MotionState::Walking);
+            m_hasAnchor = false;
+        } else {
+            return;
+        }
+    }
+
+    if (!m_hasAnchor || fromAnchor > m_options.stationaryRadius) {
+        m_hasAnchor = true;
+        m_anchorTimestamp = fix.timestamp;
+        m_anchorLatitude = fix.latitude;
+        m_anchorLongitude = fix.longitude;
+    } else if (fix.timestamp - m_anchorTimestamp >= m_options.stationaryTime) {
+        transition(fix.timestamp, MotionState::Stationary);
+        return;
+    }
+
+    const bool driving = m_state == MotionState::Driving;
+    const bool crossing = driving ? (m_speed >= 0 && m_speed < m_options.walkingSpeed) : m_speed > m_options.drivingSpeed;
+    if (!crossing) {
+        m_pendingSince = -1;
+    } else if (m_pendingSince < 0) {
+        m_pendingSince = fix.timestamp;
+    } else if (fix.timestamp - m_pendingSince >= (driving ? m_options.walkingTime : m_options.drivingTime)) {
+        transition(fix.timestamp, driving ? MotionState::Walking : MotionState::Driving);
+    }
+}
+
+void AdaptiveScheduler::tick(double now) {
+    if (m_state != MotionState::Stationary && m_hasAnchor && now - m_anchorTimestamp >= m_options.stationaryTime) {
+        transition(now, MotionState::Stationary);
+    }
+}
+
+ScheduleReport simulateSchedule(const FixBuffer &track, const LocationSettings &settings, AdaptiveScheduler *scheduler) {
+    ScheduleReport report;
+    LocationSettings current = scheduler ? scheduler->settings() : settings;
+    const std::size_t firstReconfiguration = scheduler ? scheduler->log().size() : 0;
+    const Fix *last = nullptr;
+    FixBuffer batch(1);
+    for (std::size_t i = 0; i < track.size(); i++) {
+        const Fix &fix = track[i];
+        if (i > 0) {
+            const double dt = fix.timestamp - track[i - 1].timestamp;
+            report.duration += dt;
+            report.distance += distanceBetween(track[i - 1].latitude, track[i - 1].longitude, fix);
+            if (isHighAccuracy(current.accuracy)) {
+                report.highAccuracyTime += dt;
+            }
+        }
+        if (scheduler) {
+            scheduler->tick(fix.timestamp);
+            current = scheduler->settings();
+        }
+        if (last && distanceBetween(last->latitude, last->longitude, fix) < current.distanceFilter) {
+            continue;
+        }
+        report.fixesDelivered++;
+        last = &fix;
+        if (scheduler) {
+            batch[0] = fix;
+            scheduler->process(batch);
+            current = scheduler->settings();
+        }
+    }
+    report.reconfigurations = scheduler ? scheduler->log().size() - firstReconfiguration : 0;
+    return report;
+}
+
+} // namespace oslocation
@@ -0,0 +1,179 @@
+//
+//  OSAdaptiveScheduler.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSLocationSettings.h"
+#include "OSPipeline.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace oslocation {
+
+enum class MotionState {
+    Stationary,
+    Walking,
+    Driving,
+};
+
+struct AdaptiveSchedulerOptions {
+    /**
+     *  A stay starts once every fix for `stationaryTime` seconds has been
+     *  within this many metres of the first...
+     */
+    double stationaryRadius = 20;
+    double stationaryTime = 60;
+    /**
+     *  ...and ends with the first fix further than this from it, or further
+     *  than its own accuracy if that is worse. The margin over
+     *  `stationaryRadius` keeps noise at the edge from ending the stay.
+     */
+    double movingRadius = 30;
+    /**
+     *  Reported speed in metres per second that ends a stay on its own
+     */
+    double movingSpeed = 1;
+    /**
+     *  Speed in metres per second that must be held for `drivingTime`
+     *  seconds to start driving...
+     */
+    double drivingSpeed = 7;
+    double drivingTime = 10;
+    /**
+     *  ...and that must be undercut for `walkingTime` seconds to stop
+     */
+    double walkingSpeed = 4;
+    double walkingTime = 30;
+    /**
+     *  Fixes without a reported speed estimate it over at least this many
+     *  seconds, so position noise does not look like movement
+     */
+    double speedBaseline = 10;
+
+    LocationSettings stationary = {LocationAccuracy::HundredMetres, 50, false};
+    LocationSettings walking = {LocationAccuracy::Best, 5, true};
+    LocationSettings driving = {LocationAccuracy::BestForNavigation, 15, false};
+};
+
+/**
+ *  One change of state and the settings it asked for
+ */
+struct Reconfiguration {
+    double timestamp;
+    MotionState from;
+    MotionState to;
+    LocationSettings settings;
+    /**
+     *  Speed estimate in metres per second when the change was made
+     */
+    double speed;
+};
+
+/**
+ *  Watches the fixes passing through the pipeline and decides how much
+ *  accuracy the user's motion needs. A hysteresis state machine moves
+ *  between stationary, walking and driving: each change has to be held for
+ *  a while before it is made, and the thresholds for leaving a state are
+ *  further out than those for entering it, so a pause at a junction or a
+ *  noisy fix does not thrash the location manager. Leaving a stay is the
+ *  exception and happens on the first fix that shows movement, since the
+ *  coarse settings used while stationary would otherwise lose the start of
+ *  the next leg.
+ *
+ *  Fixes are left untouched. Every change is appended to `log()`; the
+ *  caller applies `settings()` when the log grows, after processing a batch
+ *  or calling `tick`.
+ */
+class AdaptiveScheduler : public Stage {
+public:
+    explicit AdaptiveScheduler(const AdaptiveSchedulerOptions &options = AdaptiveSchedulerOptions(), MotionState initialState = MotionState::Walking);
+
+    void process(FixBuffer &fixes) override;
+
+    /**
+     *  Returns to the initial state without logging, ready for updates to
+     *  start again
+     */
+    void reset() override;
+
+    void observe(const Fix &fix);
+
+    /**
+     *  Lets the scheduler see time pass without fixes. A distance filter
+     *  stops updates altogether once the user stops moving, so a stay is
+     *  only noticed by calling this periodically.
+     */
+    void tick(double now);
+
+    MotionState state() const { return m_state; }
+    const LocationSettings &settings() const { return settingsFor(m_state); }
+    const LocationSettings &settingsFor(MotionState state) const;
+
+    /**
+     *  Current speed estimate in metres per second, negative until known
+     */
+    double speed() const { return m_speed; }
+
+    const std::vector<Reconfiguration> &log() const { return m_log; }
+    void clearLog() { m_log.clear(); }
+
+private:
+    void transition(double timestamp, MotionState state);
+    void updateSpeed(const Fix &fix);
+
+    AdaptiveSchedulerOptions m_options;
+    MotionState m_initialState;
+    MotionState m_state;
+    std::vector<Reconfiguration> m_log;
+
+    bool m_hasAnchor = false;
+    double m_anchorTimestamp = 0, m_anchorLatitude = 0, m_anchorLongitude = 0;
+
+    bool m_hasBaseline = false;
+    double m_baselineTimestamp = 0, m_baselineLatitude = 0, m_baselineLongitude = 0;
+    double m_speed = -1;
+
+    /**
+     *  When the speed first crossed the threshold for the pending change,
+     *  negative when no change is pending
+     */
+    double m_pendingSince = -1;
+};
+
+/**
+ *  Outcome of replaying a track against a set of location settings
+ */
+struct ScheduleReport {
+    std::size_t fixesDelivered = 0;
+    std::size_t reconfigurations = 0;
+    /**
+     *  Length of the replayed track in metres
+     */
+    double distance = 0;
+    double duration = 0;
+    /**
+     *  Seconds spent asking for `Best` or `BestForNavigation`, which keep
+     *  the GPS receiver powered
+     */
+    double highAccuracyTime = 0;
+
+    double fixesPerKilometre() const { return distance > 0 ? fixesDelivered / (distance / 1000) : 0; }
+    double highAccuracyFraction() const { return duration > 0 ? highAccuracyTime / duration : 0; }
+};
+
+/**
+ *  Replays a densely sampled track as the location manager would deliver it
+ *  under `settings`: a fix is delivered once it is `distanceFilter` metres
+ *  from the last one. With a scheduler, it is ticked at every sample and
+ *  every delivered fix is passed to it; its settings take over from the
+ *  next sample on, starting from the settings of its current state. Position noise is not modelled, so this
+ *  compares update rates rather than track quality.
+ */
+ScheduleReport simulateSchedule(const FixBuffer &track, const LocationSettings &settings, AdaptiveScheduler *scheduler = nullptr);
+
+} // namespace oslocation
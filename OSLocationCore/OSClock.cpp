@@ -0,0 +1,30 @@
+//
+//  OSClock.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSClock.h"
+
+#include <chrono>
+#include <thread>
+
+namespace oslocation {
+
+double SystemClock::now() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SystemClock::sleepUntil(double time) {
+    auto deadline = std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(time)));
+    std::this_thread::sleep_until(deadline);
+}
+
+void VirtualClock::sleepUntil(double time) {
+    if (time > m_now) {
+        m_now = time;
+    }
+}
+
+} // namespace oslocation
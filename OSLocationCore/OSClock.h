@@ -0,0 +1,57 @@
+//
+//  OSClock.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+namespace oslocation {
+
+/**
+ *  Source of time for anything that schedules work against fix timestamps.
+ *  Times are in seconds; the epoch is up to the implementation.
+ */
+class Clock {
+public:
+    virtual ~Clock() = default;
+
+    virtual double now() const = 0;
+
+    /**
+     *  Blocks until `now()` has reached the given time. Returns immediately if
+     *  it already has.
+     */
+    virtual void sleepUntil(double time) = 0;
+};
+
+/**
+ *  Wall clock backed by `std::chrono::steady_clock`
+ */
+class SystemClock : public Clock {
+public:
+    double now() const override;
+    void sleepUntil(double time) override;
+};
+
+/**
+ *  Clock that only moves when told to. Sleeping jumps straight to the
+ *  requested time, so replays run as fast as the processing allows while
+ *  still seeing a realistic timeline.
+ */
+class VirtualClock : public Clock {
+public:
+    explicit VirtualClock(double start = 0) : m_now(start) {}
+
+    double now() const override { return m_now; }
+    void sleepUntil(double time) override;
+
+    void advance(double seconds) { m_now += seconds; }
+    void set(double time) { m_now = time; }
+
+private:
+    double m_now;
+};
+
+} // namespace oslocation
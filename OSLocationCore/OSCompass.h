@@ -0,0 +1,79 @@
+//
+//  OSCompass.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace oslocation {
+
+/**
+ *  Platform neutral compass reading mirroring the fields of `CLHeading`.
+ *
+ *  As in CoreLocation, a negative `trueHeading`, `gridHeading` or
+ *  `headingAccuracy` means the value is unknown.
+ */
+struct Heading {
+    /**
+     *  Seconds since 1 January 1970 UTC
+     */
+    double timestamp;
+    /**
+     *  Degrees clockwise from magnetic north
+     */
+    double magneticHeading;
+    /**
+     *  Degrees clockwise from true north
+     */
+    double trueHeading;
+    /**
+     *  Degrees clockwise from grid north, such as National Grid north
+     */
+    double gridHeading;
+    /**
+     *  Largest error in degrees of `magneticHeading`
+     */
+    double headingAccuracy;
+    /**
+     *  Raw geomagnetic field in microteslas
+     */
+    double x;
+    double y;
+    double z;
+};
+
+static_assert(std::is_trivial<Heading>::value && std::is_standard_layout<Heading>::value, "Heading must stay a POD record");
+
+inline bool hasValidHeading(const Heading &heading) {
+    return heading.headingAccuracy >= 0;
+}
+
+inline bool hasValidTrueHeading(const Heading &heading) {
+    return heading.trueHeading >= 0;
+}
+
+inline bool hasValidGridHeading(const Heading &heading) {
+    return heading.gridHeading >= 0;
+}
+
+/**
+ *  The true heading if known, otherwise the magnetic heading
+ */
+inline double headingDirection(const Heading &heading) {
+    return hasValidTrueHeading(heading) ? heading.trueHeading : heading.magneticHeading;
+}
+
+/**
+ *  Smallest angle in degrees between two directions, from 0 to 180
+ */
+inline double angularDifference(double a, double b) {
+    const double difference = std::fmod(std::fabs(a - b), 360.0);
+    return difference > 180 ? 360 - difference : difference;
+}
+
+} // namespace oslocation
@@ -0,0 +1,158 @@
+//
+//  OSDeliveryQueue.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSDeliveryQueue.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace oslocation {
+
+namespace {
+
+const unsigned kOverflowIndexMask = 3;
+const unsigned kOverflowDirty = 4;
+
+} // namespace
+
+struct alignas(64) DeliveryQueue::Slot {
+    /**
+     *  Equal to the position that may next be written here, or one more
+     *  than the position whose record is waiting to be read
+     */
+    std::atomic<std::size_t> sequence;
+    DeliveryRecord record;
+};
+
+DeliveryQueue::DeliveryQueue(std::size_t capacity, Backpressure policy) : m_policy(policy) {
+    std::size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    m_mask = rounded - 1;
+    m_slots.reset(new Slot[rounded]);
+    for (std::size_t i = 0; i < rounded; i++) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+DeliveryQueue::~DeliveryQueue() = default;
+
+bool DeliveryQueue::tryPush(const DeliveryRecord &record) {
+    const std::size_t position = m_head.load(std::memory_order_relaxed);
+    Slot &slot = m_slots[position & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position) {
+        // Full, or the consumer is still copying out of this slot
+        return false;
+    }
+    slot.record = record;
+    slot.sequence.store(position + 1, std::memory_order_release);
+    m_head.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool DeliveryQueue::tryPop(DeliveryRecord *record) {
+    std::size_t position = m_tail.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot &slot = m_slots[position & m_mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == position + 1) {
+            // Claim the slot first; the other side may be after the same one
+            if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                if (record) {
+                    *record = slot.record;
+                }
+                slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (sequence == position) {
+            return false;
+        } else {
+            position = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void DeliveryQueue::pushOverflow(const DeliveryRecord &record) {
+    m_overflow[m_overflowBack] = record;
+    const unsigned previous = m_overflowState.exchange(m_overflowBack | kOverflowDirty, std::memory_order_acq_rel);
+    m_overflowBack = previous & kOverflowIndexMask;
+    if (previous & kOverflowDirty) {
+        m_coalesced.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void DeliveryQueue::push(const DeliveryRecord &record) {
+    m_pushed.fetch_add(1, std::memory_order_relaxed);
+    switch (m_policy) {
+        case Backpressure::DropOldest:
+            while (!tryPush(record)) {
+                const std::size_t waiting = m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire);
+                if (waiting > m_mask) {
+                    if (tryPop(nullptr)) {
+                        m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } else {
+                    // The consumer has claimed the slot but not finished with it
+                    std::this_thread::yield();
+                }
+            }
+            break;
+        case Backpressure::Coalesce:
+            // Once anything has overflowed, later records must follow it
+            // there or they would overtake it
+            if ((m_overflowState.load(std::memory_order_acquire) & kOverflowDirty) || !tryPush(record)) {
+                pushOverflow(record);
+            }
+            break;
+        case Backpressure::Block:
+            if (!tryPush(record)) {
+                m_blocked.fetch_add(1, std::memory_order_relaxed);
+                if (m_wakeHandler) {
+                    m_wakeHandler();
+                }
+                while (!tryPush(record)) {
+                    std::this_thread::yield();
+                }
+            }
+            break;
+    }
+}
+
+bool DeliveryQueue::pop(DeliveryRecord &record) {
+    // Read the overflow state before the ring: everything pushed to the
+    // ring before the overflow was first written is then visible below
+    const unsigned state = m_overflowState.load(std::memory_order_acquire);
+    if (tryPop(&record)) {
+        return true;
+    }
+    if (!(state & kOverflowDirty)) {
+        return false;
+    }
+    const unsigned previous = m_overflowState.exchange(m_overflowFront, std::memory_order_acq_rel);
+    m_overflowFront = previous & kOverflowIndexMask;
+    record = m_overflow[m_overflowFront];
+    return true;
+}
+
+std::size_t DeliveryQueue::size() const {
+    const std::size_t tail = m_tail.load(std::memory_order_acquire);
+    const std::size_t head = m_head.load(std::memory_order_acquire);
+    const std::size_t overflow = (m_overflowState.load(std::memory_order_acquire) & kOverflowDirty) ? 1 : 0;
+    return std::min(head - tail, m_mask + 1) + overflow;
+}
+
+DeliveryStatistics DeliveryQueue::statistics() const {
+    DeliveryStatistics statistics;
+    statistics.pushed = m_pushed.load(std::memory_order_relaxed);
+    statistics.dropped = m_dropped.load(std::memory_order_relaxed);
+    statistics.coalesced = m_coalesced.load(std::memory_order_relaxed);
+    statistics.blocked = m_blocked.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} // namespace oslocation
@@ -0,0 +1,181 @@
+//
+//  OSDeliveryQueue.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSCompass.h"
+#include "OSFix.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace oslocation {
+
+/**
+ *  What a `DeliveryQueue` does with a record pushed while it is full
+ */
+enum class Backpressure {
+    /**
+     *  The oldest queued record is discarded to make room, so the consumer
+     *  sees the most recent `capacity` records
+     */
+    DropOldest,
+    /**
+     *  Queued records are kept and the overflow collapses into a single
+     *  slot holding the newest record, delivered once the queue has drained
+     */
+    Coalesce,
+    /**
+     *  The producer waits for the consumer to make room, so nothing is lost
+     */
+    Block,
+};
+
+enum class RecordType : std::uint32_t {
+    Fix,
+    Heading,
+};
+
+/**
+ *  One fix or heading passing through a `DeliveryQueue`
+ */
+struct DeliveryRecord {
+    RecordType type;
+    /**
+     *  Time the record was pushed, in the producer's clock, for measuring
+     *  delivery latency
+     */
+    double enqueueTime;
+    union {
+        Fix fix;
+        Heading heading;
+    };
+};
+
+static_assert(std::is_trivially_copyable<DeliveryRecord>::value, "DeliveryRecord must stay a POD record");
+
+inline DeliveryRecord makeRecord(const Fix &fix, double enqueueTime = 0) {
+    DeliveryRecord record;
+    record.type = RecordType::Fix;
+    record.enqueueTime = enqueueTime;
+    record.fix = fix;
+    return record;
+}
+
+inline DeliveryRecord makeRecord(const Heading &heading, double enqueueTime = 0) {
+    DeliveryRecord record;
+    record.type = RecordType::Heading;
+    record.enqueueTime = enqueueTime;
+    record.heading = heading;
+    return record;
+}
+
+struct DeliveryStatistics {
+    std::uint64_t pushed = 0;
+    /**
+     *  Records discarded under `Backpressure::DropOldest`
+     */
+    std::uint64_t dropped = 0;
+    /**
+     *  Records replaced by a newer one under `Backpressure::Coalesce`
+     */
+    std::uint64_t coalesced = 0;
+    /**
+     *  Pushes that had to wait under `Backpressure::Block`
+     */
+    std::uint64_t blocked = 0;
+};
+
+/**
+ *  Bounded lock-free queue carrying fixes and headings from the thread that
+ *  receives them to one processing thread.
+ *
+ *  Exactly one thread may call `push` and exactly one other thread may call
+ *  `pop`. Records are delivered in the order they were pushed, less any
+ *  discarded or coalesced by the backpressure policy. Under
+ *  `Backpressure::DropOldest` the producer takes records from the consumer's
+ *  end itself, so each slot carries a sequence number in the manner of
+ *  Vyukov's bounded queue rather than relying on two indices alone.
+ */
+class DeliveryQueue {
+public:
+    /**
+     *  @param capacity rounded up to a power of two, at least 2
+     */
+    explicit DeliveryQueue(std::size_t capacity, Backpressure policy = Backpressure::DropOldest);
+    ~DeliveryQueue();
+
+    DeliveryQueue(const DeliveryQueue &) = delete;
+    DeliveryQueue &operator=(const DeliveryQueue &) = delete;
+
+    /**
+     *  Producer only. Applies the backpressure policy if the queue is full;
+     *  under `Backpressure::Block` this waits for the consumer.
+     */
+    void push(const DeliveryRecord &record);
+
+    /**
+     *  Called on the producer's thread when a push under
+     *  `Backpressure::Block` finds the queue full, before it waits. A
+     *  producer that starts its consumer on demand must start it here, or
+     *  a push with no consumer running waits forever.
+     */
+    void setWakeHandler(std::function<void()> handler) { m_wakeHandler = std::move(handler); }
+
+    /**
+     *  Consumer only
+     *
+     *  @return false if there is nothing to deliver
+     */
+    bool pop(DeliveryRecord &record);
+
+    std::size_t capacity() const { return m_mask + 1; }
+    Backpressure policy() const { return m_policy; }
+
+    /**
+     *  Number of records waiting, approximate while either thread is busy
+     */
+    std::size_t size() const;
+
+    /**
+     *  Counts so far, safe to read from any thread
+     */
+    DeliveryStatistics statistics() const;
+
+private:
+    struct Slot;
+
+    bool tryPush(const DeliveryRecord &record);
+    bool tryPop(DeliveryRecord *record);
+    void pushOverflow(const DeliveryRecord &record);
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_mask;
+    Backpressure m_policy;
+    std::function<void()> m_wakeHandler;
+
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+
+    // Coalesce overflow: a triple buffer whose middle index and dirty bit
+    // live in `m_overflowState`, so neither side ever waits for the other
+    alignas(64) std::atomic<unsigned> m_overflowState{0};
+    unsigned m_overflowBack = 1;
+    unsigned m_overflowFront = 2;
+    DeliveryRecord m_overflow[3];
+
+    alignas(64) std::atomic<std::uint64_t> m_pushed{0};
+    std::atomic<std::uint64_t> m_dropped{0};
+    std::atomic<std::uint64_t> m_coalesced{0};
+    std::atomic<std::uint64_t> m_blocked{0};
+};
+
+} // namespace oslocation
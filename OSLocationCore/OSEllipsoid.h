@@ -0,0 +1,36 @@
+//
+//  OSEllipsoid.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+namespace oslocation {
+
+struct Ellipsoid {
+    double semiMajorAxis;
+    double semiMinorAxis;
+
+    constexpr double eccentricitySquared() const {
+        return (semiMajorAxis * semiMajorAxis - semiMinorAxis * semiMinorAxis) / (semiMajorAxis * semiMajorAxis);
+    }
+};
+
+/**
+ *  Ellipsoid of the OSGB36 datum
+ */
+constexpr Ellipsoid kAiry1830 = {6377563.396, 6356256.909};
+
+/**
+ *  Ellipsoid of ETRS89, which OSTN15 takes its input in
+ */
+constexpr Ellipsoid kGRS80 = {6378137.000, 6356752.3141};
+
+constexpr Ellipsoid kWGS84 = {6378137.000, 6356752.314245};
+
+constexpr double kDegreesToRadians = 0.017453292519943295769;
+constexpr double kRadiansToDegrees = 57.295779513082320877;
+
+} // namespace oslocation
@@ -0,0 +1,111 @@
+//
+//  OSFix.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  Bit flags describing what the pipeline has done to a fix
+ */
+enum FixFlags : std::uint32_t {
+    /**
+     *  The fix is exactly as it was received from the location source
+     */
+    FixFlagNone = 0,
+    /**
+     *  A stage has changed the position, accuracy or motion of the fix, so
+     *  the original `CLLocation` can no longer be delivered for it
+     */
+    FixFlagModified = 1u << 0,
+    /**
+     *  The fix is a position remembered from an earlier session, standing in
+     *  until the first live fix arrives
+     */
+    FixFlagProvisional = 1u << 1,
+};
+
+/**
+ *  Platform neutral location fix mirroring the fields of `CLLocation`.
+ *
+ *  Invalid values follow the CoreLocation conventions: a negative accuracy,
+ *  speed or course means the value is unknown.
+ */
+struct Fix {
+    /**
+     *  Seconds since 1 January 1970 UTC
+     */
+    double timestamp;
+    double latitude;
+    double longitude;
+    /**
+     *  Height above the WGS84 ellipsoid in metres
+     */
+    double altitude;
+    double horizontalAccuracy;
+    double verticalAccuracy;
+    /**
+     *  Speed over ground in metres per second
+     */
+    double speed;
+    /**
+     *  Course over ground in degrees clockwise from true north
+     */
+    double course;
+    /**
+     *  British National Grid coordinates in metres, NaN until a
+     *  `NationalGridStage` has converted the fix
+     */
+    double easting;
+    double northing;
+    std::uint32_t flags;
+    /**
+     *  Index of the fix in the batch currently being processed, or -1 when
+     *  the fix was synthesised by a stage. Stages that hold fixes back across
+     *  batches must reset it to -1 before emitting them.
+     */
+    std::int32_t sourceIndex;
+};
+
+static_assert(std::is_trivial<Fix>::value && std::is_standard_layout<Fix>::value, "Fix must stay a POD record");
+
+using FixBuffer = std::vector<Fix>;
+
+/**
+ *  Makes a fix with the given position and every other field unknown
+ */
+inline Fix makeFix(double timestamp, double latitude, double longitude, double altitude = 0) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    return Fix{timestamp, latitude, longitude, altitude, -1, -1, -1, -1, nan, nan, FixFlagNone, -1};
+}
+
+/**
+ *  Equivalent of `CLLocationCoordinate2DIsValid` plus a non negative
+ *  horizontal accuracy
+ */
+inline bool hasValidCoordinate(const Fix &fix) {
+    return fix.horizontalAccuracy >= 0 && fix.latitude >= -90 && fix.latitude <= 90 && fix.longitude >= -180 && fix.longitude <= 180;
+}
+
+inline bool hasGridPosition(const Fix &fix) {
+    return fix.easting == fix.easting && fix.northing == fix.northing;
+}
+
+inline bool hasValidSpeed(const Fix &fix) {
+    return fix.speed >= 0;
+}
+
+inline bool hasValidCourse(const Fix &fix) {
+    return fix.course >= 0;
+}
+
+} // namespace oslocation
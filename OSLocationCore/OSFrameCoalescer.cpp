@@ -0,0 +1,108 @@
+//
+//  OSFrameCoalescer.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFrameCoalescer.h"
+#include "OSLocalFrame.h"
+
+#include <algorithm>
+
+namespace oslocation {
+
+void FrameCoalescer::addFixes(const FixBuffer &fixes, double now) {
+    if (fixes.empty()) {
+        return;
+    }
+    if (!hasPending()) {
+        m_pendingSince = now;
+    }
+    m_fixes.insert(m_fixes.end(), fixes.begin(), fixes.end());
+    m_statistics.fixes += fixes.size();
+}
+
+void FrameCoalescer::addHeading(const Heading &heading, double now) {
+    if (!hasPending()) {
+        m_pendingSince = now;
+    }
+    if (m_hasHeading) {
+        m_statistics.headingsCoalesced++;
+    }
+    m_hasHeading = true;
+    m_heading = heading;
+    m_statistics.headings++;
+}
+
+bool FrameCoalescer::isSignificant() const {
+    if (m_hasHeading && (!m_hasDeliveredHeading || angularDifference(headingDirection(m_heading), headingDirection(m_deliveredHeading)) >= m_options.minimumHeadingChange)) {
+        return true;
+    }
+    if (m_fixes.empty()) {
+        return false;
+    }
+    const Fix &latest = m_fixes.back();
+    if (!m_hasDeliveredFix || !hasValidCoordinate(latest)) {
+        return true;
+    }
+    double east, north;
+    LocalFrame(m_deliveredFix.latitude, m_deliveredFix.longitude).toLocal(latest.latitude, latest.longitude, east, north);
+    return east * east + north * north >= m_options.minimumDistance * m_options.minimumDistance;
+}
+
+double FrameCoalescer::nextFrameTime() const {
+    if (!hasPending()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const double earliest = m_lastFrame + m_options.frameInterval;
+    return isSignificant() ? earliest : std::max(earliest, m_pendingSince + m_options.maximumDelay);
+}
+
+bool FrameCoalescer::takeFrame(double now, Frame &frame) {
+    if (now < nextFrameTime()) {
+        return false;
+    }
+    moveInto(frame);
+    m_lastFrame = now;
+    return true;
+}
+
+bool FrameCoalescer::flush(Frame &frame) {
+    if (!hasPending()) {
+        return false;
+    }
+    moveInto(frame);
+    return true;
+}
+
+void FrameCoalescer::moveInto(Frame &frame) {
+    frame.fixes.clear();
+    frame.fixes.swap(m_fixes);
+    frame.hasHeading = m_hasHeading;
+    frame.heading = m_heading;
+
+    for (auto fix = frame.fixes.rbegin(); fix != frame.fixes.rend(); ++fix) {
+        if (hasValidCoordinate(*fix)) {
+            m_hasDeliveredFix = true;
+            m_deliveredFix = *fix;
+            break;
+        }
+    }
+    if (m_hasHeading) {
+        m_hasDeliveredHeading = true;
+        m_deliveredHeading = m_heading;
+    }
+    m_hasHeading = false;
+    m_statistics.frames++;
+}
+
+void FrameCoalescer::reset() {
+    m_fixes.clear();
+    m_hasHeading = false;
+    m_lastFrame = -std::numeric_limits<double>::infinity();
+    m_hasDeliveredFix = false;
+    m_hasDeliveredHeading = false;
+}
+
+} // namespace oslocation
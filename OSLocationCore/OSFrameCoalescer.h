@@ -0,0 +1,123 @@
+//
+//  OSFrameCoalescer.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSCompass.h"
+#include "OSFix.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace oslocation {
+
+struct FrameOptions {
+    /**
+     *  Shortest time in seconds between frames
+     */
+    double frameInterval = 1.0 / 60;
+    /**
+     *  A heading turning less than this many degrees from the last one
+     *  delivered does not need a frame of its own...
+     */
+    double minimumHeadingChange = 1;
+    /**
+     *  ...nor do fixes less than this many metres from the last one
+     */
+    double minimumDistance = 1;
+    /**
+     *  Changes below both thresholds are still delivered once they have
+     *  waited this many seconds. Infinity holds them until a larger change.
+     */
+    double maximumDelay = 1;
+};
+
+/**
+ *  Everything to deliver in one callback
+ */
+struct Frame {
+    FixBuffer fixes;
+    bool hasHeading = false;
+    Heading heading;
+};
+
+struct FrameStatistics {
+    std::uint64_t fixes = 0;
+    std::uint64_t headings = 0;
+    /**
+     *  Headings replaced by a later one before they were delivered
+     */
+    std::uint64_t headingsCoalesced = 0;
+    std::uint64_t frames = 0;
+};
+
+/**
+ *  Merges fix and heading updates into at most one frame per frame
+ *  interval, for displays that redraw on every callback. Every fix is kept;
+ *  only the latest heading is. A frame is only due once the pending heading
+ *  or position has moved far enough from the last one delivered, or the
+ *  change has waited for `maximumDelay`.
+ *
+ *  Times passed in are in seconds on any monotonic clock.
+ */
+class FrameCoalescer {
+public:
+    explicit FrameCoalescer(FrameOptions options = FrameOptions()) : m_options(options) {}
+
+    const FrameOptions &options() const { return m_options; }
+
+    void addFixes(const FixBuffer &fixes, double now);
+    void addHeading(const Heading &heading, double now);
+
+    bool hasPending() const { return !m_fixes.empty() || m_hasHeading; }
+
+    /**
+     *  Time from which `takeFrame` will return a frame, or infinity if
+     *  nothing is pending
+     */
+    double nextFrameTime() const;
+
+    /**
+     *  Moves everything pending into `frame` if a frame is due
+     *
+     *  @return false if no frame is due at `now`
+     */
+    bool takeFrame(double now, Frame &frame);
+
+    /**
+     *  Moves everything pending into `frame` whether or not it is due, as
+     *  when updates stop
+     *
+     *  @return false if nothing was pending
+     */
+    bool flush(Frame &frame);
+
+    /**
+     *  Forgets everything pending and delivered
+     */
+    void reset();
+
+    const FrameStatistics &statistics() const { return m_statistics; }
+
+private:
+    bool isSignificant() const;
+    void moveInto(Frame &frame);
+
+    FrameOptions m_options;
+    FixBuffer m_fixes;
+    bool m_hasHeading = false;
+    Heading m_heading;
+    double m_pendingSince = 0;
+    double m_lastFrame = -std::numeric_limits<double>::infinity();
+    bool m_hasDeliveredFix = false;
+    Fix m_deliveredFix;
+    bool m_hasDeliveredHeading = false;
+    Heading m_deliveredHeading;
+    FrameStatistics m_statistics;
+};
+
+} // namespace oslocation
@@ -0,0 +1,426 @@
+//
+//  OSGPXReader.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSGPXReader.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+const double kPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+inline bool isNameEnd(char c) {
+    return isSpace(c) || c == '>' || c == '/';
+}
+
+inline const char *find(const char *from, const char *end, char c) {
+    const void *found = std::memchr(from, c, static_cast<std::size_t>(end - from));
+    return found ? static_cast<const char *>(found) : end;
+}
+
+inline const char *find(const char *from, const char *end, std::string_view needle) {
+    while (from < end) {
+        from = find(from, end, needle.front());
+        if (static_cast<std::size_t>(end - from) < needle.size()) {
+            return end;
+        }
+        if (std::memcmp(from, needle.data(), needle.size()) == 0) {
+            return from;
+        }
+        from++;
+    }
+    return end;
+}
+
+/**
+ *  Reads an element name, dropping any namespace prefix
+ */
+inline std::string_view readName(const char *&cursor, const char *end) {
+    const char *start = cursor;
+    while (cursor < end && !isNameEnd(*cursor)) {
+        if (*cursor == ':') {
+            start = cursor + 1;
+        }
+        cursor++;
+    }
+    return std::string_view(start, static_cast<std::size_t>(cursor - start));
+}
+
+inline bool pointType(std::string_view name, GPXPointType &type) {
+    if (name == "wpt") {
+        type = GPXPointType::Waypoint;
+    } else if (name == "trkpt") {
+        type = GPXPointType::TrackPoint;
+    } else if (name == "rtept") {
+        type = GPXPointType::RoutePoint;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+inline bool readDigits(const char *&cursor, const char *end, int count, int &value) {
+    value = 0;
+    for (int i = 0; i < count; i++) {
+        if (cursor >= end || !isDigit(*cursor)) {
+            return false;
+        }
+        value = value * 10 + (*cursor++ - '0');
+    }
+    return true;
+}
+
+inline bool expect(const char *&cursor, const char *end, char c) {
+    if (cursor < end && *cursor == c) {
+        cursor++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ *  Days between 1970-01-01 and the given proleptic Gregorian date
+ */
+inline std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    const unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+}
+
+} // namespace
+
+namespace gpx {
+
+bool parseDecimal(const char *&cursor, const char *end, double &value) {
+    const char *p = cursor;
+    while (p < end && isSpace(*p)) {
+        p++;
+    }
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    std::uint64_t mantissa = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+    bool anyDigits = false;
+    for (; p < end && isDigit(*p); p++) {
+        anyDigits = true;
+        if (significantDigits < 19) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+            significantDigits += mantissa != 0;
+        } else {
+            exponent++;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && isDigit(*p); p++) {
+            anyDigits = true;
+            if (significantDigits < 19) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+                significantDigits += mantissa != 0;
+                exponent--;
+            }
+        }
+    }
+    if (!anyDigits) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negativeExponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negativeExponent = *q == '-';
+            q++;
+        }
+        if (q < end && isDigit(*q)) {
+            int explicitExponent = 0;
+            for (; q < end && isDigit(*q); q++) {
+                if (explicitExponent < 10000) {
+                    explicitExponent = explicitExponent * 10 + (*q - '0');
+                }
+            }
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            p = q;
+        }
+    }
+
+    // Dividing by an exact power of ten is correctly rounded whenever the
+    // mantissa fits in 53 bits, which covers every coordinate a GPS produces.
+    double result = static_cast<double>(mantissa);
+    while (exponent < -22) {
+        result /= 1e22;
+        exponent += 22;
+    }
+    while (exponent > 22) {
+        result *= 1e22;
+        exponent -= 22;
+    }
+    result = exponent < 0 ? result / kPowersOfTen[-exponent] : result * kPowersOfTen[exponent];
+    value = negative ? -result : result;
+    cursor = p;
+    return true;
+}
+
+bool parseTimestamp(std::string_view text, double &seconds) {
+    const char *cursor = text.data();
+    const char *end = cursor + text.size();
+    while (cursor < end && isSpace(*cursor)) {
+        cursor++;
+    }
+    int year, month, day, hour, minute, second;
+    if (!readDigits(cursor, end, 4, year) || !expect(cursor, end, '-') ||
+        !readDigits(cursor, end, 2, month) || !expect(cursor, end, '-') ||
+        !readDigits(cursor, end, 2, day) || !(expect(cursor, end, 'T') || expect(cursor, end, ' ')) ||
+        !readDigits(cursor, end, 2, hour) || !expect(cursor, end, ':') ||
+        !readDigits(cursor, end, 2, minute) || !expect(cursor, end, ':') ||
+        !readDigits(cursor, end, 2, second)) {
+        return false;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 24 || minute > 59 || second > 60) {
+        return false;
+    }
+
+    double fraction = 0;
+    if (cursor < end && (*cursor == '.' || *cursor == ',')) {
+        double scale = 0.1;
+        for (cursor++; cursor < end && isDigit(*cursor); cursor++) {
+            fraction += (*cursor - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+
+    int offsetMinutes = 0;
+    if (cursor < end && (*cursor == '+' || *cursor == '-')) {
+        int sign = *cursor++ == '-' ? -1 : 1;
+        int offsetHours, offsetMinutesPart = 0;
+        if (!readDigits(cursor, end, 2, offsetHours)) {
+            return false;
+        }
+        expect(cursor, end, ':');
+        if (cursor < end && isDigit(*cursor) && !readDigits(cursor, end, 2, offsetMinutesPart)) {
+            return false;
+        }
+        offsetMinutes = sign * (offsetHours * 60 + offsetMinutesPart);
+    } else {
+        expect(cursor, end, 'Z');
+    }
+    while (cursor < end && isSpace(*cursor)) {
+        cursor++;
+    }
+    if (cursor != end) {
+        return false;
+    }
+
+    std::int64_t days = daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day));
+    std::int64_t whole = days * 86400 + hour * 3600 + minute * 60 + second - offsetMinutes * 60;
+    seconds = static_cast<double>(whole) + fraction;
+    return true;
+}
+
+} // namespace gpx
+
+GPXScanner::GPXScanner(std::string_view document)
+    : m_begin(document.data()), m_cursor(document.data()), m_end(document.data() + document.size()) {
+}
+
+bool GPXScanner::fail(const char *position) {
+    m_status = GPXStatus::Malformed;
+    m_cursor = position;
+    return false;
+}
+
+bool GPXScanner::readPointAttributes(GPXPoint &point, bool &selfClosing) {
+    bool hasLatitude = false;
+    bool hasLongitude = false;
+    const char *p = m_cursor;
+    for (;;) {
+        while (p < m_end && isSpace(*p)) {
+            p++;
+        }
+        if (p >= m_end) {
+            return fail(p);
+        }
+        if (*p == '>') {
+            selfClosing = false;
+            p++;
+            break;
+        }
+        if (*p == '/') {
+            if (p + 1 >= m_end || p[1] != '>') {
+                return fail(p);
+            }
+            selfClosing = true;
+            p += 2;
+            break;
+        }
+
+        const char *nameStart = p;
+        while (p < m_end && *p != '=' && !isSpace(*p) && *p != '>') {
+            p++;
+        }
+        std::string_view name(nameStart, static_cast<std::size_t>(p - nameStart));
+        while (p < m_end && isSpace(*p)) {
+            p++;
+        }
+        if (p >= m_end || *p != '=') {
+            return fail(p);
+        }
+        p++;
+        while (p < m_end && isSpace(*p)) {
+            p++;
+        }
+        if (p >= m_end || (*p != '"' && *p != '\'')) {
+            return fail(p);
+        }
+        const char quote = *p++;
+        const char *valueEnd = find(p, m_end, quote);
+        if (valueEnd >= m_end) {
+            return fail(p);
+        }
+
+        if (name == "lat" || name == "lon") {
+            double value;
+            const char *number = p;
+            if (!gpx::parseDecimal(number, valueEnd, value)) {
+                return fail(p);
+            }
+            if (name == "lat") {
+                point.latitude = value;
+                hasLatitude = true;
+            } else {
+                point.longitude = value;
+                hasLongitude = true;
+            }
+        }
+        p = valueEnd + 1;
+    }
+    m_cursor = p;
+    if (!hasLatitude || !hasLongitude) {
+        return fail(p);
+    }
+    return true;
+}
+
+bool GPXScanner::next(GPXPoint &point) {
+    if (m_status != GPXStatus::Ok) {
+        return false;
+    }
+
+    bool inPoint = false;
+    std::string_view pointName;
+    while (m_cursor < m_end) {
+        const char *tag = find(m_cursor, m_end, '<');
+        if (tag >= m_end) {
+            m_cursor = m_end;
+            break;
+        }
+        const char *p = tag + 1;
+        if (p >= m_end) {
+            return fail(tag);
+        }
+
+        if (*p == '!') {
+            std::string_view rest(p, static_cast<std::size_t>(m_end - p));
+            const char *close;
+            if (rest.substr(0, 3) == "!--") {
+                close = find(p + 3, m_end, std::string_view("-->"));
+                m_cursor = close < m_end ? close + 3 : m_end;
+            } else if (rest.substr(0, 8) == "![CDATA[") {
+                close = find(p + 8, m_end, std::string_view("]]>"));
+                m_cursor = close < m_end ? close + 3 : m_end;
+            } else {
+                close = find(p, m_end, '>');
+                m_cursor = close < m_end ? close + 1 : m_end;
+            }
+            continue;
+        }
+        if (*p == '?') {
+            const char *close = find(p, m_end, std::string_view("?>"));
+            m_cursor = close < m_end ? close + 2 : m_end;
+            continue;
+        }
+
+        if (*p == '/') {
+            p++;
+            std::string_view name = readName(p, m_end);
+            const char *close = find(p, m_end, '>');
+            m_cursor = close < m_end ? close + 1 : m_end;
+            if (inPoint && name == pointName) {
+                return true;
+            }
+            continue;
+        }
+
+        std::string_view name = readName(p, m_end);
+        if (!inPoint) {
+            GPXPointType type;
+            if (pointType(name, type)) {
+                point.type = type;
+                point.elevation = std::numeric_limits<double>::quiet_NaN();
+                point.time = std::numeric_limits<double>::quiet_NaN();
+                m_cursor = p;
+                bool selfClosing = false;
+                if (!readPointAttributes(point, selfClosing)) {
+                    return false;
+                }
+                if (selfClosing) {
+                    return true;
+                }
+                inPoint = true;
+                pointName = name;
+                continue;
+            }
+        } else if (name == "ele" || name == "time") {
+            const char *textStart = find(p, m_end, '>');
+            if (textStart >= m_end) {
+                return fail(tag);
+            }
+            textStart++;
+            const char *textEnd = find(textStart, m_end, '<');
+            if (name == "ele") {
+                const char *number = textStart;
+                if (!gpx::parseDecimal(number, textEnd, point.elevation)) {
+                    return fail(textStart);
+                }
+            } else if (!gpx::parseTimestamp(std::string_view(textStart, static_cast<std::size_t>(textEnd - textStart)), point.time)) {
+                return fail(textStart);
+            }
+            m_cursor = textEnd;
+            continue;
+        }
+
+        const char *close = find(p, m_end, '>');
+        m_cursor = close < m_end ? close + 1 : m_end;
+    }
+
+    if (inPoint) {
+        return fail(m_end);
+    }
+    return false;
+}
+
+} // namespace oslocation
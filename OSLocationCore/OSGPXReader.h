@@ -0,0 +1,148 @@
+//
+//  OSGPXReader.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+#include "OSMappedFile.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace oslocation {
+
+enum class GPXPointType : std::uint8_t {
+    Waypoint,
+    RoutePoint,
+    TrackPoint,
+};
+
+/**
+ *  A single `<wpt>`, `<rtept>` or `<trkpt>`. Elevation and time are NaN when
+ *  the point has no `<ele>` or `<time>` child.
+ */
+struct GPXPoint {
+    double latitude;
+    double longitude;
+    double elevation;
+    /**
+     *  Seconds since 1 January 1970 UTC
+     */
+    double time;
+    GPXPointType type;
+};
+
+enum class GPXStatus {
+    Ok,
+    /**
+     *  The document ended inside a point, or a point had an unreadable
+     *  `lat`, `lon`, `<ele>` or `<time>`
+     */
+    Malformed,
+    /**
+     *  The file could not be mapped
+     */
+    FileError,
+};
+
+struct GPXResult {
+    GPXStatus status;
+    std::size_t points;
+    /**
+     *  Byte offset of the first problem when `status` is `Malformed`
+     */
+    std::size_t errorOffset;
+};
+
+/**
+ *  Pull scanner over a GPX document held in memory. It never copies or
+ *  allocates: element names and values are compared in place and only the
+ *  elements that describe points are looked at.
+ */
+class GPXScanner {
+public:
+    explicit GPXScanner(std::string_view document);
+
+    /**
+     *  Advances to the next point in document order.
+     *
+     *  @return false at the end of the document or on the first error
+     */
+    bool next(GPXPoint &point);
+
+    GPXStatus status() const { return m_status; }
+    std::size_t offset() const { return static_cast<std::size_t>(m_cursor - m_begin); }
+
+private:
+    bool fail(const char *position);
+    bool readPointAttributes(GPXPoint &point, bool &selfClosing);
+
+    const char *m_begin;
+    const char *m_cursor;
+    const char *m_end;
+    GPXStatus m_status = GPXStatus::Ok;
+};
+
+/**
+ *  SAX style GPX reader streaming every point to a callback
+ */
+class GPXReader {
+public:
+    template <typename Callback>
+    static GPXResult read(std::string_view document, Callback &&callback) {
+        GPXScanner scanner(document);
+        GPXPoint point;
+        std::size_t count = 0;
+        while (scanner.next(point)) {
+            callback(point);
+            count++;
+        }
+        return GPXResult{scanner.status(), count, scanner.status() == GPXStatus::Ok ? 0 : scanner.offset()};
+    }
+
+    template <typename Callback>
+    static GPXResult readFile(const std::string &path, Callback &&callback) {
+        MappedFile file;
+        if (!file.open(path)) {
+            return GPXResult{GPXStatus::FileError, 0, 0};
+        }
+        return read(file.contents(), std::forward<Callback>(callback));
+    }
+};
+
+namespace gpx {
+
+/**
+ *  Parses a decimal number such as `-1.470514` or `1.5e3`, advancing the
+ *  cursor past it. Leading whitespace is skipped.
+ */
+bool parseDecimal(const char *&cursor, const char *end, double &value);
+
+/**
+ *  Parses an ISO 8601 timestamp (`2014-08-08T12:06:51Z`, optionally with
+ *  fractional seconds and a `±HH:MM` offset) into seconds since 1970 UTC
+ */
+bool parseTimestamp(std::string_view text, double &seconds);
+
+} // namespace gpx
+
+/**
+ *  Converts a GPX point to a fix. GPX carries no accuracy so the caller
+ *  supplies the horizontal accuracy to assume.
+ */
+inline Fix makeFix(const GPXPoint &point, double horizontalAccuracy) {
+    Fix fix = makeFix(std::isnan(point.time) ? 0 : point.time, point.latitude, point.longitude, std::isnan(point.elevation) ? 0 : point.elevation);
+    fix.horizontalAccuracy = horizontalAccuracy;
+    fix.verticalAccuracy = std::isnan(point.elevation) ? -1 : horizontalAccuracy * 2;
+    return fix;
+}
+
+} // namespace oslocation
@@ -0,0 +1,598 @@
+//
+//  OSGeodesic.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSGeodesic.h"
+#include "OSGeodesicKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+// The inverse problem from C. F. F. Karney, "Algorithms for geodesics",
+// J. Geodesy 87 (2013), with the series to sixth order in the third
+// flattening as in GeographicLib. Only the distance is solved for.
+
+const int kOrder = 6;
+const int kA3 = kOrder, kC1 = kOrder, kC2 = kOrder, kC3 = kOrder;
+const int kC3Coefficients = kC3 * (kC3 - 1) / 2;
+
+const double kTiny = std::sqrt(std::numeric_limits<double>::min());
+const double kTolerance0 = std::numeric_limits<double>::epsilon();
+const double kTolerance1 = 200 * kTolerance0;
+const double kTolerance2 = std::sqrt(kTolerance0);
+const double kToleranceBisection = kTolerance0 * kTolerance2;
+const double kXThreshold = 1000 * kTolerance2;
+const int kNewtonIterations = 20;
+const int kIterations = kNewtonIterations + std::numeric_limits<double>::digits + 10;
+
+inline double square(double x) {
+    return x * x;
+}
+
+inline void normalise(double &sine, double &cosine) {
+    const double r = std::hypot(sine, cosine);
+    sine /= r;
+    cosine /= r;
+}
+
+/**
+ *  Horner evaluation of p[0] x^n + ... + p[n]
+ */
+double polynomial(int n, const double *p, double x) {
+    double y = n < 0 ? 0 : *p++;
+    while (--n >= 0) {
+        y = y * x + *p++;
+    }
+    return y;
+}
+
+/**
+ *  Rounds tiny values so that angles near zero come out exact
+ */
+double roundAngle(double x) {
+    const double z = 1.0 / 16;
+    double y = std::fabs(x);
+    y = y < z ? z - (z - y) : y;
+    return std::copysign(y, x);
+}
+
+/**
+ *  Sine and cosine of an angle in degrees, exact at multiples of 90
+ */
+void sinCosDegrees(double x, double &sine, double &cosine) {
+    double r = std::fmod(x, 360.0);
+    const int quadrant = static_cast<int>(std::nearbyint(r / 90));
+    r = (r - 90 * quadrant) * kDegreesToRadians;
+    const double s = std::sin(r), c = std::cos(r);
+    switch (static_cast<unsigned>(quadrant) & 3u) {
+        case 0: sine = s; cosine = c; break;
+        case 1: sine = c; cosine = -s; break;
+        case 2: sine = -s; cosine = -c; break;
+        default: sine = -c; cosine = s; break;
+    }
+    cosine += 0.0;
+    if (x != 0) {
+        sine += 0.0;
+    }
+}
+
+/**
+ *  Difference of two longitudes, reduced to [-180, 180]
+ */
+double longitudeDifference(double x, double y) {
+    double d = std::remainder(y - x, 360.0);
+    return d == -180 ? 180 : d;
+}
+
+/**
+ *  Clenshaw summation of sum c[l] sin(2 l x), or of cos(2 l x) with
+ *  `sine` false, for l from 1 to n
+ */
+double sinCosSeries(bool sine, double sinx, double cosx, const double *c, int n) {
+    c += n + sine;
+    const double ar = 2 * (cosx - sinx) * (cosx + sinx);
+    double y0 = (n & 1) ? *--c : 0, y1 = 0;
+    n /= 2;
+    while (n--) {
+        y1 = ar * y0 - y1 + *--c;
+        y0 = ar * y1 - y0 + *--c;
+    }
+    return sine ? 2 * sinx * cosx * y0 : cosx * (y0 - y1);
+}
+
+double a1m1(double eps) {
+    static const double coefficients[] = {1, 4, 64, 0, 256};
+    const double t = polynomial(kA3 / 2, coefficients, square(eps)) / coefficients[kA3 / 2 + 1];
+    return (t + eps) / (1 - eps);
+}
+
+void c1(double eps, double *c) {
+    static const double coefficients[] = {
+        -1, 6, -16, 32,
+        -9, 64, -128, 2048,
+        9, -16, 768,
+        3, -5, 512,
+        -7, 1280,
+        -7, 2048,
+    };
+    const double eps2 = square(eps);
+    double d = eps;
+    int o = 0;
+    for (int l = 1; l <= kC1; l++) {
+        const int m = (kC1 - l) / 2;
+        c[l] = d * polynomial(m, coefficients + o, eps2) / coefficients[o + m + 1];
+        o += m + 2;
+        d *= eps;
+    }
+}
+
+double a2m1(double eps) {
+    static const double coefficients[] = {-11, -28, -192, 0, 256};
+    const double t = polynomial(kA3 / 2, coefficients, square(eps)) / coefficients[kA3 / 2 + 1];
+    return (t - eps) / (1 + eps);
+}
+
+void c2(double eps, double *c) {
+    static const double coefficients[] = {
+        1, 2, 16, 32,
+        35, 64, 384, 2048,
+        15, 80, 768,
+        7, 35, 512,
+        63, 1280,
+        77, 2048,
+    };
+    const double eps2 = square(eps);
+    double d = eps;
+    int o = 0;
+    for (int l = 1; l <= kC2; l++) {
+        const int m = (kC2 - l) / 2;
+        c[l] = d * polynomial(m, coefficients + o, eps2) / coefficients[o + m + 1];
+        o += m + 2;
+        d *= eps;
+    }
+}
+
+/**
+ *  Solves geodesics on the WGS84 ellipsoid, holding the series coefficients
+ *  that depend only on the ellipsoid
+ */
+struct GeodesicSolver {
+    double a, f, f1, e2, ep2, n, b, etol2;
+    double a3x[kA3];
+    double c3x[kC3Coefficients];
+
+    GeodesicSolver() {
+        a = kWGS84.semiMajorAxis;
+        b = kWGS84.semiMinorAxis;
+        f = (a - b) / a;
+        f1 = 1 - f;
+        e2 = f * (2 - f);
+        ep2 = e2 / square(f1);
+        n = f / (2 - f);
+        etol2 = 0.1 * kTolerance2 / std::sqrt(std::max(0.001, std::fabs(f)) * std::min(1.0, 1 - f / 2) / 2);
+
+        static const double a3Coefficients[] = {
+            -3, 128,
+            -2, -3, 64,
+            -1, -3, -1, 16,
+            3, -1, -2, 8,
+            1, -1, 2,
+            1, 1,
+        };
+        int o = 0, k = 0;
+        for (int j = kA3 - 1; j >= 0; j--) {
+            const int m = std::min(kA3 - j - 1, j);
+            a3x[k++] = polynomial(m, a3Coefficients + o, n) / a3Coefficients[o + m + 1];
+            o += m + 2;
+        }
+
+        static const double c3Coefficients[] = {
+            3, 128,
+            2, 5, 128,
+            -1, 3, 3, 64,
+            -1, 0, 1, 8,
+            -1, 1, 4,
+            5, 256,
+            1, 3, 128,
+            -3, -2, 3, 64,
+            1, -3, 2, 32,
+            7, 512,
+            -10, 9, 384,
+            5, -9, 5, 192,
+            7, 512,
+            -14, 7, 512,
+            21, 2560,
+        };
+        o = 0;
+        k = 0;
+        for (int l = 1; l < kC3; l++) {
+            for (int j = kC3 - 1; j >= l; j--) {
+                const int m = std::min(kC3 - j - 1, j);
+                c3x[k++] = polynomial(m, c3Coefficients + o, n) / c3Coefficients[o + m + 1];
+                o += m + 2;
+            }
+        }
+    }
+
+    double a3(double eps) const { return polynomial(kA3 - 1, a3x, eps); }
+
+    void c3(double eps, double *c) const {
+        double multiplier = 1;
+        int o = 0;
+        for (int l = 1; l < kC3; l++) {
+            const int m = kC3 - l - 1;
+            multiplier *= eps;
+            c[l] = multiplier * polynomial(m, c3x + o, eps);
+            o += m + 1;
+        }
+    }
+
+    /**
+     *  Distance and reduced length along the auxiliary sphere, in units of b
+     */
+    void lengths(double eps, double sig12, double ssig1, double csig1, double dn1, double ssig2, double csig2, double dn2, bool wantDistance, bool wantReducedLength, double &s12b, double &m12b) const {
+        double ca[kC1 + 1], cb[kC2 + 1];
+        double a1 = a1m1(eps);
+        c1(eps, ca);
+        double a2 = 0, m0x = 0, j12 = 0;
+        if (wantReducedLength) {
+            a2 = a2m1(eps);
+            c2(eps, cb);
+            m0x = a1 - a2;
+            a2 = 1 + a2;
+        }
+        a1 = 1 + a1;
+        if (wantDistance) {
+            const double b1 = sinCosSeries(true, ssig2, csig2, ca, kC1) - sinCosSeries(true, ssig1, csig1, ca, kC1);
+            s12b = a1 * (sig12 + b1);
+            if (wantReducedLength) {
+                const double b2 = sinCosSeries(true, ssig2, csig2, cb, kC2) - sinCosSeries(true, ssig1, csig1, cb, kC2);
+                j12 = m0x * sig12 + (a1 * b1 - a2 * b2);
+            }
+        } else if (wantReducedLength) {
+            for (int l = 1; l <= kC2; l++) {
+                cb[l] = a1 * ca[l] - a2 * cb[l];
+            }
+            j12 = m0x * sig12 + (sinCosSeries(true, ssig2, csig2, cb, kC2) - sinCosSeries(true, ssig1, csig1, cb, kC2));
+        }
+        if (wantReducedLength) {
+            m12b = dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) - csig1 * csig2 * j12;
+        }
+    }
+
+    /**
+     *  Solves the astroid problem for the starting guess of nearly antipodal
+     *  points
+     */
+    static double astroid(double x, double y) {
+        const double p = square(x), q = square(y), r = (p + q - 1) / 6;
+        if (q == 0 && r <= 0) {
+            return 0;
+        }
+        const double s = p * q / 4, r2 = square(r), r3 = r * r2;
+        const double disc = s * (s + 2 * r3);
+        double u = r;
+        if (disc >= 0) {
+            double t3 = s + r3;
+            t3 += t3 < 0 ? -std::sqrt(disc) : std::sqrt(disc);
+            const double t = std::cbrt(t3);
+            u += t + (t != 0 ? r2 / t : 0);
+        } else {
+            const double angle = std::atan2(std::sqrt(-disc), -(s + r3));
+            u += 2 * r * std::cos(angle / 3);
+        }
+        const double v = std::sqrt(square(u) + q);
+        const double uv = u < 0 ? q / (v - u) : u + v;
+        const double w = (uv - q) / (2 * v);
+        return uv / (std::sqrt(uv + square(w)) + w);
+    }
+
+    /**
+     *  Starting azimuth for Newton's method, or the whole answer for short
+     *  lines, in which case the returned arc is non-negative
+     */
+    double inverseStart(double sbet1, double cbet1, double sbet2, double cbet2, double lam12, double slam12, double clam12, double &salp1, double &calp1, double &dnm) const {
+        double sig12 = -1;
+        const double sbet12 = sbet2 * cbet1 - cbet2 * sbet1;
+        const double cbet12 = cbet2 * cbet1 + sbet2 * sbet1;
+        const double sbet12a = sbet2 * cbet1 + cbet2 * sbet1;
+        const bool shortline = cbet12 >= 0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5;
+        double somg12, comg12;
+        if (shortline) {
+            double sbetm2 = square(sbet1 + sbet2);
+            sbetm2 /= sbetm2 + square(cbet1 + cbet2);
+            dnm = std::sqrt(1 + ep2 * sbetm2);
+            const double omg12 = lam12 / (f1 * dnm);
+            somg12 = std::sin(omg12);
+            comg12 = std::cos(omg12);
+        } else {
+            somg12 = slam12;
+            comg12 = clam12;
+        }
+
+        salp1 = cbet2 * somg12;
+        calp1 = comg12 >= 0 ? sbet12 + cbet2 * sbet1 * square(somg12) / (1 + comg12) : sbet12a - cbet2 * sbet1 * square(somg12) / (1 - comg12);
+        const double ssig12 = std::hypot(salp1, calp1);
+        const double csig12 = sbet1 * sbet2 + cbet1 * cbet2 * comg12;
+
+        if (shortline && ssig12 < etol2) {
+            sig12 = std::atan2(ssig12, csig12);
+        } else if (std::fabs(n) > 0.1 || csig12 >= 0 || ssig12 >= 6 * std::fabs(n) * M_PI * square(cbet1)) {
+            // The spherical starting point is good enough
+        } else {
+            // Nearly antipodal: scale to the astroid problem
+            const double lam12x = std::atan2(-slam12, -clam12);
+            const double k2 = square(sbet1) * ep2;
+            const double eps = k2 / (2 * (1 + std::sqrt(1 + k2)) + k2);
+            const double lamscale = f * cbet1 * a3(eps) * M_PI;
+            const double betscale = lamscale * cbet1;
+            const double x = lam12x / lamscale;
+            const double y = sbet12a / betscale;
+            if (y > -kTolerance1 && x > -1 - kXThreshold) {
+                salp1 = std::min(1.0, -x);
+                calp1 = -std::sqrt(1 - square(salp1));
+            } else {
+                const double k = astroid(x, y);
+                const double omg12a = lamscale * (-x * k / (1 + k));
+                somg12 = std::sin(omg12a);
+                comg12 = -std::cos(omg12a);
+                salp1 = cbet2 * somg12;
+                calp1 = sbet12a - cbet2 * sbet1 * square(somg12) / (1 - comg12);
+            }
+        }
+        if (!(salp1 <= 0)) {
+            normalise(salp1, calp1);
+        } else {
+            salp1 = 1;
+            calp1 = 0;
+        }
+        return sig12;
+    }
+
+    /**
+     *  Longitude difference reached by setting off at azimuth alp1, less the
+     *  one wanted, and its derivative
+     */
+    double lambda12(double sbet1, double cbet1, double dn1, double sbet2, double cbet2, double dn2, double salp1, double calp1, double slam120, double clam120, double &sig12, double &ssig1, double &csig1, double &ssig2, double &csig2, double &eps, bool wantDerivative, double &derivative) const {
+        if (sbet1 == 0 && calp1 == 0) {
+            calp1 = -kTiny;
+        }
+        const double salp0 = salp1 * cbet1;
+        const double calp0 = std::hypot(calp1, salp1 * sbet1);
+
+        ssig1 = sbet1;
+        const double somg1 = salp0 * sbet1;
+        csig1 = calp1 * cbet1;
+        const double comg1 = csig1;
+        normalise(ssig1, csig1);
+
+        const double calp2 = cbet2 != cbet1 || std::fabs(sbet2) != -sbet1
+                                 ? std::sqrt(square(calp1 * cbet1) + (cbet1 < -sbet1 ? (cbet2 - cbet1) * (cbet1 + cbet2) : (sbet1 - sbet2) * (sbet1 + sbet2))) / cbet2
+                                 : std::fabs(calp1);
+
+        ssig2 = sbet2;
+        const double somg2 = salp0 * sbet2;
+        csig2 = calp2 * cbet2;
+        const double comg2 = csig2;
+        normalise(ssig2, csig2);
+
+        sig12 = std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2), csig1 * csig2 + ssig1 * ssig2);
+        const double somg12 = std::max(0.0, comg1 * somg2 - somg1 * comg2);
+        const double comg12 = comg1 * comg2 + somg1 * somg2;
+        const double eta = std::atan2(somg12 * clam120 - comg12 * slam120, comg12 * clam120 + somg12 * slam120);
+
+        const double k2 = square(calp0) * ep2;
+        eps = k2 / (2 * (1 + std::sqrt(1 + k2)) + k2);
+        double c3a[kC3];
+        c3(eps, c3a);
+        const double b312 = sinCosSeries(true, ssig2, csig2, c3a, kC3 - 1) - sinCosSeries(true, ssig1, csig1, c3a, kC3 - 1);
+        const double domg12 = -f * a3(eps) * salp0 * (sig12 + b312);
+
+        if (wantDerivative) {
+            if (calp2 == 0) {
+                derivative = -2 * f1 * dn1 / sbet1;
+            } else {
+                double unused = 0;
+                lengths(eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, false, true, unused, derivative);
+                derivative *= f1 / (calp2 * cbet2);
+            }
+        }
+        return eta + domg12;
+    }
+
+    double inverse(double lat1, double lon1, double lat2, double lon2) const {
+        if (std::fabs(lat1) > 90 || std::fabs(lat2) > 90) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        double lon12 = longitudeDifference(lon1, lon2);
+        lon12 = roundAngle(std::fabs(lon12));
+        const double lam12 = lon12 * kDegreesToRadians;
+        double slam12, clam12;
+        sinCosDegrees(lon12, slam12, clam12);
+        const double lon12Supplement = 180 - lon12;
+
+        lat1 = roundAngle(lat1);
+        lat2 = roundAngle(lat2);
+        // Put the point further from the equator first, in the south
+        if (std::fabs(lat1) < std::fabs(lat2)) {
+            std::swap(lat1, lat2);
+        }
+        const double latitudeSign = lat1 < 0 ? 1 : -1;
+        lat1 *= latitudeSign;
+        lat2 *= latitudeSign;
+
+        double sbet1, cbet1, sbet2, cbet2;
+        sinCosDegrees(lat1, sbet1, cbet1);
+        sbet1 *= f1;
+        normalise(sbet1, cbet1);
+        cbet1 = std::max(kTiny, cbet1);
+        sinCosDegrees(lat2, sbet2, cbet2);
+        sbet2 *= f1;
+        normalise(sbet2, cbet2);
+        cbet2 = std::max(kTiny, cbet2);
+
+        if (cbet1 < -sbet1) {
+            if (cbet2 == cbet1) {
+                sbet2 = std::copysign(sbet1, sbet2);
+            }
+        } else if (std::fabs(sbet2) == -sbet1) {
+            cbet2 = cbet1;
+        }
+
+        const double dn1 = std::sqrt(1 + ep2 * square(sbet1));
+        const double dn2 = std::sqrt(1 + ep2 * square(sbet2));
+
+        double s12x = 0, m12x = 0, sig12 = 0, salp1 = 0, calp1 = 0;
+        bool meridian = lat1 == -90 || slam12 == 0;
+        if (meridian) {
+            calp1 = clam12;
+            salp1 = slam12;
+            const double ssig1 = sbet1, csig1 = calp1 * cbet1;
+            const double ssig2 = sbet2, csig2 = cbet2;
+            sig12 = std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2), csig1 * csig2 + ssig1 * ssig2);
+            lengths(n, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, true, true, s12x, m12x);
+            // A meridian is only the shortest path up to the conjugate point
+            if (sig12 < 1 || m12x >= 0) {
+                if (sig12 < 3 * kTiny) {
+                    s12x = 0;
+                }
+                return s12x * b;
+            }
+            meridian = false;
+        }
+
+        if (sbet1 == 0 && (f <= 0 || lon12Supplement >= f * 180)) {
+            // Along the equator
+            return a * lam12;
+        }
+
+        double dnm = 1;
+        sig12 = inverseStart(sbet1, cbet1, sbet2, cbet2, lam12, slam12, clam12, salp1, calp1, dnm);
+        if (sig12 >= 0) {
+            return sig12 * b * dnm;
+        }
+
+        double ssig1 = 0, csig1 = 0, ssig2 = 0, csig2 = 0, eps = 0;
+        double salp1a = kTiny, calp1a = 1, salp1b = kTiny, calp1b = -1;
+        bool tripNewton = false, tripBisection = false;
+        for (int iteration = 0; iteration < kIterations; iteration++) {
+            double derivative = 0;
+            const double v = lambda12(sbet1, cbet1, dn1, sbet2, cbet2, dn2, salp1, calp1, slam12, clam12, sig12, ssig1, csig1, ssig2, csig2, eps, iteration < kNewtonIterations, derivative);
+            if (tripBisection || !(std::fabs(v) >= (tripNewton ? 8 : 1) * kTolerance0)) {
+                break;
+            }
+            // Keep the bracket for bisection up to date
+            if (v > 0 && (iteration > kNewtonIterations || calp1 / salp1 > calp1b / salp1b)) {
+                salp1b = salp1;
+                calp1b = calp1;
+            } else if (v < 0 && (iteration > kNewtonIterations || calp1 / salp1 < calp1a / salp1a)) {
+                salp1a = salp1;
+                calp1a = calp1;
+            }
+            if (iteration < kNewtonIterations && derivative > 0) {
+                const double dalp1 = -v / derivative;
+                if (std::fabs(dalp1) < M_PI) {
+                    const double sdalp1 = std::sin(dalp1), cdalp1 = std::cos(dalp1);
+                    const double nsalp1 = salp1 * cdalp1 + calp1 * sdalp1;
+                    if (nsalp1 > 0) {
+                        calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+                        salp1 = nsalp1;
+                        normalise(salp1, calp1);
+                        tripNewton = std::fabs(v) <= 16 * kTolerance0;
+                        continue;
+                    }
+                }
+            }
+            salp1 = (salp1a + salp1b) / 2;
+            calp1 = (calp1a + calp1b) / 2;
+            normalise(salp1, calp1);
+            tripNewton = false;
+            tripBisection = std::fabs(salp1a - salp1) + (calp1a - calp1) < kToleranceBisection || std::fabs(salp1 - salp1b) + (calp1 - calp1b) < kToleranceBisection;
+        }
+        double unused = 0;
+        lengths(eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, true, false, s12x, unused);
+        return s12x * b;
+    }
+};
+
+const GeodesicSolver &wgs84Solver() {
+    static const GeodesicSolver solver;
+    return solver;
+}
+
+/**
+ *  Replaces the fast distances too long for the equirectangular formula
+ */
+void refineLongDistances(const double *latitudes1, const double *longitudes1, std::size_t stride1, const double *latitudes2, const double *longitudes2, std::size_t count, double *distances) {
+    for (std::size_t i = 0; i < count; i++) {
+        if (!(distances[i] <= kEquirectangularLimit)) {
+            distances[i] = geodesicDistance(latitudes1[i * stride1], longitudes1[i * stride1], latitudes2[i], longitudes2[i]);
+        }
+    }
+}
+
+} // namespace
+
+double geodesicDistance(double latitude1, double longitude1, double latitude2, double longitude2) {
+    return wgs84Solver().inverse(latitude1, longitude1, latitude2, longitude2);
+}
+
+void consecutiveDistances(const double *latitudes, const double *longitudes, std::size_t count, double *distances, simd::Level level) {
+    if (count < 2) {
+        return;
+    }
+    const std::size_t pairs = count - 1;
+    std::size_t done = 0;
+    if (!simd::isSupported(level)) {
+        level = simd::Level::Scalar;
+    }
+    switch (level) {
+        case simd::Level::AVX2:
+#if defined(__x86_64__) || defined(__i386__)
+            done = detail::consecutiveDistancesAVX2(latitudes, longitudes, pairs, distances);
+#endif
+            break;
+        case simd::Level::NEON:
+#if OS_SIMD_NEON
+            done = detail::consecutiveDistances<simd::NEON>(latitudes, longitudes, pairs, distances);
+#endif
+            break;
+        case simd::Level::Scalar:
+            break;
+    }
+    detail::consecutiveDistances<simd::Scalar>(latitudes + done, longitudes + done, pairs - done, distances + done);
+    refineLongDistances(latitudes, longitudes, 1, latitudes + 1, longitudes + 1, pairs, distances);
+}
+
+void distancesFrom(double latitude, double longitude, const double *latitudes, const double *longitudes, std::size_t count, double *distances, simd::Level level) {
+    std::size_t done = 0;
+    if (!simd::isSupported(level)) {
+        level = simd::Level::Scalar;
+    }
+    switch (level) {
+        case simd::Level::AVX2:
+#if defined(__x86_64__) || defined(__i386__)
+            done = detail::distancesFromAVX2(latitude, longitude, latitudes, longitudes, count, distances);
+#endif
+            break;
+        case simd::Level::NEON:
+#if OS_SIMD_NEON
+            done = detail::distancesFrom<simd::NEON>(latitude, longitude, latitudes, longitudes, count, distances);
+#endif
+            break;
+        case simd::Level::Scalar:
+            break;
+    }
+    detail::distancesFrom<simd::Scalar>(latitude, longitude, latitudes + done, longitudes + done, count - done, distances + done);
+    refineLongDistances(&latitude, &longitude, 0, latitudes, longitudes, count, distances);
+}
+
+} // namespace oslocation
@@ -0,0 +1,81 @@
+//
+//  OSGeodesic.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSEllipsoid.h"
+#include "OSSIMD.h"
+
+#include <cmath>
+#include <cstddef>
+
+namespace oslocation {
+
+/**
+ *  Distance in metres between two nearby points on the WGS84 ellipsoid,
+ *  using the radii of curvature at their mean latitude. Within a millimetre
+ *  of the geodesic for points up to a few kilometres apart, which covers
+ *  the legs between consecutive fixes.
+ */
+inline double equirectangularDistance(double latitude1, double longitude1, double latitude2, double longitude2) {
+    const double e2 = kWGS84.eccentricitySquared();
+    const double meanLatitude = (latitude1 + latitude2) / 2 * kDegreesToRadians;
+    const double s = std::sin(meanLatitude);
+    const double w = 1 - e2 * s * s;
+    const double nu = kWGS84.semiMajorAxis / std::sqrt(w);
+    const double rho = nu * (1 - e2) / w;
+    double dLongitude = longitude2 - longitude1;
+    if (dLongitude > 180) {
+        dLongitude -= 360;
+    } else if (dLongitude < -180) {
+        dLongitude += 360;
+    }
+    const double north = (latitude2 - latitude1) * kDegreesToRadians * rho;
+    const double east = dLongitude * kDegreesToRadians * nu * std::cos(meanLatitude);
+    return std::hypot(east, north);
+}
+
+/**
+ *  Longest separation, in metres, the batch functions trust to the
+ *  equirectangular formula. Its error grows with the cube of the distance
+ *  and is under half a millimetre here across Great Britain; longer legs
+ *  are solved with `geodesicDistance`.
+ */
+constexpr double kEquirectangularLimit = 5000;
+
+/**
+ *  Length in metres of the shortest geodesic between two points on the
+ *  WGS84 ellipsoid, by Karney's method. Accurate to a few nanometres at any
+ *  separation, antipodal points included, but over ten times the cost of
+ *  `equirectangularDistance`.
+ */
+double geodesicDistance(double latitude1, double longitude1, double latitude2, double longitude2);
+
+/**
+ *  Distance in metres between two points of a track, choosing between the
+ *  two methods as the batch functions do
+ */
+inline double distanceBetween(double latitude1, double longitude1, double latitude2, double longitude2) {
+    const double distance = equirectangularDistance(latitude1, longitude1, latitude2, longitude2);
+    return distance <= kEquirectangularLimit ? distance : geodesicDistance(latitude1, longitude1, latitude2, longitude2);
+}
+
+/**
+ *  Distances between each point of a track held as separate latitude and
+ *  longitude arrays and the next one, writing `count - 1` values. Legs up to
+ *  `kEquirectangularLimit` take the equirectangular kernel at the requested
+ *  level and longer ones `geodesicDistance`.
+ */
+void consecutiveDistances(const double *latitudes, const double *longitudes, std::size_t count, double *distances, simd::Level level = simd::bestLevel());
+
+/**
+ *  Distances from one point to each of `count` others, chosen between the
+ *  two methods as `consecutiveDistances` does
+ */
+void distancesFrom(double latitude, double longitude, const double *latitudes, const double *longitudes, std::size_t count, double *distances, simd::Level level = simd::bestLevel());
+
+} // namespace oslocation
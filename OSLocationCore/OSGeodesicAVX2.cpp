@@ -0,0 +1,39 @@
+//
+//  OSGeodesicAVX2.cpp
+//  OSLocationCore
+//
+//  Built with AVX2 and FMA enabled. Nothing in here may run before
+//  simd::isSupported(simd::Level::AVX2) has been checked.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSGeodesicKernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+namespace oslocation {
+namespace detail {
+
+std::size_t consecutiveDistancesAVX2(const double *latitudes, const double *longitudes, std::size_t pairs, double *distances) {
+#if OS_SIMD_AVX2
+    return consecutiveDistances<simd::AVX2>(latitudes, longitudes, pairs, distances);
+#else
+    (void)latitudes, (void)longitudes, (void)pairs, (void)distances;
+    return 0;
+#endif
+}
+
+std::size_t distancesFromAVX2(double latitude, double longitude, const double *latitudes, const double *longitudes, std::size_t count, double *distances) {
+#if OS_SIMD_AVX2
+    return distancesFrom<simd::AVX2>(latitude, longitude, latitudes, longitudes, count, distances);
+#else
+    (void)latitude, (void)longitude, (void)latitudes, (void)longitudes, (void)count, (void)distances;
+    return 0;
+#endif
+}
+
+} // namespace detail
+} // namespace oslocation
+
+#endif
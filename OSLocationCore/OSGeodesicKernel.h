@@ -0,0 +1,80 @@
+//
+//  OSGeodesicKernel.h
+//  OSLocationCore
+//
+//  Batch equirectangular distance kernels shared by every instruction set.
+//  Only included by the translation units that instantiate them.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSGeodesic.h"
+#include "OSSIMD.h"
+
+#include <cstddef>
+
+namespace oslocation {
+namespace detail {
+
+/**
+ *  `equirectangularDistance` for a batch of point pairs, in degrees
+ */
+template <typename V>
+V equirectangularDistance(V latitude1, V longitude1, V latitude2, V longitude2) {
+    const double e2 = kWGS84.eccentricitySquared();
+    const V degrees = V::broadcast(kDegreesToRadians);
+    V s, c;
+    simd::sincos((latitude1 + latitude2) * V::broadcast(0.5 * kDegreesToRadians), s, c);
+    const V w = fma(V::broadcast(-e2) * s, s, V::broadcast(1));
+    const V nu = V::broadcast(kWGS84.semiMajorAxis) / sqrt(w);
+    const V rho = nu * V::broadcast(1 - e2) / w;
+    V dLongitude = longitude2 - longitude1;
+    dLongitude = fma(V::broadcast(-360), round(dLongitude * V::broadcast(1.0 / 360)), dLongitude);
+    const V north = (latitude2 - latitude1) * degrees * rho;
+    const V east = dLongitude * degrees * nu * c;
+    return sqrt(fma(east, east, north * north));
+}
+
+/**
+ *  Distances from each of the first `pairs - pairs % V::width` points to the
+ *  next. Returns how many it did.
+ */
+template <typename V>
+std::size_t consecutiveDistances(const double *latitudes, const double *longitudes, std::size_t pairs, double *distances) {
+    std::size_t i = 0;
+    for (; i + V::width <= pairs; i += V::width) {
+        const V distance = equirectangularDistance(V::load(latitudes + i), V::load(longitudes + i), V::load(latitudes + i + 1), V::load(longitudes + i + 1));
+        distance.store(distances + i);
+    }
+    return i;
+}
+
+/**
+ *  Distances from one point to the first `count - count % V::width` others.
+ *  Returns how many it did.
+ */
+template <typename V>
+std::size_t distancesFrom(double latitude, double longitude, const double *latitudes, const double *longitudes, std::size_t count, double *distances) {
+    const V fromLatitude = V::broadcast(latitude);
+    const V fromLongitude = V::broadcast(longitude);
+    std::size_t i = 0;
+    for (; i + V::width <= count; i += V::width) {
+        const V distance = equirectangularDistance(fromLatitude, fromLongitude, V::load(latitudes + i), V::load(longitudes + i));
+        distance.store(distances + i);
+    }
+    return i;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ *  Defined in OSGeodesicAVX2.cpp, which is compiled with AVX2 enabled.
+ *  Return 0 if the build has no AVX2 kernels.
+ */
+std::size_t consecutiveDistancesAVX2(const double *latitudes, const double *longitudes, std::size_t pairs, double *distances);
+std::size_t distancesFromAVX2(double latitude, double longitude, const double *latitudes, const double *longitudes, std::size_t count, double *distances);
+#endif
+
+} // namespace detail
+} // namespace oslocation
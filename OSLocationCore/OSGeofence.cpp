@@ -0,0 +1,273 @@
+//
+//  OSGeofence.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSGeofence.h"
+#include "OSHelmertTransform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+// Cells are counted from well west and south of the grid's false origin so
+// the key halves stay positive
+constexpr std::int64_t kCellOffset = 1 << 20;
+
+inline double segmentDistanceSquared(double x, double y, double ax, double ay, double bx, double by) {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double lengthSquared = dx * dx + dy * dy;
+    double t = 0;
+    if (lengthSquared > 0) {
+        t = std::min(1.0, std::max(0.0, ((x - ax) * dx + (y - ay) * dy) / lengthSquared));
+    }
+    const double ex = x - (ax + t * dx);
+    const double ey = y - (ay + t * dy);
+    return ex * ex + ey * ey;
+}
+
+} // namespace
+
+GeofenceEngine::GeofenceEngine(const GeofenceOptions &options) : m_options(options) {
+    if (!(m_options.cellSize > 0)) {
+        m_options.cellSize = GeofenceOptions().cellSize;
+    }
+}
+
+std::int64_t GeofenceEngine::cellIndex(double coordinate) const {
+    return static_cast<std::int64_t>(std::floor(coordinate / m_options.cellSize)) + kCellOffset;
+}
+
+std::uint64_t GeofenceEngine::cellKey(double easting, double northing) const {
+    return (static_cast<std::uint64_t>(cellIndex(easting)) << 32) | static_cast<std::uint32_t>(cellIndex(northing));
+}
+
+std::uint32_t GeofenceEngine::allocate(std::uint32_t id) {
+    std::uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_fences.size());
+        m_fences.emplace_back();
+    }
+    Fence &fence = m_fences[slot];
+    fence = Fence{};
+    fence.id = id;
+    fence.active = true;
+    m_ids.emplace(id, slot);
+    return slot;
+}
+
+void GeofenceEngine::index(std::uint32_t slot, bool insert) {
+    const Fence &fence = m_fences[slot];
+    const std::int64_t west = cellIndex(fence.minEasting), east = cellIndex(fence.maxEasting);
+    const std::int64_t south = cellIndex(fence.minNorthing), north = cellIndex(fence.maxNorthing);
+    for (std::int64_t x = west; x <= east; x++) {
+        for (std::int64_t y = south; y <= north; y++) {
+            const std::uint64_t key = (static_cast<std::uint64_t>(x) << 32) | static_cast<std::uint32_t>(y);
+            if (insert) {
+                m_cells[key].push_back(slot);
+                continue;
+            }
+            auto cell = m_cells.find(key);
+            if (cell == m_cells.end()) {
+                continue;
+            }
+            std::vector<std::uint32_t> &slots = cell->second;
+            slots.erase(std::remove(slots.begin(), slots.end(), slot), slots.end());
+            if (slots.empty()) {
+                m_cells.erase(cell);
+            }
+        }
+    }
+}
+
+bool GeofenceEngine::addCircle(std::uint32_t id, double easting, double northing, double radius) {
+    if (m_ids.count(id) || !(radius > 0) || !std::isfinite(easting) || !std::isfinite(northing)) {
+        return false;
+    }
+    const std::uint32_t slot = allocate(id);
+    Fence &fence = m_fences[slot];
+    fence.isCircle = true;
+    fence.centreEasting = easting;
+    fence.centreNorthing = northing;
+    fence.radius = radius;
+    fence.minEasting = easting - radius;
+    fence.maxEasting = easting + radius;
+    fence.minNorthing = northing - radius;
+    fence.maxNorthing = northing + radius;
+    index(slot, true);
+    return true;
+}
+
+bool GeofenceEngine::addPolygon(std::uint32_t id, const double *eastings, const double *northings, std::size_t count) {
+    if (m_ids.count(id) || count < 3) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!std::isfinite(eastings[i]) || !std::isfinite(northings[i])) {
+            return false;
+        }
+    }
+    const std::uint32_t slot = allocate(id);
+    Fence &fence = m_fences[slot];
+    fence.isCircle = false;
+    fence.vertices.reserve(count * 2);
+    fence.minEasting = fence.minNorthing = std::numeric_limits<double>::max();
+    fence.maxEasting = fence.maxNorthing = std::numeric_limits<double>::lowest();
+    for (std::size_t i = 0; i < count; i++) {
+        fence.vertices.push_back(eastings[i]);
+        fence.vertices.push_back(northings[i]);
+        fence.minEasting = std::min(fence.minEasting, eastings[i]);
+        fence.maxEasting = std::max(fence.maxEasting, eastings[i]);
+        fence.minNorthing = std::min(fence.minNorthing, northings[i]);
+        fence.maxNorthing = std::max(fence.maxNorthing, northings[i]);
+    }
+    index(slot, true);
+    return true;
+}
+
+bool GeofenceEngine::remove(std::uint32_t id) {
+    auto found = m_ids.find(id);
+    if (found == m_ids.end()) {
+        return false;
+    }
+    const std::uint32_t slot = found->second;
+    index(slot, false);
+    m_inside.erase(std::remove(m_inside.begin(), m_inside.end(), slot), m_inside.end());
+    m_fences[slot].active = false;
+    m_fences[slot].vertices = std::vector<double>();
+    m_freeSlots.push_back(slot);
+    m_ids.erase(found);
+    return true;
+}
+
+void GeofenceEngine::removeAll() {
+    m_fences.clear();
+    m_freeSlots.clear();
+    m_ids.clear();
+    m_cells.clear();
+    m_inside.clear();
+}
+
+bool GeofenceEngine::isInside(std::uint32_t id) const {
+    auto found = m_ids.find(id);
+    return found != m_ids.end() && m_fences[found->second].inside;
+}
+
+double GeofenceEngine::signedDistance(std::uint32_t id, double easting, double northing) const {
+    auto found = m_ids.find(id);
+    return found == m_ids.end() ? std::numeric_limits<double>::quiet_NaN() : signedDistance(m_fences[found->second], easting, northing);
+}
+
+double GeofenceEngine::signedDistance(const Fence &fence, double easting, double northing) const {
+    if (fence.isCircle) {
+        return fence.radius - std::hypot(easting - fence.centreEasting, northing - fence.centreNorthing);
+    }
+    // Crossing number for the side, nearest edge for the distance
+    const double *v = fence.vertices.data();
+    const std::size_t count = fence.vertices.size() / 2;
+    bool inside = false;
+    double nearest = std::numeric_limits<double>::max();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        const double xi = v[2 * i], yi = v[2 * i + 1], xj = v[2 * j], yj = v[2 * j + 1];
+        if ((yi > northing) != (yj > northing) && easting < (xj - xi) * (northing - yi) / (yj - yi) + xi) {
+            inside = !inside;
+        }
+        nearest = std::min(nearest, segmentDistanceSquared(easting, northing, xi, yi, xj, yj));
+    }
+    nearest = std::sqrt(nearest);
+    return inside ? nearest : -nearest;
+}
+
+void GeofenceEngine::test(std::uint32_t slot, double timestamp, double easting, double northing, std::vector<GeofenceEvent> &events) {
+    Fence &fence = m_fences[slot];
+    if (fence.visited == m_generation) {
+        return;
+    }
+    fence.visited = m_generation;
+    m_lastCandidateCount++;
+
+    // Quick rejection for fences the position is well clear of
+    if (!fence.inside && (easting < fence.minEasting || easting > fence.maxEasting || northing < fence.minNorthing || northing > fence.maxNorthing)) {
+        return;
+    }
+    const double distance = signedDistance(fence, easting, northing);
+    if (!fence.inside) {
+        if (distance >= m_options.enterMargin) {
+            fence.inside = true;
+            fence.enteredAt = timestamp;
+            fence.dwellReported = false;
+            events.push_back(GeofenceEvent{fence.id, GeofenceTransition::Enter, timestamp});
+            m_stillInside.push_back(slot);
+        }
+        return;
+    }
+    if (distance < -m_options.exitMargin) {
+        fence.inside = false;
+        events.push_back(GeofenceEvent{fence.id, GeofenceTransition::Exit, timestamp});
+        return;
+    }
+    if (!fence.dwellReported && timestamp - fence.enteredAt >= m_options.dwellTime) {
+        fence.dwellReported = true;
+        events.push_back(GeofenceEvent{fence.id, GeofenceTransition::Dwell, timestamp});
+    }
+    m_stillInside.push_back(slot);
+}
+
+void GeofenceEngine::update(double timestamp, double easting, double northing, std::vector<GeofenceEvent> &events) {
+    if (!std::isfinite(easting) || !std::isfinite(northing)) {
+        return;
+    }
+    m_generation++;
+    m_lastCandidateCount = 0;
+    m_stillInside.clear();
+
+    // Occupied fences first, so exits come before entries into neighbours
+    for (std::uint32_t slot : m_inside) {
+        test(slot, timestamp, easting, northing, events);
+    }
+    auto cell = m_cells.find(cellKey(easting, northing));
+    if (cell != m_cells.end()) {
+        for (std::uint32_t slot : cell->second) {
+            test(slot, timestamp, easting, northing, events);
+        }
+    }
+    m_inside.swap(m_stillInside);
+}
+
+void GeofenceEngine::resetOccupancy() {
+    for (std::uint32_t slot : m_inside) {
+        m_fences[slot].inside = false;
+    }
+    m_inside.clear();
+}
+
+void GeofenceStage::process(FixBuffer &fixes) {
+    for (const Fix &fix : fixes) {
+        if (!hasValidCoordinate(fix)) {
+            continue;
+        }
+        if (hasGridPosition(fix)) {
+            m_engine.update(fix.timestamp, fix.easting, fix.northing, m_events);
+        } else {
+            const GridPosition position = approximateNationalGrid(fix.latitude, fix.longitude, fix.altitude);
+            m_engine.update(fix.timestamp, position.easting, position.northing, m_events);
+        }
+    }
+}
+
+void GeofenceStage::reset() {
+    m_engine.resetOccupancy();
+    m_events.clear();
+}
+
+} // namespace oslocation
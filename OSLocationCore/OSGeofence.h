@@ -0,0 +1,169 @@
+//
+//  OSGeofence.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSPipeline.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace oslocation {
+
+enum class GeofenceTransition {
+    Enter,
+    Exit,
+    /**
+     *  Sent once when a fence has been occupied for the dwell time
+     */
+    Dwell,
+};
+
+struct GeofenceEvent {
+    std::uint32_t fenceId;
+    GeofenceTransition transition;
+    double timestamp;
+};
+
+struct GeofenceOptions {
+    /**
+     *  Side of the square cells of the index in metres, aligned to the
+     *  National Grid
+     */
+    double cellSize = 1000;
+    /**
+     *  How far inside a fence, in metres, a position must be to enter it
+     */
+    double enterMargin = 0;
+    /**
+     *  How far outside a fence, in metres, a position must be to leave it.
+     *  Together with `enterMargin` this keeps jitter along a boundary from
+     *  producing a stream of transitions.
+     */
+    double exitMargin = 10;
+    /**
+     *  Seconds inside a fence before a dwell event
+     */
+    double dwellTime = 120;
+};
+
+/**
+ *  Circle and polygon fences in National Grid metres, indexed by the grid
+ *  cells their bounding boxes cover. Each position is tested only against
+ *  the fences registered in its cell and the fences it is currently inside.
+ *
+ *  Polygons are simple rings without holes, given in either winding order.
+ */
+class GeofenceEngine {
+public:
+    explicit GeofenceEngine(const GeofenceOptions &options = GeofenceOptions());
+
+    /**
+     *  @return false if the id is already in use or the radius is not
+     *  positive
+     */
+    bool addCircle(std::uint32_t id, double easting, double northing, double radius);
+
+    /**
+     *  @return false if the id is already in use or there are fewer than
+     *  three vertices
+     */
+    bool addPolygon(std::uint32_t id, const double *eastings, const double *northings, std::size_t count);
+
+    /**
+     *  Removes a fence without an exit event
+     */
+    bool remove(std::uint32_t id);
+    void removeAll();
+
+    std::size_t fenceCount() const { return m_ids.size(); }
+    bool isInside(std::uint32_t id) const;
+
+    /**
+     *  Moves to a new position, appending any transitions to `events`
+     */
+    void update(double timestamp, double easting, double northing, std::vector<GeofenceEvent> &events);
+
+    /**
+     *  Forgets which fences are occupied, without exit events
+     */
+    void resetOccupancy();
+
+    /**
+     *  Fences tested by the last update, for measuring the index
+     */
+    std::size_t lastCandidateCount() const { return m_lastCandidateCount; }
+
+    /**
+     *  Distance in metres from the position to the fence boundary, positive
+     *  inside and negative outside
+     */
+    double signedDistance(std::uint32_t id, double easting, double northing) const;
+
+private:
+    struct Fence {
+        std::uint32_t id;
+        bool active;
+        bool isCircle;
+        double centreEasting, centreNorthing, radius;
+        std::vector<double> vertices;  // easting, northing pairs
+        double minEasting, minNorthing, maxEasting, maxNorthing;
+        bool inside;
+        bool dwellReported;
+        double enteredAt;
+        std::uint64_t visited;
+    };
+
+    std::uint32_t allocate(std::uint32_t id);
+    void index(std::uint32_t slot, bool insert);
+    double signedDistance(const Fence &fence, double easting, double northing) const;
+    void test(std::uint32_t slot, double timestamp, double easting, double northing, std::vector<GeofenceEvent> &events);
+    std::uint64_t cellKey(double easting, double northing) const;
+    std::int64_t cellIndex(double coordinate) const;
+
+    GeofenceOptions m_options;
+    std::vector<Fence> m_fences;
+    std::vector<std::uint32_t> m_freeSlots;
+    std::unordered_map<std::uint32_t, std::uint32_t> m_ids;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_cells;
+    std::vector<std::uint32_t> m_inside;
+    std::vector<std::uint32_t> m_stillInside;
+    std::uint64_t m_generation = 0;
+    std::size_t m_lastCandidateCount = 0;
+};
+
+/**
+ *  Feeds the fixes passing through the pipeline to a geofence engine and
+ *  collects the resulting events. Fixes are left untouched; positions come
+ *  from their grid coordinates when a `NationalGridStage` has run, and from
+ *  the approximate conversion otherwise.
+ *
+ *  The engine is owned by the caller so its fences outlive the pipeline
+ *  being rebuilt.
+ */
+class GeofenceStage : public Stage {
+public:
+    explicit GeofenceStage(GeofenceEngine &engine) : m_engine(engine) {}
+
+    void process(FixBuffer &fixes) override;
+    void reset() override;
+
+    GeofenceEngine &engine() { return m_engine; }
+
+    /**
+     *  Events collected since the last call, oldest first
+     */
+    std::vector<GeofenceEvent> &events() { return m_events; }
+
+private:
+    GeofenceEngine &m_engine;
+    std::vector<GeofenceEvent> m_events;
+};
+
+} // namespace oslocation
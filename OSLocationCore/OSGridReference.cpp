@@ -0,0 +1,204 @@
+//
+//  OSGridReference.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSGridReference.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace oslocation {
+
+namespace {
+
+constexpr int kSquaresEast = 7;
+constexpr int kSquaresNorth = 13;
+constexpr double kSquareSize = 100000;
+
+// The alphabet without I, laid out in 5 x 5 squares from A at the north west
+constexpr char kLetters[] = "ABCDEFGHJKLMNOPQRSTUVWXYZ";
+
+constexpr char squareLetter(int east, int north) {
+    return kLetters[(4 - north) * 5 + east];
+}
+
+/**
+ *  Letter pairs of every 100 km square, indexed by northing then easting.
+ *  The first letter is the 500 km square counted from the false origin at
+ *  S, the second the 100 km square within it.
+ */
+struct SquareTable {
+    char letters[kSquaresNorth][kSquaresEast][2];
+};
+
+constexpr SquareTable makeSquareTable() {
+    SquareTable table{};
+    for (int north = 0; north < kSquaresNorth; north++) {
+        for (int east = 0; east < kSquaresEast; east++) {
+            // S sits two 500 km squares east and one north of V
+            table.letters[north][east][0] = squareLetter(east / 5 + 2, north / 5 + 1);
+            table.letters[north][east][1] = squareLetter(east % 5, north % 5);
+        }
+    }
+    return table;
+}
+
+constexpr SquareTable kSquares = makeSquareTable();
+
+/**
+ *  Position of each letter in its 5 x 5 square as east + 5 * north, or -1
+ *  for characters that are not square letters. Indexed by upper case ASCII
+ *  minus 'A'.
+ */
+struct LetterTable {
+    std::int8_t position[26];
+};
+
+constexpr LetterTable makeLetterTable() {
+    LetterTable table{};
+    for (int i = 0; i < 26; i++) {
+        table.position[i] = -1;
+    }
+    for (int i = 0; i < 25; i++) {
+        table.position[kLetters[i] - 'A'] = static_cast<std::int8_t>((i % 5) + 5 * (4 - i / 5));
+    }
+    return table;
+}
+
+constexpr LetterTable kLetterPositions = makeLetterTable();
+
+constexpr std::uint32_t kPowersOfTen[] = {1, 10, 100, 1000, 10000, 100000};
+
+inline void writeDigits(std::uint32_t value, int count, char *out) {
+    for (int i = count - 1; i >= 0; i--) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+inline int letterPosition(char c) {
+    if (c >= 'a' && c <= 'z') {
+        c = static_cast<char>(c - 'a' + 'A');
+    }
+    if (c < 'A' || c > 'Z') {
+        return -1;
+    }
+    return kLetterPositions.position[c - 'A'];
+}
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+} // namespace
+
+std::size_t formatGridReference(double easting, double northing, int figures, char *buffer, std::size_t capacity, GridReferenceStyle style) {
+    if (figures < 0 || figures > 10 || figures % 2 != 0) {
+        return 0;
+    }
+    if (!(easting >= 0 && easting < kSquaresEast * kSquareSize && northing >= 0 && northing < kSquaresNorth * kSquareSize)) {
+        return 0;
+    }
+    const std::size_t length = 2 + static_cast<std::size_t>(figures) + (style == GridReferenceStyle::Spaced && figures > 0 ? 2 : 0);
+    if (capacity < length + 1) {
+        return 0;
+    }
+
+    const auto e = static_cast<std::uint32_t>(easting);
+    const auto n = static_cast<std::uint32_t>(northing);
+    const char *letters = kSquares.letters[n / 100000][e / 100000];
+    char *out = buffer;
+    *out++ = letters[0];
+    *out++ = letters[1];
+    if (figures > 0) {
+        const int digits = figures / 2;
+        const std::uint32_t divisor = kPowersOfTen[5 - digits];
+        if (style == GridReferenceStyle::Spaced) {
+            *out++ = ' ';
+        }
+        writeDigits((e % 100000) / divisor, digits, out);
+        out += digits;
+        if (style == GridReferenceStyle::Spaced) {
+            *out++ = ' ';
+        }
+        writeDigits((n % 100000) / divisor, digits, out);
+        out += digits;
+    }
+    *out = '\0';
+    return length;
+}
+
+bool parseGridReference(std::string_view reference, double &easting, double &northing, int *figures) {
+    const char *p = reference.data();
+    const char *end = p + reference.size();
+    while (p < end && isSpace(*p)) {
+        p++;
+    }
+    if (end - p < 2) {
+        return false;
+    }
+    const int first = letterPosition(p[0]);
+    const int second = letterPosition(p[1]);
+    if (first < 0 || second < 0) {
+        return false;
+    }
+    p += 2;
+
+    // Undo the offset of S from V, then combine the two squares
+    const int squareEast = (first % 5 - 2) * 5 + second % 5;
+    const int squareNorth = (first / 5 - 1) * 5 + second / 5;
+    if (squareEast < 0 || squareEast >= kSquaresEast || squareNorth < 0 || squareNorth >= kSquaresNorth) {
+        return false;
+    }
+
+    // Collect up to ten digits, in one run or two runs of equal length
+    char digits[10];
+    int count = 0;
+    int groups = 0;
+    int firstGroup = 0;
+    while (p < end) {
+        if (isSpace(*p)) {
+            p++;
+            continue;
+        }
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+        if (groups == 2) {
+            return false;
+        }
+        groups++;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (count == 10) {
+                return false;
+            }
+            digits[count++] = *p++;
+        }
+        if (groups == 1) {
+            firstGroup = count;
+        }
+    }
+    if (count % 2 != 0 || (groups == 2 && firstGroup * 2 != count)) {
+        return false;
+    }
+
+    const int half = count / 2;
+    std::uint32_t e = 0, n = 0;
+    for (int i = 0; i < half; i++) {
+        e = e * 10 + static_cast<std::uint32_t>(digits[i] - '0');
+        n = n * 10 + static_cast<std::uint32_t>(digits[half + i] - '0');
+    }
+    const std::uint32_t scale = kPowersOfTen[5 - half];
+    easting = squareEast * kSquareSize + static_cast<double>(e * scale);
+    northing = squareNorth * kSquareSize + static_cast<double>(n * scale);
+    if (figures) {
+        *figures = count;
+    }
+    return true;
+}
+
+} // namespace oslocation
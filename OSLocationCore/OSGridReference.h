@@ -0,0 +1,68 @@
+//
+//  OSGridReference.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace oslocation {
+
+enum class GridReferenceStyle {
+    /**
+     *  "SU 42004 14000"
+     */
+    Spaced,
+    /**
+     *  "SU4200414000"
+     */
+    Compact,
+};
+
+/**
+ *  Longest reference `formatGridReference` writes, including the
+ *  terminating NUL
+ */
+constexpr std::size_t kGridReferenceMaxLength = 15;
+
+/**
+ *  Formats a National Grid position as a grid reference with the 100 km
+ *  square letters and `figures` digits in total (0, 2, 4, 6, 8 or 10).
+ *  Coordinates are truncated, so the reference names the square containing
+ *  the position. Does not allocate.
+ *
+ *  @return the length written excluding the terminating NUL, or 0 if the
+ *  position is outside the grid, `figures` is invalid or the buffer is too
+ *  small
+ */
+std::size_t formatGridReference(double easting, double northing, int figures, char *buffer, std::size_t capacity, GridReferenceStyle style = GridReferenceStyle::Spaced);
+
+/**
+ *  Parses a grid reference in either style, with letters in either case and
+ *  any whitespace between the letters and the digit groups. The easting and
+ *  northing digits may be separated or run together.
+ *
+ *  @param easting   set to the south west corner of the referenced square
+ *  @param northing  set to the south west corner of the referenced square
+ *  @param figures   if not null, set to the number of digits parsed
+ *
+ *  @return false if the reference is malformed or outside the grid
+ */
+bool parseGridReference(std::string_view reference, double &easting, double &northing, int *figures = nullptr);
+
+/**
+ *  Size in metres of the square a reference with `figures` digits names
+ */
+constexpr double gridReferenceResolution(int figures) {
+    double resolution = 100000;
+    for (int i = 0; i < figures; i += 2) {
+        resolution /= 10;
+    }
+    return resolution;
+}
+
+} // namespace oslocation
@@ -0,0 +1,62 @@
+//
+//  OSHeadingFilter.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSHeadingFilter.h"
+#include "OSEllipsoid.h"
+
+#include <cmath>
+
+namespace oslocation {
+
+bool HeadingFilter::update(const Heading &heading, Heading &smoothed) {
+    if (!hasValidHeading(heading)) {
+        return false;
+    }
+    const double radians = heading.magneticHeading * kDegreesToRadians;
+    const double east = std::sin(radians), north = std::cos(radians);
+    const double elapsed = heading.timestamp - m_lastTimestamp;
+    if (!m_hasState || m_options.timeConstant <= 0 || elapsed > 10 * m_options.timeConstant) {
+        m_east = east;
+        m_north = north;
+        m_hasState = true;
+    } else if (elapsed > 0) {
+        const double alpha = 1 - std::exp(-elapsed / m_options.timeConstant);
+        m_east += alpha * (east - m_east);
+        m_north += alpha * (north - m_north);
+    }
+    m_lastTimestamp = heading.timestamp;
+
+    // Opposite readings can cancel out; keep the last direction until they
+    // no longer do
+    double direction = m_east * m_east + m_north * m_north > 1e-12 ? std::atan2(m_east, m_north) / kDegreesToRadians : m_current.magneticHeading;
+    if (direction < 0) {
+        direction += 360;
+    }
+    m_current = heading;
+    m_current.magneticHeading = direction;
+    if (hasValidTrueHeading(heading)) {
+        m_current.trueHeading = std::fmod(direction + heading.trueHeading - heading.magneticHeading + 360, 360);
+    }
+    if (hasValidGridHeading(heading)) {
+        m_current.gridHeading = std::fmod(direction + heading.gridHeading - heading.magneticHeading + 360, 360);
+    }
+
+    if (m_hasReturned && angularDifference(direction, m_returnedDirection) < m_options.deadBand) {
+        return false;
+    }
+    m_hasReturned = true;
+    m_returnedDirection = direction;
+    smoothed = m_current;
+    return true;
+}
+
+void HeadingFilter::reset() {
+    m_hasState = false;
+    m_hasReturned = false;
+}
+
+} // namespace oslocation
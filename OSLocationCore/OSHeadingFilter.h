@@ -0,0 +1,80 @@
+//
+//  OSHeadingFilter.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSCompass.h"
+
+namespace oslocation {
+
+struct HeadingFilterOptions {
+    /**
+     *  Seconds for the filtered heading to cover 63% of a step change.
+     *  0 passes headings through unsmoothed.
+     */
+    double timeConstant = 0.25;
+    /**
+     *  Filtered headings within this many degrees of the last one returned
+     *  are suppressed
+     */
+    double deadBand = 1;
+};
+
+/**
+ *  Exponential low-pass filter for compass headings. Headings are averaged
+ *  as unit vectors, so readings either side of north average to north
+ *  rather than south. The smoothing factor follows the time between
+ *  readings, so irregular update rates smooth consistently.
+ *
+ *  The magnetic heading is filtered; valid true and grid headings keep their
+ *  offsets from the magnetic one in each reading. Readings with a negative
+ *  `headingAccuracy` are ignored. Never allocates.
+ */
+class HeadingFilter {
+public:
+    explicit HeadingFilter(HeadingFilterOptions options = HeadingFilterOptions()) : m_options(options) {}
+
+    const HeadingFilterOptions &options() const { return m_options; }
+
+    /**
+     *  Adds a reading
+     *
+     *  @param smoothed receives the filtered heading when returning true
+     *
+     *  @return false if the reading was invalid or the filtered heading is
+     *  inside the dead-band
+     */
+    bool update(const Heading &heading, Heading &smoothed);
+
+    /**
+     *  Call when the reference the headings are measured against changes,
+     *  such as the device orientation. Readings jump by the rotation
+     *  between the references, so the next one restarts the filter instead
+     *  of being swept towards through the time constant.
+     */
+    void reorient() { m_hasState = false; }
+
+    void reset();
+
+    /**
+     *  Latest filtered heading, including one suppressed by the dead-band
+     */
+    bool hasHeading() const { return m_hasState; }
+    const Heading &current() const { return m_current; }
+
+private:
+    HeadingFilterOptions m_options;
+    bool m_hasState = false;
+    double m_east = 0;
+    double m_north = 0;
+    double m_lastTimestamp = 0;
+    Heading m_current{};
+    bool m_hasReturned = false;
+    double m_returnedDirection = 0;
+};
+
+} // namespace oslocation
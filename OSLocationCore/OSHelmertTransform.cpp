@@ -0,0 +1,86 @@
+//
+//  OSHelmertTransform.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSHelmertTransform.h"
+#include "OSTransverseMercator.h"
+
+#include <cmath>
+
+namespace oslocation {
+
+namespace {
+
+constexpr double kArcSecondsToRadians = kDegreesToRadians / 3600;
+constexpr TransverseMercator kOSGB36Grid = nationalGridProjection(kAiry1830);
+
+} // namespace
+
+CartesianPosition toCartesian(const Ellipsoid &ellipsoid, double latitude, double longitude, double height) {
+    const double phi = latitude * kDegreesToRadians;
+    const double lambda = longitude * kDegreesToRadians;
+    const double e2 = ellipsoid.eccentricitySquared();
+    const double sinPhi = std::sin(phi);
+    const double cosPhi = std::cos(phi);
+    const double nu = ellipsoid.semiMajorAxis / std::sqrt(1 - e2 * sinPhi * sinPhi);
+    return CartesianPosition{
+        (nu + height) * cosPhi * std::cos(lambda),
+        (nu + height) * cosPhi * std::sin(lambda),
+        ((1 - e2) * nu + height) * sinPhi};
+}
+
+void fromCartesian(const Ellipsoid &ellipsoid, const CartesianPosition &position, double &latitude, double &longitude, double &height) {
+    // Bowring's closed form, good to well under a millimetre for points
+    // near the surface and much cheaper than iterating
+    const double a = ellipsoid.semiMajorAxis;
+    const double b = ellipsoid.semiMinorAxis;
+    const double e2 = ellipsoid.eccentricitySquared();
+    const double secondEccentricitySquared = (a * a - b * b) / (b * b);
+    const double p = std::sqrt(position.x * position.x + position.y * position.y);
+    const double beta = std::atan2(a * position.z, b * p);
+    const double sinBeta = std::sin(beta);
+    const double cosBeta = std::cos(beta);
+    const double phi = std::atan2(position.z + secondEccentricitySquared * b * sinBeta * sinBeta * sinBeta, p - e2 * a * cosBeta * cosBeta * cosBeta);
+    const double sinPhi = std::sin(phi);
+    const double nu = a / std::sqrt(1 - e2 * sinPhi * sinPhi);
+    latitude = phi * kRadiansToDegrees;
+    longitude = std::atan2(position.y, position.x) * kRadiansToDegrees;
+    height = p * std::cos(phi) + position.z * sinPhi - a * a / nu;
+}
+
+CartesianPosition applyHelmert(const HelmertParameters &parameters, const CartesianPosition &position) {
+    const double s = 1 + parameters.scale * 1e-6;
+    const double rx = parameters.rx * kArcSecondsToRadians;
+    const double ry = parameters.ry * kArcSecondsToRadians;
+    const double rz = parameters.rz * kArcSecondsToRadians;
+    return CartesianPosition{
+        parameters.tx + s * (position.x - rz * position.y + ry * position.z),
+        parameters.ty + s * (rz * position.x + position.y - rx * position.z),
+        parameters.tz + s * (-ry * position.x + rx * position.y + position.z)};
+}
+
+GridPosition approximateNationalGrid(double latitude, double longitude, double height) {
+    const CartesianPosition osgb36 = applyHelmert(kWGS84ToOSGB36, toCartesian(kGRS80, latitude, longitude, height));
+    double osgbLatitude, osgbLongitude, osgbHeight;
+    fromCartesian(kAiry1830, osgb36, osgbLatitude, osgbLongitude, osgbHeight);
+    GridPosition position;
+    projectTransverseMercator(kOSGB36Grid, osgbLatitude, osgbLongitude, position.easting, position.northing);
+    position.height = osgbHeight;
+    return position;
+}
+
+void approximateNationalGrid(const double *latitudes, const double *longitudes, const double *heights, std::size_t count, double *eastings, double *northings, simd::Level level) {
+    // Datum shift point by point into the output arrays, then project them
+    // in place with the batch kernel
+    for (std::size_t i = 0; i < count; i++) {
+        const CartesianPosition osgb36 = applyHelmert(kWGS84ToOSGB36, toCartesian(kGRS80, latitudes[i], longitudes[i], heights ? heights[i] : 0));
+        double height;
+        fromCartesian(kAiry1830, osgb36, northings[i], eastings[i], height);
+    }
+    projectTransverseMercator(kOSGB36Grid, northings, eastings, count, eastings, northings, level);
+}
+
+} // namespace oslocation
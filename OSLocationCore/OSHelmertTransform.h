@@ -0,0 +1,63 @@
+//
+//  OSHelmertTransform.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSEllipsoid.h"
+#include "OSNationalGrid.h"
+#include "OSSIMD.h"
+
+#include <cstddef>
+
+namespace oslocation {
+
+struct CartesianPosition {
+    double x;
+    double y;
+    double z;
+};
+
+/**
+ *  Seven parameter similarity transform between cartesian frames.
+ *  Translations in metres, scale in parts per million, rotations in arc
+ *  seconds.
+ */
+struct HelmertParameters {
+    double tx, ty, tz;
+    double scale;
+    double rx, ry, rz;
+};
+
+/**
+ *  WGS84 (ETRS89) to OSGB36 parameters from "A guide to coordinate systems in
+ *  Great Britain", section 6.6. Good to a few metres across Great Britain.
+ */
+constexpr HelmertParameters kWGS84ToOSGB36 = {-446.448, 125.157, -542.060, 20.4894, -0.1502, -0.2470, -0.8421};
+
+CartesianPosition toCartesian(const Ellipsoid &ellipsoid, double latitude, double longitude, double height);
+
+/**
+ *  Inverse of `toCartesian`, using Bowring's formula
+ */
+void fromCartesian(const Ellipsoid &ellipsoid, const CartesianPosition &position, double &latitude, double &longitude, double &height);
+
+CartesianPosition applyHelmert(const HelmertParameters &parameters, const CartesianPosition &position);
+
+/**
+ *  Fast National Grid conversion for live display: Helmert to OSGB36 and
+ *  Transverse Mercator on Airy 1830, with no grid lookups. Within about 5 m
+ *  of OSTN15. The height is the OSGB36 ellipsoidal height, which is only a
+ *  rough stand-in for the orthometric height.
+ */
+GridPosition approximateNationalGrid(double latitude, double longitude, double height);
+
+/**
+ *  Batch form of `approximateNationalGrid`. `heights` may be null.
+ */
+void approximateNationalGrid(const double *latitudes, const double *longitudes, const double *heights, std::size_t count, double *eastings, double *northings, simd::Level level = simd::bestLevel());
+
+} // namespace oslocation
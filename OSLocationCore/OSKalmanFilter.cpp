@@ -0,0 +1,106 @@
+//
+//  OSKalmanFilter.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSKalmanFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oslocation {
+
+namespace {
+
+// Moving the frame origin keeps the flat earth distortion negligible on
+// long journeys
+constexpr double kReanchorDistance = 10000;
+
+} // namespace
+
+void KalmanFilter::process(FixBuffer &fixes) {
+    for (Fix &fix : fixes) {
+        update(fix);
+    }
+}
+
+void KalmanFilter::start(const Fix &fix, double east, double north, double variance) {
+    m_initialised = true;
+    m_timestamp = fix.timestamp;
+    m_east = east;
+    m_north = north;
+    m_velocityEast = 0;
+    m_velocityNorth = 0;
+    if (hasValidSpeed(fix) && hasValidCourse(fix)) {
+        const double course = fix.course * kDegreesToRadians;
+        m_velocityEast = fix.speed * std::sin(course);
+        m_velocityNorth = fix.speed * std::cos(course);
+    }
+    m_positionVariance = variance;
+    m_covariance = 0;
+    m_velocityVariance = m_options.initialSpeedUncertainty * m_options.initialSpeedUncertainty;
+}
+
+void KalmanFilter::update(Fix &fix) {
+    if (!hasValidCoordinate(fix)) {
+        return;
+    }
+    const double accuracy = std::max(fix.horizontalAccuracy, m_options.minimumAccuracy);
+    const double measurementVariance = accuracy * accuracy;
+
+    const double dt = fix.timestamp - m_timestamp;
+    if (!m_initialised || dt < 0 || dt > m_options.maximumGap) {
+        m_frame.setOrigin(fix.latitude, fix.longitude);
+        start(fix, 0, 0, measurementVariance);
+        return;
+    }
+
+    double east, north;
+    m_frame.toLocal(fix.latitude, fix.longitude, east, north);
+    if (std::fabs(east) > kReanchorDistance || std::fabs(north) > kReanchorDistance) {
+        double latitude, longitude;
+        m_frame.toGeodetic(m_east, m_north, latitude, longitude);
+        m_frame.setOrigin(latitude, longitude);
+        m_east = 0;
+        m_north = 0;
+        m_frame.toLocal(fix.latitude, fix.longitude, east, north);
+    }
+
+    // Predict
+    if (dt > 0) {
+        const double q = m_options.accelerationNoise;
+        m_east += m_velocityEast * dt;
+        m_north += m_velocityNorth * dt;
+        m_positionVariance += dt * (2 * m_covariance + dt * m_velocityVariance) + q * dt * dt * dt / 3;
+        m_covariance += dt * m_velocityVariance + q * dt * dt / 2;
+        m_velocityVariance += q * dt;
+    }
+
+    // Update with the measured position
+    const double innovationVariance = m_positionVariance + measurementVariance;
+    const double positionGain = m_positionVariance / innovationVariance;
+    const double velocityGain = m_covariance / innovationVariance;
+    const double innovationEast = east - m_east;
+    const double innovationNorth = north - m_north;
+    m_east += positionGain * innovationEast;
+    m_north += positionGain * innovationNorth;
+    m_velocityEast += velocityGain * innovationEast;
+    m_velocityNorth += velocityGain * innovationNorth;
+    m_velocityVariance -= velocityGain * m_covariance;
+    m_positionVariance *= 1 - positionGain;
+    m_covariance *= 1 - positionGain;
+    m_timestamp = fix.timestamp;
+
+    m_frame.toGeodetic(m_east, m_north, fix.latitude, fix.longitude);
+    fix.horizontalAccuracy = std::sqrt(m_positionVariance);
+    if (!hasValidSpeed(fix) || !hasValidCourse(fix)) {
+        fix.speed = std::hypot(m_velocityEast, m_velocityNorth);
+        double course = std::atan2(m_velocityEast, m_velocityNorth) * kRadiansToDegrees;
+        fix.course = course < 0 ? course + 360 : course;
+    }
+    fix.flags |= FixFlagModified;
+}
+
+} // namespace oslocation
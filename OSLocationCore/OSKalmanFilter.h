@@ -0,0 +1,79 @@
+//
+//  OSKalmanFilter.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSLocalFrame.h"
+#include "OSPipeline.h"
+
+namespace oslocation {
+
+struct KalmanFilterOptions {
+    /**
+     *  Spectral density of the white noise acceleration driving the
+     *  constant velocity model, in m²/s³. Larger values follow turns more
+     *  closely and smooth less.
+     */
+    double accelerationNoise = 0.5;
+    /**
+     *  Gap in seconds after which the filter restarts from the next fix
+     *  instead of predicting across it
+     */
+    double maximumGap = 30;
+    /**
+     *  Floor on the horizontal accuracy used to weight a fix, in metres
+     */
+    double minimumAccuracy = 1;
+    /**
+     *  Standard deviation of the velocity when the filter starts, in metres
+     *  per second
+     */
+    double initialSpeedUncertainty = 5;
+};
+
+/**
+ *  Smooths positions with a constant velocity Kalman filter in a local east
+ *  north frame, weighting each fix by its `horizontalAccuracy`.
+ *
+ *  The state is position and velocity on each axis. The motion model and
+ *  the isotropic measurement noise treat both axes alike, so both share one
+ *  2 x 2 covariance; this is exact rather than an approximation and keeps
+ *  an update to a handful of multiplies.
+ *
+ *  Filtered fixes get the smoothed coordinate, the filter's position
+ *  uncertainty as `horizontalAccuracy` and, when they carry none, speed and
+ *  course from the velocity estimate. Fixes without a valid coordinate pass
+ *  through untouched.
+ */
+class KalmanFilter : public Stage {
+public:
+    explicit KalmanFilter(const KalmanFilterOptions &options = KalmanFilterOptions()) : m_options(options) {}
+
+    void process(FixBuffer &fixes) override;
+    void reset() override { m_initialised = false; }
+
+    /**
+     *  Filters a single fix in place
+     */
+    void update(Fix &fix);
+
+    const KalmanFilterOptions &options() const { return m_options; }
+
+private:
+    void start(const Fix &fix, double east, double north, double variance);
+
+    KalmanFilterOptions m_options;
+    LocalFrame m_frame;
+    bool m_initialised = false;
+    double m_timestamp = 0;
+    // Position and velocity, east and north
+    double m_east = 0, m_north = 0, m_velocityEast = 0, m_velocityNorth = 0;
+    // Shared per axis covariance: position, position-velocity, velocity
+    double m_positionVariance = 0, m_covariance = 0, m_velocityVariance = 0;
+};
+
+} // namespace oslocation
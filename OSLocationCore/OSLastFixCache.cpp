@@ -0,0 +1,111 @@
+//
+//  OSLastFixCache.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSLastFixCache.h"
+#include "OSTrackJournal.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace oslocation {
+
+namespace {
+
+constexpr char kMagic[8] = {'O', 'S', 'L', 'F', 'I', 'X', '\0', '\0'};
+
+struct CacheFile {
+    char magic[8];
+    JournalRecord record;
+};
+static_assert(sizeof(CacheFile) == 56, "CacheFile is written to disk as is");
+
+} // namespace
+
+LastFixCache::~LastFixCache() {
+    flush();
+}
+
+bool LastFixCache::open(const std::string &path) {
+    flush();
+    m_path = path;
+    m_hasFix = false;
+    m_unwritten = false;
+    m_lastWrite = -std::numeric_limits<double>::infinity();
+
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    CacheFile contents;
+    const bool read = std::fread(&contents, sizeof(contents), 1, file) == 1;
+    std::fclose(file);
+    if (!read || std::memcmp(contents.magic, kMagic, sizeof(kMagic)) != 0 || !journal::decode(contents.record, m_fix)) {
+        return false;
+    }
+    m_hasFix = true;
+    m_lastWrite = m_fix.timestamp;
+    return true;
+}
+
+bool LastFixCache::provisionalFix(double now, Fix &fix) const {
+    if (!m_hasFix) {
+        return false;
+    }
+    // A clock set back since the fix makes it no older
+    const double age = std::max(now - m_fix.timestamp, 0.0);
+    const double accuracy = m_fix.horizontalAccuracy + age * m_options.driftSpeed;
+    if (age > m_options.maximumAge || accuracy > m_options.maximumAccuracy) {
+        return false;
+    }
+    fix = m_fix;
+    fix.horizontalAccuracy = accuracy;
+    fix.speed = -1;
+    fix.course = -1;
+    fix.flags = FixFlagProvisional;
+    fix.sourceIndex = -1;
+    return true;
+}
+
+void LastFixCache::update(const Fix &fix) {
+    if ((fix.flags & FixFlagProvisional) || !hasValidCoordinate(fix) || fix.horizontalAccuracy > m_options.maximumAccuracy) {
+        return;
+    }
+    m_fix = fix;
+    m_hasFix = true;
+    m_unwritten = true;
+    if (fix.timestamp - m_lastWrite >= m_options.storeInterval) {
+        flush();
+    }
+}
+
+bool LastFixCache::flush() {
+    if (!m_unwritten || m_path.empty()) {
+        return true;
+    }
+    CacheFile contents;
+    std::memcpy(contents.magic, kMagic, sizeof(kMagic));
+    contents.record = journal::encode(m_fix);
+
+    // Not flushed to storage: losing the cache to a power cut costs
+    // nothing but the warm start
+    const std::string temporary = m_path + ".tmp";
+    std::FILE *file = std::fopen(temporary.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    const bool written = std::fwrite(&contents, sizeof(contents), 1, file) == 1;
+    if (std::fclose(file) != 0 || !written || std::rename(temporary.c_str(), m_path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    m_unwritten = false;
+    m_lastWrite = m_fix.timestamp;
+    return true;
+}
+
+} // namespace oslocation
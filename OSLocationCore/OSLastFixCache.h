@@ -0,0 +1,98 @@
+//
+//  OSLastFixCache.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+
+#include <limits>
+#include <string>
+
+namespace oslocation {
+
+struct LastFixCacheOptions {
+    /**
+     *  Seconds after which a cached fix is too old to use
+     */
+    double maximumAge = 1800;
+    /**
+     *  Metres per second the accuracy of a cached fix is widened by for its
+     *  age, allowing for the user having walked on since it was taken
+     */
+    double driftSpeed = 1.5;
+    /**
+     *  Cached fixes whose widened accuracy is worse than this many metres
+     *  are not used, and live fixes worse than it are not cached
+     */
+    double maximumAccuracy = 2000;
+    /**
+     *  Seconds of fix time between writes of the cache while fixes arrive
+     */
+    double storeInterval = 10;
+};
+
+/**
+ *  Keeps the last live fix in a small file so a later session can show a
+ *  position before its first fix arrives.
+ *
+ *  The file holds the magic `OSLFIX\0\0` and one `JournalRecord`, so a
+ *  damaged file fails its checksum and is ignored. It is replaced by
+ *  renaming a new file over it, never rewritten in place.
+ */
+class LastFixCache {
+public:
+    explicit LastFixCache(const LastFixCacheOptions &options = LastFixCacheOptions()) : m_options(options) {}
+    ~LastFixCache();
+    LastFixCache(const LastFixCache &) = delete;
+    LastFixCache &operator=(const LastFixCache &) = delete;
+
+    const LastFixCacheOptions &options() const { return m_options; }
+
+    /**
+     *  Uses the cache file at the given path, writing any unwritten fix to
+     *  the previous one first
+     *
+     *  @return true if the file holds a fix
+     */
+    bool open(const std::string &path);
+
+    /**
+     *  The cached fix as a provisional fix at the given time: flagged
+     *  `FixFlagProvisional`, its accuracy widened for its age and its speed
+     *  and course cleared. The timestamp stays that of the cached fix.
+     *
+     *  @return false if there is no fix or it is too old or too inaccurate
+     */
+    bool provisionalFix(double now, Fix &fix) const;
+
+    /**
+     *  Remembers a live fix, writing it out if `storeInterval` has passed
+     *  since the last write. Provisional fixes and fixes without a usable
+     *  coordinate are ignored.
+     */
+    void update(const Fix &fix);
+
+    /**
+     *  Writes the latest fix if it has not been written
+     *
+     *  @return false if the write failed
+     */
+    bool flush();
+
+    bool hasFix() const { return m_hasFix; }
+    const Fix &fix() const { return m_fix; }
+
+private:
+    LastFixCacheOptions m_options;
+    std::string m_path;
+    Fix m_fix = {};
+    bool m_hasFix = false;
+    bool m_unwritten = false;
+    double m_lastWrite = -std::numeric_limits<double>::infinity();
+};
+
+} // namespace oslocation
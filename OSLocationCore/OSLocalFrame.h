@@ -0,0 +1,59 @@
+//
+//  OSLocalFrame.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSEllipsoid.h"
+
+#include <cmath>
+
+namespace oslocation {
+
+/**
+ *  Flat east/north frame in metres around an origin, using the WGS84 radii
+ *  of curvature at the origin. Cheap enough to use per fix; distortion stays
+ *  below 0.1% within about 20 km of the origin, and conversions in both
+ *  directions round trip exactly.
+ */
+class LocalFrame {
+public:
+    LocalFrame() = default;
+    LocalFrame(double latitude, double longitude) { setOrigin(latitude, longitude); }
+
+    void setOrigin(double latitude, double longitude) {
+        const double e2 = kWGS84.eccentricitySquared();
+        const double s = std::sin(latitude * kDegreesToRadians);
+        const double w = 1 - e2 * s * s;
+        const double nu = kWGS84.semiMajorAxis / std::sqrt(w);
+        const double rho = nu * (1 - e2) / w;
+        m_originLatitude = latitude;
+        m_originLongitude = longitude;
+        m_metresPerDegreeNorth = rho * kDegreesToRadians;
+        m_metresPerDegreeEast = nu * std::cos(latitude * kDegreesToRadians) * kDegreesToRadians;
+    }
+
+    double originLatitude() const { return m_originLatitude; }
+    double originLongitude() const { return m_originLongitude; }
+
+    void toLocal(double latitude, double longitude, double &east, double &north) const {
+        east = (longitude - m_originLongitude) * m_metresPerDegreeEast;
+        north = (latitude - m_originLatitude) * m_metresPerDegreeNorth;
+    }
+
+    void toGeodetic(double east, double north, double &latitude, double &longitude) const {
+        latitude = m_originLatitude + north / m_metresPerDegreeNorth;
+        longitude = m_originLongitude + east / m_metresPerDegreeEast;
+    }
+
+private:
+    double m_originLatitude = 0;
+    double m_originLongitude = 0;
+    double m_metresPerDegreeNorth = 1;
+    double m_metresPerDegreeEast = 1;
+};
+
+} // namespace oslocation
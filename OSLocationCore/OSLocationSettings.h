@@ -0,0 +1,50 @@
+//
+//  OSLocationSettings.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+
+namespace oslocation {
+
+/**
+ *  Platform neutral equivalents of the CoreLocation accuracy constants, most
+ *  demanding first
+ */
+enum class LocationAccuracy {
+    BestForNavigation,
+    Best,
+    NearestTenMetres,
+    HundredMetres,
+    Kilometre,
+};
+
+/**
+ *  What to ask the location manager for
+ */
+struct LocationSettings {
+    LocationAccuracy accuracy;
+    /**
+     *  Minimum distance in metres between updates, 0 for none
+     */
+    double distanceFilter;
+    bool headingUpdates;
+};
+
+inline bool isHighAccuracy(LocationAccuracy accuracy) {
+    return accuracy == LocationAccuracy::BestForNavigation || accuracy == LocationAccuracy::Best;
+}
+
+/**
+ *  Settings that satisfy both `a` and `b`: the better accuracy, the shorter
+ *  distance filter and heading updates if either wants them
+ */
+inline LocationSettings mergeSettings(const LocationSettings &a, const LocationSettings &b) {
+    return LocationSettings{std::min(a.accuracy, b.accuracy), std::min(a.distanceFilter, b.distanceFilter), a.headingUpdates || b.headingUpdates};
+}
+
+} // namespace oslocation
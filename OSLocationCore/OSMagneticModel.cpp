@@ -0,0 +1,261 @@
+//
+//  OSMagneticModel.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSMagneticModel.h"
+#include "OSEllipsoid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace oslocation {
+
+namespace {
+
+// WMM.COF for WMM-2025, released 17 December 2024
+const MagneticCoefficient kWMM2025Rows[] = {
+    {1, 0, -29351.8, 0.0, 12.0, 0.0},
+    {1, 1, -1410.8, 4545.4, 9.7, -21.5},
+    {2, 0, -2556.6, 0.0, -11.6, 0.0},
+    {2, 1, 2951.1, -3133.6, -5.2, -27.7},
+    {2, 2, 1649.3, -815.1, -8.0, -12.1},
+    {3, 0, 1361.0, 0.0, -1.3, 0.0},
+    {3, 1, -2404.1, -56.6, -4.2, 4.0},
+    {3, 2, 1243.8, 237.5, 0.4, -0.3},
+    {3, 3, 453.6, -549.5, -15.6, -4.1},
+    {4, 0, 895.0, 0.0, -1.6, 0.0},
+    {4, 1, 799.5, 278.6, -2.4, -1.1},
+    {4, 2, 55.7, -133.9, -6.0, 4.1},
+    {4, 3, -281.1, 212.0, 5.6, 1.6},
+    {4, 4, 12.1, -375.6, -7.0, -4.4},
+    {5, 0, -233.2, 0.0, 0.6, 0.0},
+    {5, 1, 368.9, 45.4, 1.4, -0.5},
+    {5, 2, 187.2, 220.2, 0.0, 2.2},
+    {5, 3, -138.7, -122.9, 0.6, 0.4},
+    {5, 4, -142.0, 43.0, 2.2, 1.7},
+    {5, 5, 20.9, 106.1, 0.9, 1.9},
+    {6, 0, 64.4, 0.0, -0.2, 0.0},
+    {6, 1, 63.8, -18.4, -0.4, 0.3},
+    {6, 2, 76.9, 16.8, 0.9, -1.6},
+    {6, 3, -115.7, 48.8, 1.2, -0.4},
+    {6, 4, -40.9, -59.8, -0.9, 0.9},
+    {6, 5, 14.9, 10.9, 0.3, 0.7},
+    {6, 6, -60.7, 72.7, 0.9, 0.9},
+    {7, 0, 79.5, 0.0, -0.0, 0.0},
+    {7, 1, -77.0, -48.9, -0.1, 0.6},
+    {7, 2, -8.8, -14.4, -0.1, 0.5},
+    {7, 3, 59.3, -1.0, 0.5, -0.8},
+    {7, 4, 15.8, 23.4, -0.1, 0.0},
+    {7, 5, 2.5, -7.4, -0.8, -1.0},
+    {7, 6, -11.1, -25.1, -0.8, 0.6},
+    {7, 7, 14.2, -2.3, 0.8, -0.2},
+    {8, 0, 23.2, 0.0, -0.1, 0.0},
+    {8, 1, 10.8, 7.1, 0.2, -0.2},
+    {8, 2, -17.5, -12.6, 0.0, 0.5},
+    {8, 3, 2.0, 11.4, 0.5, -0.4},
+    {8, 4, -21.7, -9.7, -0.1, 0.4},
+    {8, 5, 16.9, 12.7, 0.3, -0.5},
+    {8, 6, 15.0, 0.7, 0.2, -0.6},
+    {8, 7, -16.8, -5.2, -0.0, 0.3},
+    {8, 8, 0.9, 3.9, 0.2, 0.2},
+    {9, 0, 4.6, 0.0, -0.0, 0.0},
+    {9, 1, 7.8, -24.8, -0.1, -0.3},
+    {9, 2, 3.0, 12.2, 0.1, 0.3},
+    {9, 3, -0.2, 8.3, 0.3, -0.3},
+    {9, 4, -2.5, -3.3, -0.3, 0.3},
+    {9, 5, -13.1, -5.2, 0.0, 0.2},
+    {9, 6, 2.4, 7.2, 0.3, -0.1},
+    {9, 7, 8.6, -0.6, -0.1, -0.2},
+    {9, 8, -8.7, 0.8, 0.1, 0.4},
+    {9, 9, -12.9, 10.0, -0.1, 0.1},
+    {10, 0, -1.3, 0.0, 0.1, 0.0},
+    {10, 1, -6.4, 3.3, 0.0, 0.0},
+    {10, 2, 0.2, 0.0, 0.1, -0.0},
+    {10, 3, 2.0, 2.4, 0.1, -0.2},
+    {10, 4, -1.0, 5.3, -0.0, 0.1},
+    {10, 5, -0.6, -9.1, -0.3, -0.1},
+    {10, 6, -0.9, 0.4, 0.0, 0.1},
+    {10, 7, 1.5, -4.2, -0.1, 0.0},
+    {10, 8, 0.9, -3.8, -0.1, -0.1},
+    {10, 9, -2.7, 0.9, -0.0, 0.2},
+    {10, 10, -3.9, -9.1, -0.0, -0.0},
+    {11, 0, 2.9, 0.0, 0.0, 0.0},
+    {11, 1, -1.5, 0.0, -0.0, -0.0},
+    {11, 2, -2.5, 2.9, 0.0, 0.1},
+    {11, 3, 2.4, -0.6, 0.0, -0.0},
+    {11, 4, -0.6, 0.2, 0.0, 0.1},
+    {11, 5, -0.1, 0.5, -0.1, -0.0},
+    {11, 6, -0.6, -0.3, 0.0, -0.0},
+    {11, 7, -0.1, -1.2, -0.0, 0.1},
+    {11, 8, 1.1, -1.7, -0.1, -0.0},
+    {11, 9, -1.0, -2.9, -0.1, 0.0},
+    {11, 10, -0.2, -1.8, -0.1, 0.0},
+    {11, 11, 2.6, -2.3, -0.1, 0.0},
+    {12, 0, -2.0, 0.0, 0.0, 0.0},
+    {12, 1, -0.2, -1.3, 0.0, -0.0},
+    {12, 2, 0.3, 0.7, -0.0, 0.0},
+    {12, 3, 1.2, 1.0, -0.0, -0.1},
+    {12, 4, -1.3, -1.4, -0.0, 0.1},
+    {12, 5, 0.6, -0.0, -0.0, -0.0},
+    {12, 6, 0.6, 0.6, 0.1, -0.0},
+    {12, 7, 0.5, -0.1, -0.0, -0.0},
+    {12, 8, -0.1, 0.8, 0.0, 0.0},
+    {12, 9, -0.4, 0.1, 0.0, -0.0},
+    {12, 10, -0.2, -1.0, -0.1, -0.0},
+    {12, 11, -1.3, 0.1, -0.0, 0.0},
+    {12, 12, -0.7, 0.2, -0.1, -0.1},
+};
+
+/**
+ *  Radius of the reference sphere of the harmonic expansion in kilometres
+ */
+const double kMagneticReferenceRadius = 6371.2;
+
+/**
+ *  Days from 1 January 1970 to the start of a year in the proleptic
+ *  Gregorian calendar
+ */
+std::int64_t daysToYear(std::int64_t year) {
+    const std::int64_t y = year - 1;
+    return 365 * (year - 1970) + (y / 4 - y / 100 + y / 400) - (1969 / 4 - 1969 / 100 + 1969 / 400);
+}
+
+} // namespace
+
+const MagneticCoefficients kWMM2025 = {2025.0, kWMM2025Rows, sizeof(kWMM2025Rows) / sizeof(kWMM2025Rows[0])};
+
+MagneticModel::MagneticModel(double decimalYear, const MagneticCoefficients &coefficients) : m_decimalYear(decimalYear), m_degree(0) {
+    std::fill(&m_g[0][0], &m_g[0][0] + sizeof(m_g) / sizeof(double), 0.0);
+    std::fill(&m_h[0][0], &m_h[0][0] + sizeof(m_h) / sizeof(double), 0.0);
+    std::fill(&m_k[0][0], &m_k[0][0] + sizeof(m_k) / sizeof(double), 0.0);
+
+    const double years = decimalYear - coefficients.epoch;
+    for (std::size_t i = 0; i < coefficients.count; i++) {
+        const MagneticCoefficient &row = coefficients.rows[i];
+        if (row.n < 1 || row.n > kMaximumDegree || row.m < 0 || row.m > row.n) {
+            continue;
+        }
+        m_g[row.n][row.m] = row.g + years * row.gRate;
+        m_h[row.n][row.m] = row.h + years * row.hRate;
+        m_degree = std::max(m_degree, row.n);
+    }
+
+    // Schmidt semi-normalisation factors, folded into the coefficients so
+    // the recursion can run on the cheaper Gauss normalised functions
+    double schmidt[kMaximumDegree + 1][kMaximumDegree + 1] = {};
+    schmidt[0][0] = 1;
+    for (int n = 1; n <= kMaximumDegree; n++) {
+        schmidt[n][0] = schmidt[n - 1][0] * (2 * n - 1) / n;
+        for (int m = 1; m <= n; m++) {
+            const double j = m == 1 ? 2 : 1;
+            schmidt[n][m] = schmidt[n][m - 1] * std::sqrt((n - m + 1) * j / (n + m));
+        }
+        for (int m = 0; m <= n; m++) {
+            m_g[n][m] *= schmidt[n][m];
+            m_h[n][m] *= schmidt[n][m];
+            if (n > 1) {
+                m_k[n][m] = static_cast<double>((n - 1) * (n - 1) - m * m) / ((2 * n - 1) * (2 * n - 3));
+            }
+        }
+    }
+}
+
+MagneticField MagneticModel::evaluate(double latitude, double longitude, double height) const {
+    // The harmonic expansion has no east component on the axis; nudge the
+    // poles off it
+    latitude = std::max(-89.99999, std::min(89.99999, latitude));
+
+    // Geodetic to geocentric spherical coordinates, in kilometres
+    const double a = kWGS84.semiMajorAxis / 1000;
+    const double b = kWGS84.semiMinorAxis / 1000;
+    const double a2 = a * a, b2 = b * b, c2 = a2 - b2;
+    const double altitude = height / 1000;
+    const double sinLatitude = std::sin(latitude * kDegreesToRadians);
+    const double cosLatitude = std::cos(latitude * kDegreesToRadians);
+    const double sin2 = sinLatitude * sinLatitude, cos2 = cosLatitude * cosLatitude;
+    const double q = std::sqrt(a2 - c2 * sin2);
+    const double q1 = altitude * q;
+    const double q2 = ((q1 + a2) / (q1 + b2)) * ((q1 + a2) / (q1 + b2));
+    const double ct = sinLatitude / std::sqrt(q2 * cos2 + sin2);
+    const double st = std::sqrt(1 - ct * ct);
+    const double r2 = altitude * altitude + 2 * q1 + (a2 * a2 - c2 * (a2 + b2) * sin2) / (q * q);
+    const double r = std::sqrt(r2);
+    const double d = std::sqrt(a2 * cos2 + b2 * sin2);
+    const double ca = (altitude + d) / r;
+    const double sa = c2 * cosLatitude * sinLatitude / (r * d);
+
+    double sinM[kMaximumDegree + 1], cosM[kMaximumDegree + 1];
+    sinM[0] = 0;
+    cosM[0] = 1;
+    sinM[1] = std::sin(longitude * kDegreesToRadians);
+    cosM[1] = std::cos(longitude * kDegreesToRadians);
+    for (int m = 2; m <= m_degree; m++) {
+        sinM[m] = sinM[1] * cosM[m - 1] + cosM[1] * sinM[m - 1];
+        cosM[m] = cosM[1] * cosM[m - 1] - sinM[1] * sinM[m - 1];
+    }
+
+    // Gauss normalised Legendre functions and their derivatives with
+    // respect to colatitude, built up a degree at a time. Each entry is
+    // written before it is read, so neither table needs clearing.
+    double p[kMaximumDegree + 1][kMaximumDegree + 1];
+    double dp[kMaximumDegree + 1][kMaximumDegree + 1];
+    p[0][0] = 1;
+    dp[0][0] = 0;
+
+    const double ratio = kMagneticReferenceRadius / r;
+    double power = ratio * ratio;
+    double radial = 0, theta = 0, phi = 0;
+    for (int n = 1; n <= m_degree; n++) {
+        power *= ratio;
+        for (int m = 0; m <= n; m++) {
+            if (n == m) {
+                p[n][m] = st * p[n - 1][m - 1];
+                dp[n][m] = st * dp[n - 1][m - 1] + ct * p[n - 1][m - 1];
+            } else if (n == 1) {
+                p[n][m] = ct * p[n - 1][m];
+                dp[n][m] = ct * dp[n - 1][m] - st * p[n - 1][m];
+            } else {
+                const double previous = m > n - 2 ? 0 : p[n - 2][m];
+                const double previousDerivative = m > n - 2 ? 0 : dp[n - 2][m];
+                p[n][m] = ct * p[n - 1][m] - m_k[n][m] * previous;
+                dp[n][m] = ct * dp[n - 1][m] - st * p[n - 1][m] - m_k[n][m] * previousDerivative;
+            }
+
+            const double cosTerm = m_g[n][m] * cosM[m] + m_h[n][m] * sinM[m];
+            const double sinTerm = m_g[n][m] * sinM[m] - m_h[n][m] * cosM[m];
+            radial += (n + 1) * cosTerm * power * p[n][m];
+            theta -= cosTerm * power * dp[n][m];
+            phi += m * sinTerm * power * p[n][m];
+        }
+    }
+    phi /= st;
+
+    // Back from the geocentric to the geodetic frame
+    MagneticField field;
+    field.north = -theta * ca - radial * sa;
+    field.east = phi;
+    field.down = theta * sa - radial * ca;
+    field.declination = std::atan2(field.east, field.north) * kRadiansToDegrees;
+    field.inclination = std::atan2(field.down, std::hypot(field.north, field.east)) * kRadiansToDegrees;
+    return field;
+}
+
+double MagneticModel::decimalYearForTime(double timestamp) {
+    const double days = std::floor(timestamp / 86400);
+    std::int64_t year = 1970 + static_cast<std::int64_t>(std::floor(days / 365.2425));
+    while (daysToYear(year) > days) {
+        year--;
+    }
+    while (daysToYear(year + 1) <= days) {
+        year++;
+    }
+    const double start = static_cast<double>(daysToYear(year)) * 86400;
+    const double length = static_cast<double>(daysToYear(year + 1) - daysToYear(year)) * 86400;
+    return year + (timestamp - start) / length;
+}
+
+} // namespace oslocation
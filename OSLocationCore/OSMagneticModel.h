@@ -0,0 +1,105 @@
+//
+//  OSMagneticModel.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace oslocation {
+
+/**
+ *  One row of a World Magnetic Model coefficient file: the Gauss
+ *  coefficients of degree `n` and order `m` in nanoteslas at the model
+ *  epoch, and their yearly secular variation
+ */
+struct MagneticCoefficient {
+    int n;
+    int m;
+    double g;
+    double h;
+    double gRate;
+    double hRate;
+};
+
+struct MagneticCoefficients {
+    /**
+     *  Decimal year the coefficients are given for
+     */
+    double epoch;
+    const MagneticCoefficient *rows;
+    std::size_t count;
+};
+
+/**
+ *  World Magnetic Model 2025, valid from 2025.0 to 2030.0. Later dates are
+ *  extrapolated with the secular variation, which drifts by roughly a tenth
+ *  of a degree of declination a year outside the validity period.
+ */
+extern const MagneticCoefficients kWMM2025;
+
+/**
+ *  Main field at a point, in nanoteslas with declination and inclination in
+ *  degrees
+ */
+struct MagneticField {
+    double north;
+    double east;
+    double down;
+    /**
+     *  Degrees clockwise from true north to magnetic north
+     */
+    double declination;
+    /**
+     *  Degrees below the horizontal
+     */
+    double inclination;
+};
+
+/**
+ *  Spherical harmonic evaluator for World Magnetic Model coefficients up to
+ *  degree 12. The coefficients are advanced to the requested date and
+ *  Schmidt normalised once on construction, so each evaluation is only the
+ *  Legendre recursion and the harmonic sums.
+ */
+class MagneticModel {
+public:
+    static constexpr int kMaximumDegree = 12;
+
+    /**
+     *  @param decimalYear date to evaluate the model for, such as 2026.5
+     */
+    explicit MagneticModel(double decimalYear, const MagneticCoefficients &coefficients = kWMM2025);
+
+    double decimalYear() const { return m_decimalYear; }
+
+    /**
+     *  @param height above the WGS84 ellipsoid in metres
+     */
+    MagneticField evaluate(double latitude, double longitude, double height = 0) const;
+
+    double declination(double latitude, double longitude, double height = 0) const {
+        return evaluate(latitude, longitude, height).declination;
+    }
+
+    /**
+     *  Decimal year of a time in seconds since 1 January 1970 UTC, counting
+     *  the days of that year as the model does
+     */
+    static double decimalYearForTime(double timestamp);
+
+private:
+    double m_decimalYear;
+    int m_degree;
+    // Indexed [n][m]: coefficients at the model date with the Schmidt
+    // factors folded in, and the recursion factors of the Gauss normalised
+    // Legendre functions
+    double m_g[kMaximumDegree + 1][kMaximumDegree + 1];
+    double m_h[kMaximumDegree + 1][kMaximumDegree + 1];
+    double m_k[kMaximumDegree + 1][kMaximumDegree + 1];
+};
+
+} // namespace oslocation
@@ -0,0 +1,50 @@
+//
+//  OSMappedFile.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace oslocation {
+
+/**
+ *  Read only memory mapping of a whole file. The mapping is released when the
+ *  object is destroyed.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     *  Maps the file at the given path, releasing any previous mapping.
+     *
+     *  @return false if the file could not be opened or mapped; `errno`
+     *  describes the failure
+     */
+    bool open(const std::string &path);
+
+    void close();
+
+    bool isOpen() const { return m_open; }
+    const char *data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    std::string_view contents() const { return std::string_view(m_data, m_size); }
+
+private:
+    const char *m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_open = false;
+};
+
+} // namespace oslocation
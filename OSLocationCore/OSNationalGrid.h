@@ -0,0 +1,27 @@
+//
+//  OSNationalGrid.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+namespace oslocation {
+
+/**
+ *  Position on the British National Grid. Coordinates are NaN when the
+ *  position could not be converted; the height is NaN when no orthometric
+ *  height is available.
+ */
+struct GridPosition {
+    double easting;
+    double northing;
+    /**
+     *  Orthometric height above Ordnance Datum Newlyn (or the local datum
+     *  OSGM15 assigns) in metres
+     */
+    double height;
+};
+
+} // namespace oslocation
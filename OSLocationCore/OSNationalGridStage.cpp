@@ -0,0 +1,46 @@
+//
+//  OSNationalGridStage.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSNationalGridStage.h"
+#include "OSHelmertTransform.h"
+#include "OSTN15Transform.h"
+
+namespace oslocation {
+
+void NationalGridStage::process(FixBuffer &fixes) {
+    if (m_conversion == GridConversion::None) {
+        return;
+    }
+
+    // Gather the batch into columns for the batch kernels and scatter the
+    // results back
+    const std::size_t count = fixes.size();
+    m_scratch.resize(count * 5);
+    double *latitudes = m_scratch.data();
+    double *longitudes = latitudes + count;
+    double *heights = longitudes + count;
+    double *eastings = heights + count;
+    double *northings = eastings + count;
+    for (std::size_t i = 0; i < count; i++) {
+        latitudes[i] = fixes[i].latitude;
+        longitudes[i] = fixes[i].longitude;
+        heights[i] = fixes[i].altitude;
+    }
+
+    if (m_conversion == GridConversion::Precise && m_grid && m_grid->isLoaded()) {
+        OSTN15Transform(*m_grid).transform(latitudes, longitudes, nullptr, count, eastings, northings, nullptr);
+    } else {
+        approximateNationalGrid(latitudes, longitudes, heights, count, eastings, northings);
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        fixes[i].easting = eastings[i];
+        fixes[i].northing = northings[i];
+    }
+}
+
+} // namespace oslocation
@@ -0,0 +1,51 @@
+//
+//  OSNationalGridStage.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSPipeline.h"
+#include "OSTN15Grid.h"
+
+#include <vector>
+
+namespace oslocation {
+
+enum class GridConversion {
+    None,
+    /**
+     *  Helmert and Transverse Mercator, a few metres from OSTN15 but cheap
+     *  enough for every fix and heading update
+     */
+    Approximate,
+    /**
+     *  OSTN15 grid shifts. Falls back to `Approximate` while no grid is
+     *  loaded.
+     */
+    Precise,
+};
+
+/**
+ *  Fills in `easting` and `northing` on every fix in the batch
+ */
+class NationalGridStage : public Stage {
+public:
+    explicit NationalGridStage(GridConversion conversion, const OSTN15Grid *grid = nullptr)
+        : m_conversion(conversion), m_grid(grid) {}
+
+    void process(FixBuffer &fixes) override;
+
+    GridConversion conversion() const { return m_conversion; }
+    void setConversion(GridConversion conversion) { m_conversion = conversion; }
+    void setGrid(const OSTN15Grid *grid) { m_grid = grid; }
+
+private:
+    GridConversion m_conversion;
+    const OSTN15Grid *m_grid;
+    std::vector<double> m_scratch;
+};
+
+} // namespace oslocation
@@ -0,0 +1,98 @@
+//
+//  OSNorthConverter.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSNorthConverter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace oslocation {
+
+namespace {
+
+/**
+ *  Cell height in degrees of latitude, about 1 km. Cell widths are scaled
+ *  by the cosine of the row's latitude so cells stay roughly square.
+ */
+const double kCellSize = 0.009;
+
+/**
+ *  No cell has this key: rows and columns stay well inside 32 bits
+ */
+const std::int64_t kEmptyCell = INT64_MIN;
+
+double normalised(double degrees) {
+    degrees = std::fmod(degrees, 360.0);
+    return degrees < 0 ? degrees + 360 : degrees;
+}
+
+/**
+ *  Degrees clockwise from true north to the reference
+ */
+double offset(const NorthCorrection &correction, NorthReference reference) {
+    switch (reference) {
+        case NorthReference::True:
+            return 0;
+        case NorthReference::Magnetic:
+            return correction.declination;
+        case NorthReference::Grid:
+            return correction.convergence;
+    }
+    return 0;
+}
+
+} // namespace
+
+NorthConverter::NorthConverter(const MagneticModel &model, const TransverseMercator &projection) : m_model(model), m_projection(projection) {
+    for (Cell &cell : m_cells) {
+        cell.key = kEmptyCell;
+    }
+}
+
+NorthCorrection NorthConverter::correction(double latitude, double longitude) {
+    const std::int64_t row = static_cast<std::int64_t>(std::floor(latitude / kCellSize));
+    const double rowLatitude = (row + 0.5) * kCellSize;
+    const double width = kCellSize / std::max(std::cos(rowLatitude * kDegreesToRadians), 0.01);
+    const std::int64_t column = static_cast<std::int64_t>(std::floor(longitude / width));
+    const std::int64_t key = row * (INT64_C(1) << 32) + column;
+
+    Cell &cell = m_cells[static_cast<std::uint64_t>(row * 31 + column) % kCells];
+    if (cell.key == key) {
+        m_statistics.hits++;
+        return cell.correction;
+    }
+    m_statistics.misses++;
+    const double columnLongitude = (column + 0.5) * width;
+    cell.key = key;
+    cell.correction.declination = m_model.declination(rowLatitude, columnLongitude);
+    cell.correction.convergence = gridConvergence(m_projection, rowLatitude, columnLongitude);
+    return cell.correction;
+}
+
+double NorthConverter::convert(double heading, NorthReference from, NorthReference to, double latitude, double longitude) {
+    if (from == to) {
+        return normalised(heading);
+    }
+    const NorthCorrection corrections = correction(latitude, longitude);
+    return normalised(heading + offset(corrections, from) - offset(corrections, to));
+}
+
+Heading NorthConverter::apply(const Heading &heading, double latitude, double longitude) {
+    Heading converted = heading;
+    if (!hasValidHeading(heading)) {
+        return converted;
+    }
+    const NorthCorrection corrections = correction(latitude, longitude);
+    if (!hasValidTrueHeading(heading)) {
+        converted.trueHeading = normalised(heading.magneticHeading + corrections.declination);
+    }
+    converted.gridHeading = normalised(converted.trueHeading - corrections.convergence);
+    return converted;
+}
+
+} // namespace oslocation
@@ -0,0 +1,94 @@
+//
+//  OSNorthConverter.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSCompass.h"
+#include "OSMagneticModel.h"
+#include "OSTransverseMercator.h"
+
+#include <cstdint>
+
+namespace oslocation {
+
+enum class NorthReference {
+    True,
+    Magnetic,
+    Grid,
+};
+
+/**
+ *  Angles between the north references at a point, in degrees clockwise
+ *  from true north
+ */
+struct NorthCorrection {
+    /**
+     *  Magnetic north, from the World Magnetic Model
+     */
+    double declination;
+    /**
+     *  Grid north
+     */
+    double convergence;
+};
+
+struct NorthCacheStatistics {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+};
+
+/**
+ *  Converts headings between true, magnetic and grid north.
+ *
+ *  Corrections are evaluated at the centre of the roughly 1 km cell holding
+ *  the position and kept in a small direct mapped cache, so a device moving
+ *  at ground speed evaluates the magnetic model about once a kilometre.
+ *  Across a cell, declination and convergence over Great Britain change by
+ *  about a hundredth of a degree. Never allocates.
+ */
+class NorthConverter {
+public:
+    /**
+     *  @param model      magnetic model for the date headings are taken on
+     *  @param projection grid to take convergence from; the National Grid
+     *                    by default
+     */
+    explicit NorthConverter(const MagneticModel &model, const TransverseMercator &projection = nationalGridProjection(kGRS80));
+
+    NorthCorrection correction(double latitude, double longitude);
+
+    /**
+     *  @return `heading` measured from `from` north, measured from `to` north
+     *  instead, from 0 to 360
+     */
+    double convert(double heading, NorthReference from, NorthReference to, double latitude, double longitude);
+
+    /**
+     *  Fills in the grid heading of a reading, and the true heading if it is
+     *  unknown, from the magnetic heading. A known true heading is trusted
+     *  over the model.
+     */
+    Heading apply(const Heading &heading, double latitude, double longitude);
+
+    const MagneticModel &model() const { return m_model; }
+    const NorthCacheStatistics &statistics() const { return m_statistics; }
+
+private:
+    static constexpr std::size_t kCells = 64;
+
+    struct Cell {
+        std::int64_t key;
+        NorthCorrection correction;
+    };
+
+    MagneticModel m_model;
+    TransverseMercator m_projection;
+    Cell m_cells[kCells];
+    NorthCacheStatistics m_statistics;
+};
+
+} // namespace oslocation
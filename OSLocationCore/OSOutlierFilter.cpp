@@ -0,0 +1,95 @@
+//
+//  OSOutlierFilter.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSOutlierFilter.h"
+#include "OSLocalFrame.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oslocation {
+
+void OutlierFilter::process(FixBuffer &fixes) {
+    fixes.erase(std::remove_if(fixes.begin(), fixes.end(), [this](const Fix &fix) { return !accept(fix); }), fixes.end());
+}
+
+void OutlierFilter::reset() {
+    m_count = 0;
+    m_head = 0;
+    m_lastSpeed = -1;
+    m_consecutiveRejections = 0;
+}
+
+void OutlierFilter::push(const Fix &fix, double speed) {
+    m_head = (m_head + 1) % kWindowSize;
+    m_window[m_head] = Sample{fix.timestamp, fix.latitude, fix.longitude, fix.horizontalAccuracy};
+    m_count = std::min(m_count + 1, kWindowSize);
+    m_lastSpeed = speed;
+    m_consecutiveRejections = 0;
+    m_statistics.accepted++;
+}
+
+double OutlierFilter::medianAccuracy() const {
+    // The newest `m_count` samples, ending at the head, as the slots
+    // beyond them still hold samples from before the last reset
+    double accuracies[kWindowSize];
+    for (std::size_t i = 0; i < m_count; i++) {
+        accuracies[i] = m_window[(m_head + kWindowSize - i) % kWindowSize].horizontalAccuracy;
+    }
+    std::nth_element(accuracies, accuracies + m_count / 2, accuracies + m_count);
+    return accuracies[m_count / 2];
+}
+
+bool OutlierFilter::accept(const Fix &fix) {
+    if (!hasValidCoordinate(fix)) {
+        m_statistics.rejectedInvalid++;
+        return false;
+    }
+    const Sample &last = m_window[m_head];
+    const double dt = fix.timestamp - last.timestamp;
+    if (m_count == 0 || dt > m_options.maximumGap || dt < 0 || m_consecutiveRejections >= m_options.maximumConsecutiveRejections) {
+        reset();
+        push(fix, -1);
+        return true;
+    }
+
+    if (fix.horizontalAccuracy > m_options.minimumRejectedAccuracy && fix.horizontalAccuracy > m_options.accuracyRatio * medianAccuracy()) {
+        m_statistics.rejectedAccuracy++;
+        m_consecutiveRejections++;
+        return false;
+    }
+
+    double east, north;
+    LocalFrame(last.latitude, last.longitude).toLocal(fix.latitude, fix.longitude, east, north);
+    const double distance = std::max(0.0, std::hypot(east, north) - last.horizontalAccuracy - fix.horizontalAccuracy);
+    if (dt <= 0) {
+        // Simultaneous fixes can only be told apart by their accuracies
+        if (distance > 0) {
+            m_statistics.rejectedSpeed++;
+            m_consecutiveRejections++;
+            return false;
+        }
+        push(fix, m_lastSpeed);
+        return true;
+    }
+
+    const double speed = distance / dt;
+    if (speed > m_options.maximumSpeed) {
+        m_statistics.rejectedSpeed++;
+        m_consecutiveRejections++;
+        return false;
+    }
+    if (m_lastSpeed >= 0 && (speed - m_lastSpeed) / dt > m_options.maximumAcceleration) {
+        m_statistics.rejectedAcceleration++;
+        m_consecutiveRejections++;
+        return false;
+    }
+    push(fix, speed);
+    return true;
+}
+
+} // namespace oslocation
@@ -0,0 +1,115 @@
+//
+//  OSOutlierFilter.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSPipeline.h"
+
+#include <cstdint>
+
+namespace oslocation {
+
+struct OutlierFilterOptions {
+    /**
+     *  Fastest plausible speed in metres per second
+     */
+    double maximumSpeed = 70;
+    /**
+     *  Largest plausible change in speed, in metres per second squared
+     */
+    double maximumAcceleration = 12;
+    /**
+     *  A fix is rejected when its horizontal accuracy is worse than this
+     *  multiple of the median over the recent window...
+     */
+    double accuracyRatio = 3;
+    /**
+     *  ...and worse than this many metres, so small absolute changes on a
+     *  very good signal are kept
+     */
+    double minimumRejectedAccuracy = 25;
+    /**
+     *  After this many rejections in a row the next fix is accepted and the
+     *  window restarts from it, so a genuine jump (leaving a tunnel, a
+     *  train) is only delayed rather than blocked
+     */
+    std::uint32_t maximumConsecutiveRejections = 5;
+    /**
+     *  Gap in seconds after which the window restarts
+     */
+    double maximumGap = 60;
+};
+
+/**
+ *  Counts of fixes seen by the filter and why the rejected ones were dropped
+ */
+struct OutlierStatistics {
+    std::uint64_t accepted = 0;
+    std::uint64_t rejectedInvalid = 0;
+    std::uint64_t rejectedSpeed = 0;
+    std::uint64_t rejectedAcceleration = 0;
+    std::uint64_t rejectedAccuracy = 0;
+
+    std::uint64_t rejected() const { return rejectedInvalid + rejectedSpeed + rejectedAcceleration + rejectedAccuracy; }
+
+    OutlierStatistics &operator+=(const OutlierStatistics &other) {
+        accepted += other.accepted;
+        rejectedInvalid += other.rejectedInvalid;
+        rejectedSpeed += other.rejectedSpeed;
+        rejectedAcceleration += other.rejectedAcceleration;
+        rejectedAccuracy += other.rejectedAccuracy;
+        return *this;
+    }
+};
+
+/**
+ *  Drops fixes that imply an impossible speed or acceleration from the last
+ *  accepted fix, or whose accuracy is much worse than the recent window.
+ *  Distances are reduced by both fixes' accuracies first, so honest
+ *  uncertainty is never mistaken for movement.
+ *
+ *  Keeps the last few accepted fixes in a fixed ring buffer; each fix costs
+ *  constant time.
+ */
+class OutlierFilter : public Stage {
+public:
+    static constexpr std::size_t kWindowSize = 8;
+
+    explicit OutlierFilter(const OutlierFilterOptions &options = OutlierFilterOptions()) : m_options(options) {}
+
+    void process(FixBuffer &fixes) override;
+    void reset() override;
+
+    /**
+     *  @return true if the fix should be kept
+     */
+    bool accept(const Fix &fix);
+
+    const OutlierStatistics &statistics() const { return m_statistics; }
+    void resetStatistics() { m_statistics = OutlierStatistics(); }
+
+private:
+    struct Sample {
+        double timestamp;
+        double latitude;
+        double longitude;
+        double horizontalAccuracy;
+    };
+
+    void push(const Fix &fix, double speed);
+    double medianAccuracy() const;
+
+    OutlierFilterOptions m_options;
+    Sample m_window[kWindowSize] = {};
+    std::size_t m_count = 0;
+    std::size_t m_head = 0;
+    double m_lastSpeed = -1;
+    std::uint32_t m_consecutiveRejections = 0;
+    OutlierStatistics m_statistics;
+};
+
+} // namespace oslocation
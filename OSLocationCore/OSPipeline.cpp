@@ -0,0 +1,58 @@
+//
+//  OSPipeline.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSPipeline.h"
+
+#include <algorithm>
+
+namespace oslocation {
+
+std::unique_ptr<Stage> Pipeline::removeStage(const Stage *stage) {
+    auto it = std::find_if(m_stages.begin(), m_stages.end(), [stage](const std::unique_ptr<Stage> &candidate) { return candidate.get() == stage; });
+    if (it == m_stages.end()) {
+        return nullptr;
+    }
+    std::unique_ptr<Stage> removed = std::move(*it);
+    m_stages.erase(it);
+    return removed;
+}
+
+void Pipeline::removeAllStages() {
+    m_stages.clear();
+}
+
+void Pipeline::process(FixBuffer &fixes) {
+    m_statistics.batches++;
+    m_statistics.fixesIn += fixes.size();
+    for (auto &stage : m_stages) {
+        if (fixes.empty()) {
+            break;
+        }
+        stage->process(fixes);
+    }
+    m_statistics.fixesOut += fixes.size();
+}
+
+void Pipeline::flush(FixBuffer &fixes) {
+    fixes.clear();
+    for (auto &stage : m_stages) {
+        if (!fixes.empty()) {
+            stage->process(fixes);
+        }
+        stage->flush(fixes);
+    }
+    m_statistics.fixesOut += fixes.size();
+}
+
+void Pipeline::reset() {
+    for (auto &stage : m_stages) {
+        stage->reset();
+    }
+    m_statistics = PipelineStatistics();
+}
+
+} // namespace oslocation
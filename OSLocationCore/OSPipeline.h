@@ -0,0 +1,115 @@
+//
+//  OSPipeline.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  A single processing step applied to every batch of fixes.
+ *
+ *  Stages work in place on the batch: they may edit fixes (setting
+ *  `FixFlagModified`), drop them or append synthesised ones. They must not
+ *  allocate per fix once the pipeline has warmed up.
+ */
+class Stage {
+public:
+    virtual ~Stage() = default;
+
+    /**
+     *  Processes a batch of fixes in chronological order
+     */
+    virtual void process(FixBuffer &fixes) = 0;
+
+    /**
+     *  Appends any fixes the stage is holding back for a later batch, such
+     *  as the candidate end point of a simplified segment. Called when the
+     *  source stops.
+     */
+    virtual void flush(FixBuffer &fixes) { (void)fixes; }
+
+    /**
+     *  Discards any state carried over from previous batches
+     */
+    virtual void reset() {}
+};
+
+/**
+ *  Counters maintained by the pipeline across batches
+ */
+struct PipelineStatistics {
+    std::uint64_t batches = 0;
+    std::uint64_t fixesIn = 0;
+    std::uint64_t fixesOut = 0;
+};
+
+/**
+ *  Ordered chain of stages every fix from the location source passes through
+ *  before it reaches the delegate.
+ */
+class Pipeline {
+public:
+    Pipeline() = default;
+    Pipeline(const Pipeline &) = delete;
+    Pipeline &operator=(const Pipeline &) = delete;
+
+    /**
+     *  Appends a stage to the end of the chain and returns it so callers can
+     *  keep a typed pointer for configuration
+     */
+    template <typename T>
+    T *addStage(std::unique_ptr<T> stage) {
+        T *raw = stage.get();
+        m_stages.push_back(std::move(stage));
+        return raw;
+    }
+
+    /**
+     *  Takes a stage out of the chain with its state intact, so it can be
+     *  added back when the chain is rebuilt
+     *
+     *  @return the stage, or null if it is not in the chain
+     */
+    std::unique_ptr<Stage> removeStage(const Stage *stage);
+
+    void removeAllStages();
+
+    bool empty() const { return m_stages.empty(); }
+    std::size_t stageCount() const { return m_stages.size(); }
+
+    /**
+     *  Runs the batch through every stage in order. Stops early if a stage
+     *  leaves the batch empty.
+     */
+    void process(FixBuffer &fixes);
+
+    /**
+     *  Collects the fixes held back by every stage into `fixes`, passing
+     *  each stage's held fixes through the stages after it
+     */
+    void flush(FixBuffer &fixes);
+
+    /**
+     *  Resets every stage and the statistics
+     */
+    void reset();
+
+    const PipelineStatistics &statistics() const { return m_statistics; }
+
+private:
+    std::vector<std::unique_ptr<Stage>> m_stages;
+    PipelineStatistics m_statistics;
+};
+
+} // namespace oslocation
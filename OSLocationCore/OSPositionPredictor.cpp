@@ -0,0 +1,113 @@
+//
+//  OSPositionPredictor.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSPositionPredictor.h"
+
+#include <cmath>
+
+namespace oslocation {
+
+void PositionPredictor::update(const Fix &fix) {
+    if (!hasValidCoordinate(fix)) {
+        return;
+    }
+    // Where predictions had put the position, to ease from
+    double latitude = fix.latitude, longitude = fix.longitude;
+    const bool eases = m_options.blendTime > 0 && predict(fix.timestamp, latitude, longitude);
+
+    const LocalFrame frame(fix.latitude, fix.longitude);
+    const bool provisional = (fix.flags & FixFlagProvisional) != 0;
+    if (m_hasFix && (provisional || m_fixIsProvisional)) {
+        // A fix cached from an earlier session says nothing about how the
+        // user is moving now
+        m_hasDerivedVelocity = false;
+    } else if (m_hasFix) {
+        const double elapsed = fix.timestamp - m_fixTimestamp;
+        if (elapsed > 0 && elapsed <= m_options.maximumGap) {
+            double east, north;
+            frame.toLocal(m_frame.originLatitude(), m_frame.originLongitude(), east, north);
+            const double velocityEast = -east / elapsed, velocityNorth = -north / elapsed;
+            if (m_hasDerivedVelocity) {
+                const double alpha = 1 - std::exp(-elapsed / m_options.velocityTimeConstant);
+                m_derivedEast += alpha * (velocityEast - m_derivedEast);
+                m_derivedNorth += alpha * (velocityNorth - m_derivedNorth);
+            } else {
+                m_derivedEast = velocityEast;
+                m_derivedNorth = velocityNorth;
+                m_hasDerivedVelocity = true;
+            }
+        } else if (elapsed > m_options.maximumGap) {
+            m_hasDerivedVelocity = false;
+        }
+    }
+
+    if (hasValidSpeed(fix) && hasValidCourse(fix)) {
+        const double course = fix.course * kDegreesToRadians;
+        m_velocityEast = fix.speed * std::sin(course);
+        m_velocityNorth = fix.speed * std::cos(course);
+    } else if (m_hasDerivedVelocity && std::hypot(m_derivedEast, m_derivedNorth) >= m_options.minimumSpeed) {
+        m_velocityEast = m_derivedEast;
+        m_velocityNorth = m_derivedNorth;
+    } else {
+        m_velocityEast = 0;
+        m_velocityNorth = 0;
+    }
+
+    m_hasFix = true;
+    m_fixIsProvisional = provisional;
+    m_fixTimestamp = fix.timestamp;
+    m_frame = frame;
+    m_anchorTimestamp = fix.timestamp;
+    m_anchorLatitude = fix.latitude;
+    m_anchorLongitude = fix.longitude;
+    setRates(m_velocityEast, m_velocityNorth);
+    m_hasFixHeading = m_hasHeading;
+    m_fixHeading = m_heading;
+
+    if (eases) {
+        m_latitudeOffset = latitude - fix.latitude;
+        m_longitudeOffset = longitude - fix.longitude;
+        m_blendEnd = fix.timestamp + m_options.blendTime;
+        m_inverseBlendTime = 1 / m_options.blendTime;
+    } else {
+        m_blendEnd = fix.timestamp;
+    }
+}
+
+void PositionPredictor::updateHeading(const Heading &heading) {
+    if (!hasValidHeading(heading)) {
+        return;
+    }
+    m_hasHeading = true;
+    m_heading = heading.magneticHeading;
+    if (!m_options.turnsWithHeading || !m_hasFix || !m_hasFixHeading || heading.timestamp < m_anchorTimestamp ||
+        heading.timestamp > m_fixTimestamp + m_options.maximumHorizon) {
+        return;
+    }
+    // Carry on from where the old direction has got to by now, in the new
+    // one. Only the turn since the fix counts, so it does not matter which
+    // north the headings are measured from.
+    m_anchorLatitude += m_latitudeRate * (heading.timestamp - m_anchorTimestamp);
+    m_anchorLongitude += m_longitudeRate * (heading.timestamp - m_anchorTimestamp);
+    m_anchorTimestamp = heading.timestamp;
+    const double turn = (m_heading - m_fixHeading) * kDegreesToRadians;
+    const double cosine = std::cos(turn), sine = std::sin(turn);
+    setRates(m_velocityEast * cosine + m_velocityNorth * sine, m_velocityNorth * cosine - m_velocityEast * sine);
+}
+
+void PositionPredictor::reset() {
+    *this = PositionPredictor(m_options);
+}
+
+void PositionPredictor::setRates(double east, double north) {
+    double latitude, longitude;
+    m_frame.toGeodetic(east, north, latitude, longitude);
+    m_latitudeRate = latitude - m_frame.originLatitude();
+    m_longitudeRate = longitude - m_frame.originLongitude();
+}
+
+} // namespace oslocation
@@ -0,0 +1,146 @@
+//
+//  OSPositionPredictor.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSCompass.h"
+#include "OSFix.h"
+#include "OSLocalFrame.h"
+
+#include <algorithm>
+
+namespace oslocation {
+
+struct PositionPredictorOptions {
+    /**
+     *  Seconds after the last fix the predicted position keeps moving for.
+     *  Later times get the position reached by then.
+     */
+    double maximumHorizon = 5;
+    /**
+     *  Seconds over which predictions ease from where they had put the
+     *  position onto the track through each new fix, so a display
+     *  following them does not jump. 0 switches at once.
+     */
+    double blendTime = 0.5;
+    /**
+     *  Time constant in seconds for the velocity derived from successive
+     *  positions when fixes carry no speed and course
+     */
+    double velocityTimeConstant = 2;
+    /**
+     *  Derived speeds below this many metres per second are taken as
+     *  standing still, so GPS jitter does not set the position drifting
+     */
+    double minimumSpeed = 0.5;
+    /**
+     *  Gap in seconds across which no velocity is derived
+     */
+    double maximumGap = 10;
+    /**
+     *  Whether the direction of travel turns with the compass between fixes
+     */
+    bool turnsWithHeading = true;
+};
+
+/**
+ *  Dead reckons the position between fixes, for displays redrawn far more
+ *  often than fixes arrive. Each fix moves on at its reported speed and
+ *  course, or failing those at a velocity derived from recent positions,
+ *  and turns with the compass: the direction of travel rotates by however
+ *  far the heading has turned since the fix.
+ *
+ *  The velocity is converted to degrees per second as fixes and headings
+ *  arrive, so `predict` is a handful of multiplies and never allocates.
+ */
+class PositionPredictor {
+public:
+    explicit PositionPredictor(const PositionPredictorOptions &options = PositionPredictorOptions()) : m_options(options) {}
+
+    const PositionPredictorOptions &options() const { return m_options; }
+
+    /**
+     *  Adds a fix. Fixes without a valid coordinate are ignored. No velocity
+     *  is derived across a `FixFlagProvisional` fix.
+     */
+    void update(const Fix &fix);
+
+    /**
+     *  Adds a compass reading. Readings with a negative `headingAccuracy`
+     *  are ignored.
+     */
+    void updateHeading(const Heading &heading);
+
+    /**
+     *  Position predicted at a time, clamped to the span from the last fix
+     *  to `maximumHorizon` after it
+     *
+     *  @return false until there has been a fix, leaving the outputs
+     *  untouched
+     */
+    bool predict(double timestamp, double &latitude, double &longitude) const {
+        if (!m_hasFix) {
+            return false;
+        }
+        const double clamped = std::min(std::max(timestamp, m_fixTimestamp), m_fixTimestamp + m_options.maximumHorizon);
+        const double elapsed = clamped - m_anchorTimestamp;
+        latitude = m_anchorLatitude + m_latitudeRate * elapsed;
+        longitude = m_anchorLongitude + m_longitudeRate * elapsed;
+        if (clamped < m_blendEnd) {
+            const double remaining = (m_blendEnd - clamped) * m_inverseBlendTime;
+            latitude += m_latitudeOffset * remaining;
+            longitude += m_longitudeOffset * remaining;
+        }
+        return true;
+    }
+
+    void reset();
+
+    bool hasFix() const { return m_hasFix; }
+
+    /**
+     *  Velocity the last fix moves on at, in metres per second east and
+     *  north, before any turn of the compass
+     */
+    double velocityEast() const { return m_velocityEast; }
+    double velocityNorth() const { return m_velocityNorth; }
+
+private:
+    void setRates(double east, double north);
+
+    PositionPredictorOptions m_options;
+    bool m_hasFix = false;
+    bool m_fixIsProvisional = false;
+    double m_fixTimestamp = 0;
+    LocalFrame m_frame;
+
+    // Velocity derived from positions, metres per second
+    bool m_hasDerivedVelocity = false;
+    double m_derivedEast = 0, m_derivedNorth = 0;
+
+    // Velocity at the last fix, metres per second
+    double m_velocityEast = 0, m_velocityNorth = 0;
+
+    // The track predictions follow: a point, its time and degrees per second
+    double m_anchorTimestamp = 0;
+    double m_anchorLatitude = 0, m_anchorLongitude = 0;
+    double m_latitudeRate = 0, m_longitudeRate = 0;
+
+    // What the predictions were off the new track by at the last fix,
+    // fading out at `m_blendEnd`
+    double m_latitudeOffset = 0, m_longitudeOffset = 0;
+    double m_blendEnd = 0;
+    double m_inverseBlendTime = 0;
+
+    // Latest magnetic heading, and the one when the last fix arrived
+    bool m_hasHeading = false;
+    double m_heading = 0;
+    bool m_hasFixHeading = false;
+    double m_fixHeading = 0;
+};
+
+} // namespace oslocation
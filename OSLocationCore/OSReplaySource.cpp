@@ -0,0 +1,64 @@
+//
+//  OSReplaySource.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSReplaySource.h"
+
+#include <utility>
+
+namespace oslocation {
+
+ReplaySource::ReplaySource(FixBuffer track, Clock &clock, ReplayOptions options)
+    : m_track(std::move(track)), m_clock(clock), m_options(options) {
+    if (m_options.speed <= 0) {
+        m_options.speed = 1;
+    }
+    if (m_track.size() > 1) {
+        // Leave one typical sample interval between loops so the first fix
+        // of the next loop does not share a timestamp with the last one.
+        double span = m_track.back().timestamp - m_track.front().timestamp;
+        m_duration = span + span / static_cast<double>(m_track.size() - 1);
+    }
+    rewind();
+}
+
+void ReplaySource::rewind() {
+    m_index = 0;
+    m_loop = 0;
+    m_clockOrigin = m_clock.now();
+}
+
+double ReplaySource::releaseTime(double trackTime) const {
+    return m_clockOrigin + (trackTime - m_track.front().timestamp) / m_options.speed;
+}
+
+bool ReplaySource::nextBatch(FixBuffer &batch) {
+    batch.clear();
+    if (m_track.empty() || m_loop >= m_options.loops) {
+        return false;
+    }
+
+    const double loopOffset = m_duration * m_loop;
+    const double timestamp = m_track[m_index].timestamp;
+    if (m_options.mode == ReplayMode::Timed) {
+        m_clock.sleepUntil(releaseTime(timestamp + loopOffset));
+    }
+
+    while (m_index < m_track.size() && m_track[m_index].timestamp == timestamp) {
+        Fix fix = m_track[m_index++];
+        fix.timestamp = m_options.rebaseTimestamps ? m_clock.now() : fix.timestamp + loopOffset;
+        fix.sourceIndex = static_cast<std::int32_t>(batch.size());
+        fix.flags = FixFlagNone;
+        batch.push_back(fix);
+    }
+    if (m_index == m_track.size()) {
+        m_index = 0;
+        m_loop++;
+    }
+    return true;
+}
+
+} // namespace oslocation
@@ -0,0 +1,144 @@
+//
+//  OSReplaySource.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSClock.h"
+#include "OSFix.h"
+#include "OSPipeline.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace oslocation {
+
+enum class ReplayMode {
+    /**
+     *  Fixes are released at the cadence of their timestamps divided by
+     *  `ReplayOptions::speed`
+     */
+    Timed,
+    /**
+     *  Fixes are released back to back without consulting the clock
+     */
+    AsFastAsPossible,
+};
+
+struct ReplayOptions {
+    ReplayMode mode = ReplayMode::Timed;
+    /**
+     *  Time warp factor for `ReplayMode::Timed`: 1 is real time, 60 plays a
+     *  minute of track every second
+     */
+    double speed = 1;
+    /**
+     *  Number of times to play the track. Each loop is shifted in time by the
+     *  track duration so timestamps keep increasing.
+     */
+    unsigned loops = 1;
+    /**
+     *  Replace the recorded timestamps with the clock time at which each fix
+     *  is released
+     */
+    bool rebaseTimestamps = false;
+};
+
+struct ReplayStatistics {
+    std::uint64_t batches = 0;
+    std::uint64_t fixesEmitted = 0;
+    std::uint64_t fixesDelivered = 0;
+    /**
+     *  Track time covered by the replay in seconds
+     */
+    double trackSeconds = 0;
+    /**
+     *  Wall clock time spent inside `Pipeline::process`
+     */
+    std::chrono::nanoseconds processingTime{0};
+    std::chrono::nanoseconds slowestBatch{0};
+
+    double nanosecondsPerFix() const {
+        return fixesEmitted ? static_cast<double>(processingTime.count()) / static_cast<double>(fixesEmitted) : 0;
+    }
+};
+
+/**
+ *  Plays a recorded track back through a pipeline, batching fixes that share
+ *  a timestamp the way CoreLocation does and releasing each batch when the
+ *  clock reaches it.
+ */
+class ReplaySource {
+public:
+    ReplaySource(FixBuffer track, Clock &clock, ReplayOptions options = ReplayOptions());
+
+    /**
+     *  Waits for the next batch to become due and copies it into `batch`.
+     *
+     *  @return false once every loop of the track has been emitted
+     */
+    bool nextBatch(FixBuffer &batch);
+
+    /**
+     *  Starts again from the first fix, anchoring the timeline to the clock's
+     *  current time
+     */
+    void rewind();
+
+    /**
+     *  Replays the whole track through the pipeline, handing every processed
+     *  non empty batch to `sink`
+     */
+    template <typename Sink>
+    ReplayStatistics run(Pipeline &pipeline, Sink &&sink) {
+        ReplayStatistics statistics;
+        FixBuffer batch;
+        batch.reserve(16);
+        double firstTimestamp = 0, lastTimestamp = 0;
+        while (nextBatch(batch)) {
+            if (statistics.batches == 0) {
+                firstTimestamp = batch.front().timestamp;
+            }
+            lastTimestamp = batch.back().timestamp;
+            statistics.batches++;
+            statistics.fixesEmitted += batch.size();
+
+            auto start = std::chrono::steady_clock::now();
+            pipeline.process(batch);
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            statistics.processingTime += elapsed;
+            if (elapsed > statistics.slowestBatch) {
+                statistics.slowestBatch = elapsed;
+            }
+
+            statistics.fixesDelivered += batch.size();
+            if (!batch.empty()) {
+                sink(static_cast<const FixBuffer &>(batch));
+            }
+        }
+        statistics.trackSeconds = lastTimestamp - firstTimestamp;
+        return statistics;
+    }
+
+    /**
+     *  Duration of a single loop of the track in seconds
+     */
+    double trackDuration() const { return m_duration; }
+
+private:
+    double releaseTime(double trackTime) const;
+
+    FixBuffer m_track;
+    Clock &m_clock;
+    ReplayOptions m_options;
+    double m_duration = 0;
+    double m_clockOrigin = 0;
+    std::size_t m_index = 0;
+    unsigned m_loop = 0;
+};
+
+} // namespace oslocation
@@ -0,0 +1,313 @@
+//
+//  OSRouteMatcher.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSRouteMatcher.h"
+#include "OSGeodesic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+// Cells are counted from well south and west of any latitude and longitude
+// so the key halves stay positive
+constexpr std::int64_t kCellOffset = 1 << 30;
+
+inline bool isValidCoordinate(double latitude, double longitude) {
+    return std::fabs(latitude) <= 90 && std::fabs(longitude) <= 180;
+}
+
+} // namespace
+
+Route::Route(double cellSize) : m_cellSize(cellSize > 0 ? cellSize : 250) {}
+
+void Route::clear() {
+    m_latitudes.clear();
+    m_longitudes.clear();
+    m_distances.clear();
+    m_segments.clear();
+    m_cells.clear();
+}
+
+bool Route::assign(const double *latitudes, const double *longitudes, std::size_t count) {
+    clear();
+    for (std::size_t i = 0; i < count; i++) {
+        if (!isValidCoordinate(latitudes[i], longitudes[i])) {
+            continue;
+        }
+        if (!m_latitudes.empty() && latitudes[i] == m_latitudes.back() && longitudes[i] == m_longitudes.back()) {
+            continue;
+        }
+        m_latitudes.push_back(latitudes[i]);
+        m_longitudes.push_back(longitudes[i]);
+    }
+    if (m_latitudes.size() < 2) {
+        clear();
+        return false;
+    }
+
+    const std::size_t segments = m_latitudes.size() - 1;
+    m_distances.resize(m_latitudes.size());
+    m_distances[0] = 0;
+    m_segments.resize(segments);
+    for (std::size_t i = 0; i < segments; i++) {
+        Segment &segment = m_segments[i];
+        segment.frame.setOrigin(m_latitudes[i], m_longitudes[i]);
+        segment.frame.toLocal(m_latitudes[i + 1], m_longitudes[i + 1], segment.east, segment.north);
+        segment.inverseLengthSquared = 1 / (segment.east * segment.east + segment.north * segment.north);
+        m_distances[i + 1] = m_distances[i] + distanceBetween(m_latitudes[i], m_longitudes[i], m_latitudes[i + 1], m_longitudes[i + 1]);
+    }
+    index();
+    return true;
+}
+
+GPXResult Route::loadGPX(const std::string &path) {
+    std::vector<double> latitudes, longitudes, waypointLatitudes, waypointLongitudes;
+    const GPXResult result = GPXReader::readFile(path, [&](const GPXPoint &point) {
+        if (point.type == GPXPointType::Waypoint) {
+            waypointLatitudes.push_back(point.latitude);
+            waypointLongitudes.push_back(point.longitude);
+        } else {
+            latitudes.push_back(point.latitude);
+            longitudes.push_back(point.longitude);
+        }
+    });
+    if (latitudes.empty()) {
+        latitudes.swap(waypointLatitudes);
+        longitudes.swap(waypointLongitudes);
+    }
+    assign(latitudes.data(), longitudes.data(), latitudes.size());
+    return result;
+}
+
+std::int64_t Route::row(double latitude) const {
+    return static_cast<std::int64_t>(std::floor(latitude / m_cellHeight)) + kCellOffset;
+}
+
+std::int64_t Route::column(double longitude) const {
+    return static_cast<std::int64_t>(std::floor(longitude / m_cellWidth)) + kCellOffset;
+}
+
+void Route::index() {
+    // Cells are a fixed size in degrees, `m_cellSize` across where the
+    // route is furthest from the equator. Lookups convert their radius to
+    // degrees where they are, so the cell size only affects speed.
+    double widest = 0;
+    for (double latitude : m_latitudes) {
+        widest = std::max(widest, std::fabs(latitude));
+    }
+    double latitude, longitude;
+    LocalFrame(std::min(widest, 89.0), 0).toGeodetic(m_cellSize, m_cellSize, latitude, longitude);
+    m_cellHeight = latitude - std::min(widest, 89.0);
+    m_cellWidth = longitude;
+
+    for (std::uint32_t i = 0; i < m_segments.size(); i++) {
+        const std::int64_t south = row(std::min(m_latitudes[i], m_latitudes[i + 1]));
+        const std::int64_t north = row(std::max(m_latitudes[i], m_latitudes[i + 1]));
+        const std::int64_t west = column(std::min(m_longitudes[i], m_longitudes[i + 1]));
+        const std::int64_t east = column(std::max(m_longitudes[i], m_longitudes[i + 1]));
+        for (std::int64_t y = south; y <= north; y++) {
+            for (std::int64_t x = west; x <= east; x++) {
+                m_cells[(static_cast<std::uint64_t>(y) << 32) | static_cast<std::uint32_t>(x)].push_back(i);
+            }
+        }
+    }
+}
+
+RouteMatch Route::project(std::uint32_t segment, double latitude, double longitude) const {
+    const Segment &s = m_segments[segment];
+    double east, north;
+    s.frame.toLocal(latitude, longitude, east, north);
+    const double t = std::min(1.0, std::max(0.0, (east * s.east + north * s.north) * s.inverseLengthSquared));
+    const double dx = east - t * s.east;
+    const double dy = north - t * s.north;
+
+    RouteMatch match;
+    match.segment = segment;
+    match.distanceAlongRoute = m_distances[segment] + t * (m_distances[segment + 1] - m_distances[segment]);
+    match.distanceFromRoute = std::hypot(dx, dy);
+    match.crossTrackError = s.north * east - s.east * north < 0 ? -match.distanceFromRoute : match.distanceFromRoute;
+    return match;
+}
+
+void Route::segmentsNear(double latitude, double longitude, double radius, std::vector<std::uint32_t> &segments) const {
+    if (m_segments.empty()) {
+        return;
+    }
+    double cornerLatitude, cornerLongitude;
+    LocalFrame(latitude, longitude).toGeodetic(radius, radius, cornerLatitude, cornerLongitude);
+    const double dLatitude = cornerLatitude - latitude, dLongitude = cornerLongitude - longitude;
+    const std::size_t first = segments.size();
+    for (std::int64_t y = row(latitude - dLatitude); y <= row(latitude + dLatitude); y++) {
+        for (std::int64_t x = column(longitude - dLongitude); x <= column(longitude + dLongitude); x++) {
+            auto cell = m_cells.find((static_cast<std::uint64_t>(y) << 32) | static_cast<std::uint32_t>(x));
+            if (cell != m_cells.end()) {
+                segments.insert(segments.end(), cell->second.begin(), cell->second.end());
+            }
+        }
+    }
+    std::sort(segments.begin() + first, segments.end());
+    segments.erase(std::unique(segments.begin() + first, segments.end()), segments.end());
+}
+
+RouteMatcher::RouteMatcher(const Route &route, const RouteMatcherOptions &options)
+    : m_route(route), m_options(options), m_offRouteSince(std::numeric_limits<double>::quiet_NaN()) {}
+
+void RouteMatcher::reset() {
+    m_hasMatch = false;
+    m_onRoute = false;
+    m_match = RouteMatch{};
+    m_offRouteSince = std::numeric_limits<double>::quiet_NaN();
+}
+
+RouteMatch RouteMatcher::searchWindow(double timestamp, double latitude, double longitude) {
+    const double elapsed = std::max(0.0, timestamp - m_timestamp);
+    const double from = m_match.distanceAlongRoute - m_options.searchMargin;
+    const double to = m_match.distanceAlongRoute + m_options.searchMargin + m_options.maximumSpeed * elapsed;
+    std::uint32_t segment = std::min<std::uint32_t>(m_match.segment, static_cast<std::uint32_t>(m_route.segmentCount() - 1));
+    while (segment > 0 && m_route.distanceAt(segment) > from) {
+        segment--;
+    }
+
+    // Project onto the window first, as the cost of each match depends on
+    // the nearest
+    m_window.clear();
+    double nearest = std::numeric_limits<double>::infinity();
+    for (; segment < m_route.segmentCount() && (m_route.distanceAt(segment) <= to || m_window.empty()); segment++) {
+        m_window.push_back(m_route.project(segment, latitude, longitude));
+        nearest = std::min(nearest, m_window.back().distanceFromRoute);
+    }
+    m_lastSegmentsTested += m_window.size();
+
+    // Going back along the route costs as much as the same distance across
+    // it, and so does going forward further than the fix has moved, give
+    // or take the error of both fixes, so stretches of a recorded route
+    // that wander back and forth are followed at the pace of the fixes
+    const double moved = equirectangularDistance(m_latitude, m_longitude, latitude, longitude);
+    const double reach = moved + m_match.distanceFromRoute + 2 * nearest;
+    RouteMatch best{};
+    double bestCost = std::numeric_limits<double>::infinity();
+    for (const RouteMatch &match : m_window) {
+        const double progress = match.distanceAlongRoute - m_match.distanceAlongRoute;
+        const double cost = match.distanceFromRoute + std::max(0.0, -progress) + std::max(0.0, progress - reach);
+        if (cost < bestCost) {
+            best = match;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
+bool RouteMatcher::searchIndex(double latitude, double longitude, double radius, RouteMatch &match) {
+    m_candidates.clear();
+    m_route.segmentsNear(latitude, longitude, radius, m_candidates);
+    // The segments within reach come in passes, stretches of route near
+    // the position separated by more than twice the radius of route that
+    // is not. Take the closest point of the pass nearest the progress made
+    // so far, or of the first pass if there is none.
+    bool found = false, inPass = false;
+    RouteMatch pass{};
+    double passEnd = 0;
+    auto choose = [&](const RouteMatch &candidate) {
+        if (!found || (m_hasMatch && std::fabs(candidate.distanceAlongRoute - m_match.distanceAlongRoute) < std::fabs(match.distanceAlongRoute - m_match.distanceAlongRoute))) {
+            match = candidate;
+            found = true;
+        }
+    };
+    for (std::uint32_t segment : m_candidates) {
+        const RouteMatch candidate = m_route.project(segment, latitude, longitude);
+        m_lastSegmentsTested++;
+        if (candidate.distanceFromRoute > radius) {
+            continue;
+        }
+        if (inPass && candidate.distanceAlongRoute - passEnd > 2 * radius) {
+            choose(pass);
+            inPass = false;
+        }
+        if (!inPass || candidate.distanceFromRoute < pass.distanceFromRoute) {
+            pass = candidate;
+        }
+        inPass = true;
+        passEnd = candidate.distanceAlongRoute;
+    }
+    if (inPass) {
+        choose(pass);
+    }
+    return found;
+}
+
+bool RouteMatcher::update(double timestamp, double latitude, double longitude, RouteProgress &progress, std::vector<RouteEvent> &events) {
+    m_lastSegmentsTested = 0;
+    if (m_route.segmentCount() == 0) {
+        return false;
+    }
+    const double threshold = m_onRoute ? m_options.offRouteDistance : m_options.rejoinDistance;
+    RouteMatch match{};
+    bool near = false;
+    if (m_hasMatch) {
+        match = searchWindow(timestamp, latitude, longitude);
+        near = match.distanceFromRoute <= threshold;
+    }
+    if (!near) {
+        RouteMatch elsewhere;
+        if (searchIndex(latitude, longitude, m_hasMatch ? threshold : m_options.offRouteDistance, elsewhere)) {
+            match = elsewhere;
+            near = true;
+        }
+    }
+    if (!m_hasMatch && !near) {
+        return false;
+    }
+
+    if (near) {
+        m_offRouteSince = std::numeric_limits<double>::quiet_NaN();
+        if (!m_onRoute) {
+            m_onRoute = true;
+            events.push_back(RouteEvent{RouteTransition::OnRoute, timestamp, match.distanceAlongRoute});
+        }
+    } else if (m_onRoute) {
+        if (std::isnan(m_offRouteSince)) {
+            m_offRouteSince = timestamp;
+        }
+        if (timestamp - m_offRouteSince >= m_options.offRouteTime) {
+            m_onRoute = false;
+            events.push_back(RouteEvent{RouteTransition::OffRoute, timestamp, match.distanceAlongRoute});
+        }
+    }
+
+    m_hasMatch = true;
+    m_match = match;
+    m_timestamp = timestamp;
+    m_latitude = latitude;
+    m_longitude = longitude;
+
+    progress.timestamp = timestamp;
+    progress.segment = match.segment;
+    progress.distanceAlongRoute = match.distanceAlongRoute;
+    progress.crossTrackError = match.crossTrackError;
+    progress.remainingDistance = m_route.length() - match.distanceAlongRoute;
+    progress.onRoute = m_onRoute;
+    return true;
+}
+
+void RouteMatcherStage::process(FixBuffer &fixes) {
+    for (const Fix &fix : fixes) {
+        if (hasValidCoordinate(fix) && m_matcher.update(fix.timestamp, fix.latitude, fix.longitude, m_progress, m_events)) {
+            m_hasProgress = true;
+        }
+    }
+}
+
+void RouteMatcherStage::reset() {
+    m_hasProgress = false;
+    m_events.clear();
+}
+
+} // namespace oslocation
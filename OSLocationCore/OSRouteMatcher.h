@@ -0,0 +1,271 @@
+//
+//  OSRouteMatcher.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSGPXReader.h"
+#include "OSLocalFrame.h"
+#include "OSPipeline.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  Where a position lies relative to one segment of a route
+ */
+struct RouteMatch {
+    std::uint32_t segment;
+    /**
+     *  Metres along the route to the closest point of the segment
+     */
+    double distanceAlongRoute;
+    /**
+     *  Metres to the closest point of the segment, positive when the
+     *  position is to the right of the route in its direction of travel
+     */
+    double crossTrackError;
+    /**
+     *  Unsigned `crossTrackError`
+     */
+    double distanceFromRoute;
+};
+
+/**
+ *  A polyline to follow, with its segments indexed by square cells so the
+ *  segments near any position can be found without a scan. Lengths are
+ *  geodesic; positions are projected onto each segment in a flat frame at
+ *  its start. Routes must not cross the antimeridian.
+ */
+class Route {
+public:
+    /**
+     *  @param cellSize side of the index cells in metres
+     */
+    explicit Route(double cellSize = 250);
+
+    /**
+     *  Replaces the route. Invalid coordinates and repeated vertices are
+     *  skipped.
+     *
+     *  @return false if fewer than two vertices remain, leaving the route
+     *  empty
+     */
+    bool assign(const double *latitudes, const double *longitudes, std::size_t count);
+
+    /**
+     *  Replaces the route with the route and track points of a GPX file, or
+     *  its waypoints if it has neither
+     */
+    GPXResult loadGPX(const std::string &path);
+
+    void clear();
+
+    std::size_t vertexCount() const { return m_latitudes.size(); }
+    std::size_t segmentCount() const { return m_segments.size(); }
+    double length() const { return m_distances.empty() ? 0 : m_distances.back(); }
+
+    /**
+     *  Metres along the route to a vertex
+     */
+    double distanceAt(std::size_t vertex) const { return m_distances[vertex]; }
+
+    RouteMatch project(std::uint32_t segment, double latitude, double longitude) const;
+
+    /**
+     *  Appends the segments whose bounding boxes come within `radius`
+     *  metres of the position, each once and in route order
+     */
+    void segmentsNear(double latitude, double longitude, double radius, std::vector<std::uint32_t> &segments) const;
+
+private:
+    struct Segment {
+        LocalFrame frame;
+        double east, north;
+        double inverseLengthSquared;
+    };
+
+    std::int64_t row(double latitude) const;
+    std::int64_t column(double longitude) const;
+    void index();
+
+    double m_cellSize;
+    double m_cellHeight = 1;
+    double m_cellWidth = 1;
+    std::vector<double> m_latitudes;
+    std::vector<double> m_longitudes;
+    std::vector<double> m_distances;
+    std::vector<Segment> m_segments;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_cells;
+};
+
+struct RouteMatcherOptions {
+    /**
+     *  Metres from the route beyond which a position counts as off it
+     */
+    double offRouteDistance = 30;
+    /**
+     *  Seconds positions must stay beyond `offRouteDistance` before the
+     *  matcher reports leaving the route, so a single stray fix does not
+     */
+    double offRouteTime = 5;
+    /**
+     *  Metres from the route a position must come back within to rejoin it
+     */
+    double rejoinDistance = 15;
+    /**
+     *  Fastest travel along the route in metres per second. With
+     *  `searchMargin` this bounds how far from the last match the next
+     *  fix is searched for.
+     */
+    double maximumSpeed = 70;
+    /**
+     *  Metres of route searched either side of the last match besides the
+     *  distance `maximumSpeed` allows
+     */
+    double searchMargin = 50;
+};
+
+/**
+ *  A fix matched to the route
+ */
+struct RouteProgress {
+    double timestamp;
+    std::uint32_t segment;
+    double distanceAlongRoute;
+    /**
+     *  Signed metres from the route, positive to its right
+     */
+    double crossTrackError;
+    double remainingDistance;
+    bool onRoute;
+};
+
+enum class RouteTransition {
+    /**
+     *  The first fix near the route, or the first back near it after
+     *  leaving
+     */
+    OnRoute,
+    /**
+     *  Fixes have stayed off the route for `offRouteTime`
+     */
+    OffRoute,
+};
+
+struct RouteEvent {
+    RouteTransition transition;
+    double timestamp;
+    double distanceAlongRoute;
+};
+
+/**
+ *  Follows progress along a route fix by fix. Each fix is matched within a
+ *  window of the route around the last match, sized by the time since it
+ *  and `maximumSpeed`, so the work per fix does not grow with the length
+ *  of the route. Ties go to the earlier segment. Moving back along the
+ *  route costs as much as the same distance across it, and so does moving
+ *  on much further than the fix has moved, so a route that doubles back on
+ *  itself is followed in order.
+ *
+ *  The cell index is only searched to find the route in the first place,
+ *  where the first pass within reach is taken, or when a fix has strayed
+ *  from the window, such as after a shortcut.
+ *
+ *  The route must outlive the matcher and not change while it is in use.
+ */
+class RouteMatcher {
+public:
+    explicit RouteMatcher(const Route &route, const RouteMatcherOptions &options = RouteMatcherOptions());
+
+    /**
+     *  Matches a fix, appending any transitions to `events`
+     *
+     *  @return false until a fix has come within `offRouteDistance` of the
+     *  route, leaving `progress` untouched
+     */
+    bool update(double timestamp, double latitude, double longitude, RouteProgress &progress, std::vector<RouteEvent> &events);
+
+    /**
+     *  Forgets the progress made, so the next fix finds the route afresh
+     */
+    void reset();
+
+    const Route &route() const { return m_route; }
+    const RouteMatcherOptions &options() const { return m_options; }
+    bool hasMatch() const { return m_hasMatch; }
+    bool isOnRoute() const { return m_onRoute; }
+
+    /**
+     *  Segments projected onto by the last update, for measuring the search
+     */
+    std::size_t lastSegmentsTested() const { return m_lastSegmentsTested; }
+
+private:
+    RouteMatch searchWindow(double timestamp, double latitude, double longitude);
+    bool searchIndex(double latitude, double longitude, double radius, RouteMatch &match);
+
+    const Route &m_route;
+    RouteMatcherOptions m_options;
+    bool m_hasMatch = false;
+    bool m_onRoute = false;
+    RouteMatch m_match{};
+    double m_timestamp = 0;
+    double m_latitude = 0;
+    double m_longitude = 0;
+    double m_offRouteSince;
+    std::size_t m_lastSegmentsTested = 0;
+    std::vector<std::uint32_t> m_candidates;
+    std::vector<RouteMatch> m_window;
+};
+
+/**
+ *  Matches the fixes passing through the pipeline to a route and collects
+ *  the progress and transitions. Fixes are left untouched.
+ *
+ *  The matcher is owned by the caller so progress outlives the pipeline
+ *  being rebuilt, and carries on across a stop and restart of updates.
+ */
+class RouteMatcherStage : public Stage {
+public:
+    explicit RouteMatcherStage(RouteMatcher &matcher) : m_matcher(matcher) {}
+
+    void process(FixBuffer &fixes) override;
+    void reset() override;
+
+    RouteMatcher &matcher() { return m_matcher; }
+
+    /**
+     *  True once a fix processed since the last `takeProgress` was matched
+     */
+    bool hasProgress() const { return m_hasProgress; }
+
+    /**
+     *  The latest progress, clearing `hasProgress`
+     */
+    RouteProgress takeProgress() {
+        m_hasProgress = false;
+        return m_progress;
+    }
+
+    /**
+     *  Events collected since the last call, oldest first
+     */
+    std::vector<RouteEvent> &events() { return m_events; }
+
+private:
+    RouteMatcher &m_matcher;
+    RouteProgress m_progress{};
+    bool m_hasProgress = false;
+    std::vector<RouteEvent> m_events;
+};
+
+} // namespace oslocation
@@ -0,0 +1,51 @@
+//
+//  OSSIMD.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSSIMD.h"
+
+namespace oslocation {
+namespace simd {
+
+bool isSupported(Level level) {
+    switch (level) {
+        case Level::Scalar:
+            return true;
+        case Level::NEON:
+#if OS_SIMD_NEON
+            return true;
+#else
+            return false;
+#endif
+        case Level::AVX2:
+#if (defined(__x86_64__) || defined(__i386__)) && defined(OS_BUILD_AVX2_KERNELS)
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+Level bestLevel() {
+    static const Level level = isSupported(Level::AVX2) ? Level::AVX2 : isSupported(Level::NEON) ? Level::NEON : Level::Scalar;
+    return level;
+}
+
+const char *name(Level level) {
+    switch (level) {
+        case Level::Scalar:
+            return "scalar";
+        case Level::NEON:
+            return "neon";
+        case Level::AVX2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+} // namespace simd
+} // namespace oslocation
@@ -0,0 +1,176 @@
+//
+//  OSSIMD.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define OS_SIMD_AVX2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OS_SIMD_NEON 1
+#endif
+
+namespace oslocation {
+namespace simd {
+
+/**
+ *  Instruction sets the batch kernels are built for
+ */
+enum class Level {
+    Scalar,
+    NEON,
+    AVX2,
+};
+
+/**
+ *  The widest level supported by both the build and the CPU we are running on
+ */
+Level bestLevel();
+
+bool isSupported(Level level);
+
+const char *name(Level level);
+
+/**
+ *  Batch types share one interface so kernels can be written once as
+ *  templates: `load`, `store`, `broadcast`, arithmetic operators, `fma`,
+ *  `sqrt`, `round`, `floor`, comparisons producing a `Mask` and `select`.
+ */
+struct Scalar {
+    using Mask = bool;
+    static constexpr std::size_t width = 1;
+    double v;
+
+    static Scalar load(const double *p) { return {*p}; }
+    static Scalar broadcast(double x) { return {x}; }
+    void store(double *p) const { *p = v; }
+
+    friend Scalar operator+(Scalar a, Scalar b) { return {a.v + b.v}; }
+    friend Scalar operator-(Scalar a, Scalar b) { return {a.v - b.v}; }
+    friend Scalar operator*(Scalar a, Scalar b) { return {a.v * b.v}; }
+    friend Scalar operator/(Scalar a, Scalar b) { return {a.v / b.v}; }
+    friend Scalar operator-(Scalar a) { return {-a.v}; }
+    friend Scalar fma(Scalar a, Scalar b, Scalar c) { return {a.v * b.v + c.v}; }
+    friend Scalar sqrt(Scalar a) { return {std::sqrt(a.v)}; }
+    friend Scalar round(Scalar a) { return {std::nearbyint(a.v)}; }
+    friend Scalar floor(Scalar a) { return {std::floor(a.v)}; }
+    friend Scalar abs(Scalar a) { return {std::fabs(a.v)}; }
+    friend Scalar min(Scalar a, Scalar b) { return {a.v < b.v ? a.v : b.v}; }
+    friend Scalar max(Scalar a, Scalar b) { return {a.v > b.v ? a.v : b.v}; }
+    friend Mask operator<(Scalar a, Scalar b) { return a.v < b.v; }
+    friend Mask operator>(Scalar a, Scalar b) { return a.v > b.v; }
+    friend Mask operator==(Scalar a, Scalar b) { return a.v == b.v; }
+    friend Scalar select(Mask m, Scalar a, Scalar b) { return m ? a : b; }
+};
+
+#if OS_SIMD_AVX2
+struct AVX2 {
+    using Mask = __m256d;
+    static constexpr std::size_t width = 4;
+    __m256d v;
+
+    static AVX2 load(const double *p) { return {_mm256_loadu_pd(p)}; }
+    static AVX2 broadcast(double x) { return {_mm256_set1_pd(x)}; }
+    void store(double *p) const { _mm256_storeu_pd(p, v); }
+
+    friend AVX2 operator+(AVX2 a, AVX2 b) { return {_mm256_add_pd(a.v, b.v)}; }
+    friend AVX2 operator-(AVX2 a, AVX2 b) { return {_mm256_sub_pd(a.v, b.v)}; }
+    friend AVX2 operator*(AVX2 a, AVX2 b) { return {_mm256_mul_pd(a.v, b.v)}; }
+    friend AVX2 operator/(AVX2 a, AVX2 b) { return {_mm256_div_pd(a.v, b.v)}; }
+    friend AVX2 operator-(AVX2 a) { return {_mm256_xor_pd(a.v, _mm256_set1_pd(-0.0))}; }
+    friend AVX2 fma(AVX2 a, AVX2 b, AVX2 c) { return {_mm256_fmadd_pd(a.v, b.v, c.v)}; }
+    friend AVX2 sqrt(AVX2 a) { return {_mm256_sqrt_pd(a.v)}; }
+    friend AVX2 round(AVX2 a) { return {_mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+    friend AVX2 floor(AVX2 a) { return {_mm256_floor_pd(a.v)}; }
+    friend AVX2 abs(AVX2 a) { return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v)}; }
+    friend AVX2 min(AVX2 a, AVX2 b) { return {_mm256_min_pd(a.v, b.v)}; }
+    friend AVX2 max(AVX2 a, AVX2 b) { return {_mm256_max_pd(a.v, b.v)}; }
+    friend Mask operator<(AVX2 a, AVX2 b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+    friend Mask operator>(AVX2 a, AVX2 b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+    friend Mask operator==(AVX2 a, AVX2 b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+    friend AVX2 select(Mask m, AVX2 a, AVX2 b) { return {_mm256_blendv_pd(b.v, a.v, m)}; }
+};
+#endif
+
+#if OS_SIMD_NEON
+struct NEON {
+    using Mask = uint64x2_t;
+    static constexpr std::size_t width = 2;
+    float64x2_t v;
+
+    static NEON load(const double *p) { return {vld1q_f64(p)}; }
+    static NEON broadcast(double x) { return {vdupq_n_f64(x)}; }
+    void store(double *p) const { vst1q_f64(p, v); }
+
+    friend NEON operator+(NEON a, NEON b) { return {vaddq_f64(a.v, b.v)}; }
+    friend NEON operator-(NEON a, NEON b) { return {vsubq_f64(a.v, b.v)}; }
+    friend NEON operator*(NEON a, NEON b) { return {vmulq_f64(a.v, b.v)}; }
+    friend NEON operator/(NEON a, NEON b) { return {vdivq_f64(a.v, b.v)}; }
+    friend NEON operator-(NEON a) { return {vnegq_f64(a.v)}; }
+    friend NEON fma(NEON a, NEON b, NEON c) { return {vfmaq_f64(c.v, a.v, b.v)}; }
+    friend NEON sqrt(NEON a) { return {vsqrtq_f64(a.v)}; }
+    friend NEON round(NEON a) { return {vrndnq_f64(a.v)}; }
+    friend NEON floor(NEON a) { return {vrndmq_f64(a.v)}; }
+    friend NEON abs(NEON a) { return {vabsq_f64(a.v)}; }
+    friend NEON min(NEON a, NEON b) { return {vminq_f64(a.v, b.v)}; }
+    friend NEON max(NEON a, NEON b) { return {vmaxq_f64(a.v, b.v)}; }
+    friend Mask operator<(NEON a, NEON b) { return vcltq_f64(a.v, b.v); }
+    friend Mask operator>(NEON a, NEON b) { return vcgtq_f64(a.v, b.v); }
+    friend Mask operator==(NEON a, NEON b) { return vceqq_f64(a.v, b.v); }
+    friend NEON select(Mask m, NEON a, NEON b) { return {vbslq_f64(m, a.v, b.v)}; }
+};
+#endif
+
+/**
+ *  Sine and cosine of a batch of angles in radians, accurate to a couple of
+ *  ulp for |x| < 1e5. Cody-Waite reduction to [-π/4, π/4] followed by the
+ *  Cephes minimax polynomials.
+ */
+template <typename V>
+inline void sincos(V x, V &sine, V &cosine) {
+    const V quadrant = round(x * V::broadcast(0.63661977236758134308));
+    V r = fma(quadrant, V::broadcast(-1.57079632673412561417e+00), x);
+    r = fma(quadrant, V::broadcast(-6.07710050630396597660e-11), r);
+    r = fma(quadrant, V::broadcast(-2.02226624879595063154e-21), r);
+    const V z = r * r;
+
+    V sp = V::broadcast(1.58962301576546568060e-10);
+    sp = fma(sp, z, V::broadcast(-2.50507477628578072866e-8));
+    sp = fma(sp, z, V::broadcast(2.75573136213857245213e-6));
+    sp = fma(sp, z, V::broadcast(-1.98412698295895385996e-4));
+    sp = fma(sp, z, V::broadcast(8.33333333332211858878e-3));
+    sp = fma(sp, z, V::broadcast(-1.66666666666666307295e-1));
+    const V s = fma(r * z, sp, r);
+
+    V cp = V::broadcast(-1.13585365213876817300e-11);
+    cp = fma(cp, z, V::broadcast(2.08757008419747316778e-9));
+    cp = fma(cp, z, V::broadcast(-2.75573141792967388112e-7));
+    cp = fma(cp, z, V::broadcast(2.48015872888517045348e-5));
+    cp = fma(cp, z, V::broadcast(-1.38888888888730564116e-3));
+    cp = fma(cp, z, V::broadcast(4.16666666666665929218e-2));
+    const V c = fma(z * z, cp, fma(z, V::broadcast(-0.5), V::broadcast(1)));
+
+    // quadrant mod 4 selects which polynomial is the sine and its sign
+    const V q = quadrant - V::broadcast(4) * floor(quadrant * V::broadcast(0.25));
+    const auto odd = abs(abs(q - V::broadcast(2)) - V::broadcast(1)) < V::broadcast(0.5);
+    const auto sineNegative = q > V::broadcast(1.5);
+    const auto cosineNegative = abs(q - V::broadcast(1.5)) < V::broadcast(1);
+
+    const V swappedSine = select(odd, c, s);
+    const V swappedCosine = select(odd, s, c);
+    sine = select(sineNegative, -swappedSine, swappedSine);
+    cosine = select(cosineNegative, -swappedCosine, swappedCosine);
+}
+
+} // namespace simd
+} // namespace oslocation
@@ -0,0 +1,123 @@
+//
+//  OSStayPointDetector.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSStayPointDetector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oslocation {
+
+void StayPointDetector::process(FixBuffer &fixes) {
+    m_output.clear();
+    for (const Fix &fix : fixes) {
+        observe(fix, m_output);
+    }
+    fixes.swap(m_output);
+}
+
+void StayPointDetector::flush(FixBuffer &fixes) {
+    if (m_inStay) {
+        endStay();
+    }
+    // The stay has ended, so the fixes held at its edge are delivered
+    fixes.insert(fixes.end(), m_held.begin(), m_held.end());
+    m_held.clear();
+    m_hasCluster = false;
+}
+
+void StayPointDetector::reset() {
+    m_hasCluster = false;
+    m_inStay = false;
+    m_events.clear();
+    m_held.clear();
+}
+
+void StayPointDetector::startCluster(const Fix &fix) {
+    m_hasCluster = true;
+    m_frame.setOrigin(fix.latitude, fix.longitude);
+    m_sumEast = 0;
+    m_sumNorth = 0;
+    m_sumSquares = 0;
+    m_arrival = fix.timestamp;
+    m_latest = fix.timestamp;
+    m_count = 1;
+}
+
+StayPoint StayPointDetector::stayPoint() const {
+    const double east = m_sumEast / m_count;
+    const double north = m_sumNorth / m_count;
+    StayPoint stay;
+    m_frame.toGeodetic(east, north, stay.latitude, stay.longitude);
+    stay.spread = std::sqrt(std::max(0.0, m_sumSquares / m_count - east * east - north * north));
+    stay.arrival = m_arrival;
+    stay.departure = m_latest;
+    stay.fixCount = m_count;
+    return stay;
+}
+
+void StayPointDetector::endStay() {
+    m_events.push_back(StayEvent{StayEventType::Ended, stayPoint()});
+    m_inStay = false;
+}
+
+void StayPointDetector::observe(const Fix &fix, FixBuffer &output) {
+    // Invalid fixes are left for the outlier filter to deal with
+    if (!hasValidCoordinate(fix)) {
+        output.push_back(fix);
+        return;
+    }
+    if (!m_hasCluster) {
+        startCluster(fix);
+        output.push_back(fix);
+        return;
+    }
+
+    double east, north;
+    m_frame.toLocal(fix.latitude, fix.longitude, east, north);
+    const double fromCentre = std::hypot(east - m_sumEast / m_count, north - m_sumNorth / m_count);
+    if (m_inStay && fromCentre > m_options.radius) {
+        if (fromCentre <= std::max(m_options.departureRadius, fix.horizontalAccuracy)) {
+            if (m_held.size() == m_options.maximumHeldFixes) {
+                m_held.erase(m_held.begin());
+                m_suppressed++;
+            }
+            m_held.push_back(fix);
+            return;
+        }
+        endStay();
+        output.insert(output.end(), m_held.begin(), m_held.end());
+        m_held.clear();
+        startCluster(fix);
+        output.push_back(fix);
+        return;
+    }
+    if (!m_inStay && fromCentre > m_options.radius) {
+        startCluster(fix);
+        output.push_back(fix);
+        return;
+    }
+
+    m_sumEast += east;
+    m_sumNorth += north;
+    m_sumSquares += east * east + north * north;
+    m_latest = std::max(m_latest, fix.timestamp);
+    m_count++;
+    if (m_inStay) {
+        // Back inside, so the fixes held at the edge were noise
+        m_suppressed += m_held.size() + 1;
+        m_held.clear();
+        return;
+    }
+    output.push_back(fix);
+    if (m_latest - m_arrival >= m_options.minimumDuration) {
+        m_inStay = true;
+        m_events.push_back(StayEvent{StayEventType::Began, stayPoint()});
+    }
+}
+
+} // namespace oslocation
@@ -0,0 +1,129 @@
+//
+//  OSStayPointDetector.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSLocalFrame.h"
+#include "OSPipeline.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oslocation {
+
+struct StayPointOptions {
+    /**
+     *  Fixes within this many metres of the centre of the fixes since the
+     *  first of them belong to a candidate stay...
+     */
+    double radius = 30;
+    /**
+     *  ...which becomes a stay once it spans this many seconds
+     */
+    double minimumDuration = 120;
+    /**
+     *  A stay ends with the first fix further than this many metres from
+     *  its centre, or further than the fix's own accuracy if that is worse.
+     *  Fixes between `radius` and here are held back meanwhile and
+     *  delivered if the stay ends, so the start of the next leg is kept.
+     */
+    double departureRadius = 50;
+    /**
+     *  Most fixes held back between the two radii; older ones are dropped
+     */
+    std::size_t maximumHeldFixes = 64;
+};
+
+struct StayPoint {
+    /**
+     *  Mean position of the fixes in the stay
+     */
+    double latitude;
+    double longitude;
+    /**
+     *  Root mean square distance of the fixes from the centre in metres
+     */
+    double spread;
+    /**
+     *  Timestamps of the first and latest fix within the radius
+     */
+    double arrival;
+    double departure;
+    std::uint32_t fixCount;
+};
+
+enum class StayEventType {
+    /**
+     *  The user has been inside the radius for the minimum duration. Fixes
+     *  are dropped from here on until the stay ends.
+     */
+    Began,
+    Ended,
+};
+
+struct StayEvent {
+    StayEventType type;
+    StayPoint stay;
+};
+
+/**
+ *  Collapses stops into stay events. Fixes are clustered around the running
+ *  centre of the fixes since the cluster started; a cluster that stays
+ *  within the radius for the minimum duration becomes a stay. Fixes up to
+ *  that point are delivered as usual, so nothing is delayed, and every fix
+ *  within the radius after it is dropped until one lands outside the
+ *  departure radius, which ends the stay.
+ *
+ *  Each fix costs constant time; the cluster is kept as running sums in a
+ *  local frame at its first fix.
+ */
+class StayPointDetector : public Stage {
+public:
+    explicit StayPointDetector(const StayPointOptions &options = StayPointOptions()) : m_options(options) {}
+
+    void process(FixBuffer &fixes) override;
+
+    /**
+     *  Ends a stay in progress, since the source stopping means the stay
+     *  can no longer be observed, and appends the fixes held at its edge
+     */
+    void flush(FixBuffer &fixes) override;
+    void reset() override;
+
+    bool isInStay() const { return m_inStay; }
+
+    /**
+     *  Events collected since the last call, oldest first
+     */
+    std::vector<StayEvent> &events() { return m_events; }
+
+    /**
+     *  Fixes dropped because they fell inside a stay
+     */
+    std::uint64_t suppressedCount() const { return m_suppressed; }
+
+private:
+    void observe(const Fix &fix, FixBuffer &output);
+    void startCluster(const Fix &fix);
+    StayPoint stayPoint() const;
+    void endStay();
+
+    StayPointOptions m_options;
+    bool m_hasCluster = false;
+    bool m_inStay = false;
+    LocalFrame m_frame;
+    double m_sumEast = 0, m_sumNorth = 0, m_sumSquares = 0;
+    double m_arrival = 0, m_latest = 0;
+    std::uint32_t m_count = 0;
+    std::uint64_t m_suppressed = 0;
+    std::vector<StayEvent> m_events;
+    FixBuffer m_held;
+    FixBuffer m_output;
+};
+
+} // namespace oslocation
@@ -0,0 +1,123 @@
+//
+//  OSSubscriptionHub.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSSubscriptionHub.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace oslocation {
+
+SubscriptionId SubscriptionHub::subscribe(const SubscriptionOptions &options, Callback callback) {
+    const SubscriptionId id = m_nextId++;
+    Subscription subscription{id, true, options, std::move(callback), false, 0, 0, 0};
+    (m_publishing ? m_added : m_subscriptions).push_back(std::move(subscription));
+    m_count++;
+    return id;
+}
+
+bool SubscriptionHub::unsubscribe(SubscriptionId id) {
+    for (std::vector<Subscription> *list : {&m_subscriptions, &m_added}) {
+        for (Subscription &subscription : *list) {
+            if (subscription.id == id && subscription.active) {
+                subscription.active = false;
+                m_count--;
+                m_needsCompaction = true;
+                if (!m_publishing) {
+                    compact();
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SubscriptionHub::compact() {
+    m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(), [](const Subscription &subscription) { return !subscription.active; }), m_subscriptions.end());
+    for (Subscription &subscription : m_added) {
+        if (subscription.active) {
+            m_subscriptions.push_back(std::move(subscription));
+        }
+    }
+    m_added.clear();
+    m_needsCompaction = false;
+}
+
+bool SubscriptionHub::mergedSettings(LocationSettings &settings) const {
+    bool found = false;
+    for (const std::vector<Subscription> *list : {&m_subscriptions, &m_added}) {
+        for (const Subscription &subscription : *list) {
+            if (subscription.active) {
+                settings = found ? mergeSettings(settings, subscription.options.settings) : subscription.options.settings;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+void SubscriptionHub::publish(const FixBuffer &fixes) {
+    if (fixes.empty() || m_subscriptions.empty()) {
+        return;
+    }
+    // One frame per fix, shared by every subscriber's distance check
+    m_frames.resize(fixes.size());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        m_frames[i].setOrigin(fixes[i].latitude, fixes[i].longitude);
+    }
+
+    m_publishing = true;
+    const std::size_t count = m_subscriptions.size();
+    for (std::size_t s = 0; s < count; s++) {
+        Subscription &subscription = m_subscriptions[s];
+        if (!subscription.active) {
+            continue;
+        }
+        const SubscriptionOptions &options = subscription.options;
+        m_batch.clear();
+        for (std::size_t i = 0; i < fixes.size(); i++) {
+            const Fix &fix = fixes[i];
+            if (!hasValidCoordinate(fix) || fix.horizontalAccuracy > options.maximumAccuracy) {
+                continue;
+            }
+            if (subscription.hasLast) {
+                if (fix.timestamp - subscription.lastTimestamp < options.minimumInterval) {
+                    continue;
+                }
+                if (options.minimumDistance > 0) {
+                    double east, north;
+                    m_frames[i].toLocal(subscription.lastLatitude, subscription.lastLongitude, east, north);
+                    if (east * east + north * north < options.minimumDistance * options.minimumDistance) {
+                        continue;
+                    }
+                }
+            }
+            subscription.hasLast = true;
+            subscription.lastTimestamp = fix.timestamp;
+            subscription.lastLatitude = fix.latitude;
+            subscription.lastLongitude = fix.longitude;
+            m_batch.push_back(fix);
+        }
+        if (!m_batch.empty()) {
+            subscription.callback(m_batch);
+        }
+    }
+    m_publishing = false;
+    if (m_needsCompaction || !m_added.empty()) {
+        compact();
+    }
+}
+
+void SubscriptionHub::reset() {
+    for (Subscription &subscription : m_subscriptions) {
+        subscription.hasLast = false;
+    }
+}
+
+} // namespace oslocation
@@ -0,0 +1,114 @@
+//
+//  OSSubscriptionHub.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+#include "OSLocalFrame.h"
+#include "OSLocationSettings.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace oslocation {
+
+using SubscriptionId = std::uint32_t;
+
+struct SubscriptionOptions {
+    /**
+     *  What this subscriber needs from the shared location manager
+     */
+    LocationSettings settings = {LocationAccuracy::Best, 0, false};
+    /**
+     *  A fix is only delivered once it is this many metres from the last
+     *  fix delivered to this subscriber...
+     */
+    double minimumDistance = 0;
+    /**
+     *  ...and this many seconds after it
+     */
+    double minimumInterval = 0;
+    /**
+     *  Fixes with a worse horizontal accuracy in metres are not delivered
+     */
+    double maximumAccuracy = std::numeric_limits<double>::infinity();
+};
+
+/**
+ *  Fans the fixes from one location source out to many subscribers, each
+ *  with its own distance, interval and accuracy filter, and merges what the
+ *  subscribers need into one set of settings for the source.
+ *
+ *  Delivered fixes keep their `sourceIndex`, so a subscriber can map them
+ *  back to the objects they came from without copying those. Subscribing
+ *  and unsubscribing, including from inside a callback, are allowed; a
+ *  subscriber added during `publish` first hears from the next batch. Not
+ *  thread safe, and `publish` must not be called from a callback.
+ */
+class SubscriptionHub {
+public:
+    using Callback = std::function<void(const FixBuffer &fixes)>;
+
+    SubscriptionId subscribe(const SubscriptionOptions &options, Callback callback);
+
+    /**
+     *  @return false if there is no such subscription
+     */
+    bool unsubscribe(SubscriptionId id);
+
+    std::size_t subscriberCount() const { return m_count; }
+
+    /**
+     *  Combines the settings of every subscriber
+     *
+     *  @return false if there are no subscribers, when the source can stop
+     */
+    bool mergedSettings(LocationSettings &settings) const;
+
+    /**
+     *  Delivers `fixes` to every subscriber, each receiving the fixes that
+     *  pass its filters in one call if any do
+     */
+    void publish(const FixBuffer &fixes);
+
+    /**
+     *  Forgets the last fix delivered to each subscriber, so the next one
+     *  passes their distance and interval filters
+     */
+    void reset();
+
+private:
+    struct Subscription {
+        SubscriptionId id;
+        bool active;
+        SubscriptionOptions options;
+        Callback callback;
+        bool hasLast;
+        double lastTimestamp;
+        double lastLatitude;
+        double lastLongitude;
+    };
+
+    void compact();
+
+    std::vector<Subscription> m_subscriptions;
+    /**
+     *  Added during `publish`, so callbacks never move while running
+     */
+    std::vector<Subscription> m_added;
+    std::size_t m_count = 0;
+    SubscriptionId m_nextId = 1;
+    bool m_publishing = false;
+    bool m_needsCompaction = false;
+    std::vector<LocalFrame> m_frames;
+    FixBuffer m_batch;
+};
+
+} // namespace oslocation
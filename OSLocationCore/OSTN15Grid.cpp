@@ -0,0 +1,144 @@
+//
+//  OSTN15Grid.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTN15Grid.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace oslocation {
+
+namespace {
+
+const char kMagic[8] = {'O', 'S', 'T', 'N', '1', '5', 'G', '\0'};
+const std::uint32_t kVersion = 1;
+
+struct GridFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t columns;
+    std::uint32_t rows;
+    std::uint32_t spacing;
+    std::uint32_t nodeSize;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(GridFileHeader) == 32, "header is written as is");
+
+} // namespace
+
+bool OSTN15Grid::open(const std::string &path) {
+    MappedFile file;
+    if (!file.open(path) || file.size() < sizeof(GridFileHeader)) {
+        return false;
+    }
+    GridFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion || header.nodeSize != sizeof(OSTN15Node) || header.columns < 2 || header.rows < 2 || header.spacing == 0) {
+        return false;
+    }
+    if (file.size() < sizeof(GridFileHeader) + static_cast<std::size_t>(header.columns) * header.rows * sizeof(OSTN15Node)) {
+        return false;
+    }
+
+    m_storage.clear();
+    m_file = std::move(file);
+    m_nodes = reinterpret_cast<const OSTN15Node *>(m_file.data() + sizeof(GridFileHeader));
+    m_columns = header.columns;
+    m_rows = header.rows;
+    m_spacing = header.spacing;
+    m_inverseSpacing = 1.0 / header.spacing;
+    return true;
+}
+
+void OSTN15Grid::close() {
+    m_file.close();
+    m_storage.clear();
+    m_nodes = nullptr;
+    m_columns = 0;
+    m_rows = 0;
+}
+
+void OSTN15Grid::assign(std::vector<OSTN15Node> nodes, std::uint32_t columns, std::uint32_t rows, std::uint32_t spacing) {
+    m_file.close();
+    m_storage = std::move(nodes);
+    m_storage.resize(static_cast<std::size_t>(columns) * rows, OSTN15Node{0, 0, 0, 0});
+    m_nodes = m_storage.data();
+    m_columns = columns;
+    m_rows = rows;
+    m_spacing = spacing;
+    m_inverseSpacing = 1.0 / spacing;
+}
+
+bool OSTN15Grid::write(const std::string &path, const std::vector<OSTN15Node> &nodes, std::uint32_t columns, std::uint32_t rows, std::uint32_t spacing) {
+    if (nodes.size() != static_cast<std::size_t>(columns) * rows) {
+        return false;
+    }
+    FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    GridFileHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.columns = columns;
+    header.rows = rows;
+    header.spacing = spacing;
+    header.nodeSize = sizeof(OSTN15Node);
+    header.reserved = 0;
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   std::fwrite(nodes.data(), sizeof(OSTN15Node), nodes.size(), file) == nodes.size();
+    return std::fclose(file) == 0 && written;
+}
+
+bool OSTN15Grid::convertDataFile(const std::string &dataFilePath, const std::string &gridPath) {
+    std::ifstream input(dataFilePath);
+    if (!input) {
+        return false;
+    }
+    std::vector<OSTN15Node> nodes(static_cast<std::size_t>(kColumns) * kRows, OSTN15Node{0, 0, 0, 0});
+    std::vector<bool> seen(nodes.size(), false);
+    std::size_t count = 0;
+    std::string line;
+    while (std::getline(input, line)) {
+        // Point_ID,ETRS89_Easting,ETRS89_Northing,ETRS89_OSGB36_EShift,ETRS89_OSGB36_NShift,ETRS89_OSGM15_GeoidHeight,OSGM15_Datum_Flag
+        double values[7];
+        const char *cursor = line.c_str();
+        int field = 0;
+        for (; field < 7; field++) {
+            char *end;
+            values[field] = std::strtod(cursor, &end);
+            if (end == cursor) {
+                break;
+            }
+            cursor = *end == ',' ? end + 1 : end;
+        }
+        if (field != 7) {
+            continue;
+        }
+        const double column = values[1] / kSpacing;
+        const double row = values[2] / kSpacing;
+        if (column < 0 || row < 0 || column >= kColumns || row >= kRows) {
+            return false;
+        }
+        const std::size_t index = static_cast<std::size_t>(row) * kColumns + static_cast<std::size_t>(column);
+        nodes[index] = OSTN15Node{static_cast<float>(values[3]), static_cast<float>(values[4]), static_cast<float>(values[5]), static_cast<std::uint32_t>(values[6])};
+        if (!seen[index]) {
+            seen[index] = true;
+            count++;
+        }
+    }
+    if (count != nodes.size()) {
+        return false;
+    }
+    return write(gridPath, nodes, kColumns, kRows);
+}
+
+} // namespace oslocation
@@ -0,0 +1,137 @@
+//
+//  OSTN15Grid.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSMappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  One node of the OSTN15/OSGM15 grid: the ETRS89 to OSGB36 shifts and the
+ *  geoid height at a kilometre intersection
+ */
+struct OSTN15Node {
+    float eastShift;
+    float northShift;
+    float geoidHeight;
+    /**
+     *  OSGM15 vertical datum flag; 0 means the node is outside the geoid
+     *  model's coverage
+     */
+    std::uint32_t datum;
+};
+
+static_assert(sizeof(OSTN15Node) == 16, "nodes are read straight from the mapped file");
+
+/**
+ *  Interpolated shifts at a point
+ */
+struct OSTN15Shift {
+    double eastShift;
+    double northShift;
+    double geoidHeight;
+    bool hasGeoidHeight;
+};
+
+/**
+ *  The OSTN15 shift grid, either memory mapped from a file written by
+ *  `convertDataFile` or held in memory.
+ *
+ *  File layout (native byte order): a 32 byte header of the magic
+ *  `OSTN15G\0`, then uint32 version, columns, rows, spacing in metres, node
+ *  size and a reserved word; followed by `rows * columns` `OSTN15Node`s in
+ *  row major order starting at easting 0, northing 0.
+ */
+class OSTN15Grid {
+public:
+    static constexpr std::uint32_t kColumns = 701;
+    static constexpr std::uint32_t kRows = 1251;
+    static constexpr std::uint32_t kSpacing = 1000;
+
+    OSTN15Grid() = default;
+    OSTN15Grid(const OSTN15Grid &) = delete;
+    OSTN15Grid &operator=(const OSTN15Grid &) = delete;
+
+    /**
+     *  Maps a grid file
+     *
+     *  @return false if the file is missing, truncated or not a grid file
+     */
+    bool open(const std::string &path);
+
+    /**
+     *  Uses an in memory grid, mostly useful for tests
+     */
+    void assign(std::vector<OSTN15Node> nodes, std::uint32_t columns, std::uint32_t rows, std::uint32_t spacing = kSpacing);
+
+    /**
+     *  Unloads the grid
+     */
+    void close();
+
+    /**
+     *  Converts the published `OSTN15_OSGM15_DataFile.txt` into a grid file
+     */
+    static bool convertDataFile(const std::string &dataFilePath, const std::string &gridPath);
+
+    static bool write(const std::string &path, const std::vector<OSTN15Node> &nodes, std::uint32_t columns, std::uint32_t rows, std::uint32_t spacing = kSpacing);
+
+    bool isLoaded() const { return m_nodes != nullptr; }
+    std::uint32_t columns() const { return m_columns; }
+    std::uint32_t rows() const { return m_rows; }
+    std::uint32_t spacing() const { return m_spacing; }
+    const OSTN15Node &node(std::uint32_t column, std::uint32_t row) const { return m_nodes[static_cast<std::size_t>(row) * m_columns + column]; }
+
+    /**
+     *  Bilinearly interpolates the shifts at an ETRS89 easting and northing
+     *
+     *  @return false outside the grid
+     */
+    bool shift(double easting, double northing, OSTN15Shift &shift) const;
+
+private:
+    MappedFile m_file;
+    std::vector<OSTN15Node> m_storage;
+    const OSTN15Node *m_nodes = nullptr;
+    std::uint32_t m_columns = 0;
+    std::uint32_t m_rows = 0;
+    std::uint32_t m_spacing = kSpacing;
+    double m_inverseSpacing = 1.0 / kSpacing;
+};
+
+inline bool OSTN15Grid::shift(double easting, double northing, OSTN15Shift &shift) const {
+    const double x = easting * m_inverseSpacing;
+    const double y = northing * m_inverseSpacing;
+    // In doubles, so a grid with no nodes is out of bounds everywhere
+    if (!(x >= 0 && y >= 0 && x + 1 < m_columns && y + 1 < m_rows)) {
+        return false;
+    }
+    const std::uint32_t column = static_cast<std::uint32_t>(x);
+    const std::uint32_t row = static_cast<std::uint32_t>(y);
+    const double t = x - column;
+    const double u = y - row;
+    const OSTN15Node *lower = m_nodes + static_cast<std::size_t>(row) * m_columns + column;
+    const OSTN15Node *upper = lower + m_columns;
+
+    const double w0 = (1 - t) * (1 - u);
+    const double w1 = t * (1 - u);
+    const double w2 = t * u;
+    const double w3 = (1 - t) * u;
+    shift.eastShift = w0 * lower[0].eastShift + w1 * lower[1].eastShift + w2 * upper[1].eastShift + w3 * upper[0].eastShift;
+    shift.northShift = w0 * lower[0].northShift + w1 * lower[1].northShift + w2 * upper[1].northShift + w3 * upper[0].northShift;
+    shift.geoidHeight = w0 * lower[0].geoidHeight + w1 * lower[1].geoidHeight + w2 * upper[1].geoidHeight + w3 * upper[0].geoidHeight;
+    shift.hasGeoidHeight = lower[0].datum && lower[1].datum && upper[0].datum && upper[1].datum;
+    return true;
+}
+
+} // namespace oslocation
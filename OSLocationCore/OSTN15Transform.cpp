@@ -0,0 +1,48 @@
+//
+//  OSTN15Transform.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTN15Transform.h"
+#include "OSTransverseMercator.h"
+
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+constexpr TransverseMercator kETRS89Grid = nationalGridProjection(kGRS80);
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+} // namespace
+
+void OSTN15Transform::transform(const double *latitudes, const double *longitudes, const double *heights, std::size_t count, double *eastings, double *northings, double *orthometricHeights, simd::Level level) const {
+    projectTransverseMercator(kETRS89Grid, latitudes, longitudes, count, eastings, northings, level);
+    for (std::size_t i = 0; i < count; i++) {
+        OSTN15Shift shift;
+        if (m_grid.shift(eastings[i], northings[i], shift)) {
+            eastings[i] += shift.eastShift;
+            northings[i] += shift.northShift;
+            if (orthometricHeights) {
+                orthometricHeights[i] = shift.hasGeoidHeight && heights ? heights[i] - shift.geoidHeight : kNaN;
+            }
+        } else {
+            eastings[i] = kNaN;
+            northings[i] = kNaN;
+            if (orthometricHeights) {
+                orthometricHeights[i] = kNaN;
+            }
+        }
+    }
+}
+
+GridPosition OSTN15Transform::transform(double latitude, double longitude, double height) const {
+    GridPosition position;
+    transform(&latitude, &longitude, &height, 1, &position.easting, &position.northing, &position.height, simd::Level::Scalar);
+    return position;
+}
+
+} // namespace oslocation
@@ -0,0 +1,43 @@
+//
+//  OSTN15Transform.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSNationalGrid.h"
+#include "OSSIMD.h"
+#include "OSTN15Grid.h"
+
+#include <cstddef>
+
+namespace oslocation {
+
+/**
+ *  Precise ETRS89 (WGS84 as delivered by GNSS) to OSGB36 National Grid and
+ *  OSGM15 height conversion using the OSTN15 shift grid.
+ *
+ *  Points are projected to ETRS89 grid coordinates on GRS80 with the batch
+ *  Transverse Mercator kernel, then shifted by the bilinearly interpolated
+ *  grid values. Points outside the grid come back as NaN.
+ */
+class OSTN15Transform {
+public:
+    explicit OSTN15Transform(const OSTN15Grid &grid) : m_grid(grid) {}
+
+    /**
+     *  Converts a batch held as separate arrays. `heights` and
+     *  `orthometricHeights` may be null when heights are not needed; the
+     *  output arrays may not alias the inputs.
+     */
+    void transform(const double *latitudes, const double *longitudes, const double *heights, std::size_t count, double *eastings, double *northings, double *orthometricHeights, simd::Level level = simd::bestLevel()) const;
+
+    GridPosition transform(double latitude, double longitude, double height) const;
+
+private:
+    const OSTN15Grid &m_grid;
+};
+
+} // namespace oslocation
@@ -0,0 +1,337 @@
+//
+//  OSTrackFile.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackFile.h"
+#include "OSGPXReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace oslocation {
+
+namespace {
+
+struct TrackFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t blockCount;
+    std::uint64_t pointCount;
+    std::uint64_t indexOffset;
+};
+static_assert(sizeof(TrackFileHeader) == 32, "TrackFileHeader is written to disk as is");
+
+constexpr std::int64_t kMissing = std::numeric_limits<std::int64_t>::min();
+
+enum Field { FieldTime, FieldLatitude, FieldLongitude, FieldAltitude, FieldHorizontalAccuracy, FieldVerticalAccuracy, FieldCount };
+
+std::int64_t encodeAccuracy(double accuracy) {
+    return accuracy >= 0 ? std::llround(accuracy * 10) : kMissing;
+}
+
+double decodeAccuracy(std::int64_t value) {
+    return value == kMissing ? -1 : value / 10.0;
+}
+
+void appendVarint(std::string &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+inline bool readVarint(const unsigned char *&p, const unsigned char *end, std::uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        const unsigned char byte = *p++;
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Differences are taken modulo 2^64 so the sentinels need no special cases
+inline std::uint64_t zigzag(std::int64_t previous, std::int64_t value) {
+    const auto delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(previous));
+    return (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+}
+
+inline std::int64_t unzigzag(std::int64_t previous, std::uint64_t encoded) {
+    const std::uint64_t delta = (encoded >> 1) ^ (~(encoded & 1) + 1);
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(previous) + delta);
+}
+
+} // namespace
+
+
+TrackFileWriter::~TrackFileWriter() {
+    close();
+}
+
+bool TrackFileWriter::open(const std::string &path, std::uint32_t pointsPerBlock) {
+    close();
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        return false;
+    }
+    m_failed = false;
+    m_pointsPerBlock = std::max<std::uint32_t>(pointsPerBlock, 1);
+    m_pointCount = 0;
+    m_index.clear();
+    m_block.clear();
+    m_current = TrackBlock{};
+
+    // Placeholder header, rewritten by close
+    const TrackFileHeader header = {};
+    m_failed = std::fwrite(&header, sizeof(header), 1, m_file) != 1;
+    m_offset = sizeof(header);
+    return !m_failed;
+}
+
+bool TrackFileWriter::append(const Fix &fix) {
+    if (!m_file) {
+        return false;
+    }
+    if (m_current.pointCount == 0) {
+        std::fill(std::begin(m_previous), std::end(m_previous), 0);
+        m_current.minLatitude = m_current.minLongitude = std::numeric_limits<std::int32_t>::max();
+        m_current.maxLatitude = m_current.maxLongitude = std::numeric_limits<std::int32_t>::min();
+        m_current.startTime = std::numeric_limits<std::int64_t>::max();
+        m_current.endTime = std::numeric_limits<std::int64_t>::min();
+    }
+
+    const std::int32_t latitude = trackfile::toFixedPoint(fix.latitude);
+    const std::int32_t longitude = trackfile::toFixedPoint(fix.longitude);
+    const std::int64_t values[FieldCount] = {
+        fix.timestamp == fix.timestamp ? std::llround(fix.timestamp * 1000) : kMissing,
+        latitude,
+        longitude,
+        fix.verticalAccuracy >= 0 ? std::llround(fix.altitude * 100) : kMissing,
+        encodeAccuracy(fix.horizontalAccuracy),
+        encodeAccuracy(fix.verticalAccuracy)};
+    for (int field = 0; field < FieldCount; field++) {
+        appendVarint(m_block, zigzag(m_previous[field], values[field]));
+        m_previous[field] = values[field];
+    }
+
+    m_current.minLatitude = std::min(m_current.minLatitude, latitude);
+    m_current.maxLatitude = std::max(m_current.maxLatitude, latitude);
+    m_current.minLongitude = std::min(m_current.minLongitude, longitude);
+    m_current.maxLongitude = std::max(m_current.maxLongitude, longitude);
+    if (values[FieldTime] != kMissing) {
+        m_current.startTime = std::min(m_current.startTime, values[FieldTime]);
+        m_current.endTime = std::max(m_current.endTime, values[FieldTime]);
+    }
+    m_pointCount++;
+    if (++m_current.pointCount == m_pointsPerBlock) {
+        return flushBlock();
+    }
+    return true;
+}
+
+bool TrackFileWriter::flushBlock() {
+    if (m_current.pointCount == 0) {
+        return true;
+    }
+    m_current.offset = m_offset;
+    m_current.size = static_cast<std::uint32_t>(m_block.size());
+    if (std::fwrite(m_block.data(), 1, m_block.size(), m_file) != m_block.size()) {
+        m_failed = true;
+    }
+    m_offset += m_block.size();
+    m_index.push_back(m_current);
+    m_block.clear();
+    m_current = TrackBlock{};
+    return !m_failed;
+}
+
+bool TrackFileWriter::close() {
+    if (!m_file) {
+        return false;
+    }
+    flushBlock();
+
+    // Pad so the mapped index is aligned
+    static const char padding[alignof(TrackBlock)] = {};
+    const std::size_t paddingSize = (alignof(TrackBlock) - m_offset % alignof(TrackBlock)) % alignof(TrackBlock);
+    if (std::fwrite(padding, 1, paddingSize, m_file) != paddingSize) {
+        m_failed = true;
+    }
+    m_offset += paddingSize;
+
+    TrackFileHeader header;
+    std::memcpy(header.magic, trackfile::kMagic, sizeof(header.magic));
+    header.version = trackfile::kVersion;
+    header.blockCount = static_cast<std::uint32_t>(m_index.size());
+    header.pointCount = m_pointCount;
+    header.indexOffset = m_offset;
+    if (!m_index.empty() && std::fwrite(m_index.data(), sizeof(TrackBlock), m_index.size(), m_file) != m_index.size()) {
+        m_failed = true;
+    }
+    if (std::fseek(m_file, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, m_file) != 1) {
+        m_failed = true;
+    }
+    if (std::fclose(m_file) != 0) {
+        m_failed = true;
+    }
+    m_file = nullptr;
+    return !m_failed;
+}
+
+
+bool TrackFile::open(const std::string &path) {
+    close();
+    MappedFile file;
+    if (!file.open(path) || file.size() < sizeof(TrackFileHeader)) {
+        return false;
+    }
+    TrackFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, trackfile::kMagic, sizeof(header.magic)) != 0 || header.version != trackfile::kVersion) {
+        return false;
+    }
+    if (header.indexOffset < sizeof(header) || header.indexOffset % alignof(TrackBlock) != 0 || header.indexOffset > file.size() || (file.size() - header.indexOffset) / sizeof(TrackBlock) < header.blockCount) {
+        return false;
+    }
+    const auto *index = reinterpret_cast<const TrackBlock *>(file.data() + header.indexOffset);
+    std::vector<std::uint64_t> firstPoint(header.blockCount);
+    std::uint64_t points = 0;
+    bool timeOrdered = true;
+    for (std::uint32_t i = 0; i < header.blockCount; i++) {
+        if (index[i].offset < sizeof(header) || index[i].offset > header.indexOffset || index[i].size > header.indexOffset - index[i].offset) {
+            return false;
+        }
+        // Every point takes at least a byte for each field
+        if (static_cast<std::uint64_t>(index[i].pointCount) * FieldCount > index[i].size) {
+            return false;
+        }
+        firstPoint[i] = points;
+        points += index[i].pointCount;
+        timeOrdered = timeOrdered && index[i].startTime <= index[i].endTime && (i == 0 || index[i - 1].endTime <= index[i].startTime);
+    }
+    if (points != header.pointCount) {
+        return false;
+    }
+
+    m_file = std::move(file);
+    m_index = index;
+    m_blockCount = header.blockCount;
+    m_pointCount = header.pointCount;
+    m_firstPoint = std::move(firstPoint);
+    m_timeOrdered = timeOrdered;
+    return true;
+}
+
+void TrackFile::close() {
+    m_file.close();
+    m_index = nullptr;
+    m_blockCount = 0;
+    m_pointCount = 0;
+    m_firstPoint.clear();
+    m_timeOrdered = false;
+}
+
+bool TrackFile::decodeBlock(std::uint32_t index, FixBuffer &fixes) const {
+    const TrackBlock &block = m_index[index];
+    const auto *p = reinterpret_cast<const unsigned char *>(m_file.data() + block.offset);
+    const unsigned char *end = p + block.size;
+    std::int64_t values[FieldCount] = {};
+    const std::size_t start = fixes.size();
+    fixes.resize(start + block.pointCount);
+    for (std::uint32_t i = 0; i < block.pointCount; i++) {
+        for (int field = 0; field < FieldCount; field++) {
+            std::uint64_t encoded;
+            if (!readVarint(p, end, encoded)) {
+                fixes.resize(start);
+                return false;
+            }
+            values[field] = unzigzag(values[field], encoded);
+        }
+        Fix &fix = fixes[start + i];
+        fix = makeFix(values[FieldTime] == kMissing ? std::numeric_limits<double>::quiet_NaN() : values[FieldTime] / 1000.0,
+                      trackfile::fromFixedPoint(static_cast<std::int32_t>(values[FieldLatitude])),
+                      trackfile::fromFixedPoint(static_cast<std::int32_t>(values[FieldLongitude])),
+                      values[FieldAltitude] == kMissing ? 0 : values[FieldAltitude] / 100.0);
+        fix.horizontalAccuracy = decodeAccuracy(values[FieldHorizontalAccuracy]);
+        fix.verticalAccuracy = decodeAccuracy(values[FieldVerticalAccuracy]);
+        fix.sourceIndex = static_cast<std::int32_t>(m_firstPoint[index] + i);
+    }
+    return true;
+}
+
+bool TrackFile::readAll(FixBuffer &fixes) const {
+    fixes.reserve(fixes.size() + m_pointCount);
+    for (std::uint32_t i = 0; i < m_blockCount; i++) {
+        if (!decodeBlock(i, fixes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TrackFile::readTimeRange(double start, double end, FixBuffer &fixes) const {
+    const auto startTime = static_cast<std::int64_t>(std::floor(start * 1000));
+    const auto endTime = static_cast<std::int64_t>(std::ceil(end * 1000));
+    std::uint32_t first = 0, last = m_blockCount;
+    if (m_timeOrdered) {
+        // Blocks follow each other in time, so only those from the last one
+        // starting by `start` to the last one starting by `end` can match
+        const auto startsAfter = [](std::int64_t time, const TrackBlock &block) { return time < block.startTime; };
+        const TrackBlock *lower = std::upper_bound(m_index, m_index + m_blockCount, startTime, startsAfter);
+        first = lower == m_index ? 0 : static_cast<std::uint32_t>(lower - m_index - 1);
+        last = static_cast<std::uint32_t>(std::upper_bound(lower, m_index + m_blockCount, endTime, startsAfter) - m_index);
+    }
+    for (std::uint32_t i = first; i < last; i++) {
+        if (m_index[i].endTime < startTime || m_index[i].startTime > endTime) {
+            continue;
+        }
+        const std::size_t appendedFrom = fixes.size();
+        if (!decodeBlock(i, fixes)) {
+            return false;
+        }
+        fixes.erase(std::remove_if(fixes.begin() + appendedFrom, fixes.end(), [start, end](const Fix &fix) { return !(fix.timestamp >= start && fix.timestamp <= end); }), fixes.end());
+    }
+    return true;
+}
+
+bool TrackFile::readBoundingBox(double minLatitude, double minLongitude, double maxLatitude, double maxLongitude, FixBuffer &fixes) const {
+    const std::int32_t south = trackfile::toFixedPoint(minLatitude), north = trackfile::toFixedPoint(maxLatitude);
+    const std::int32_t west = trackfile::toFixedPoint(minLongitude), east = trackfile::toFixedPoint(maxLongitude);
+    for (std::uint32_t i = 0; i < m_blockCount; i++) {
+        const TrackBlock &block = m_index[i];
+        if (block.maxLatitude < south || block.minLatitude > north || block.maxLongitude < west || block.minLongitude > east) {
+            continue;
+        }
+        const std::size_t appendedFrom = fixes.size();
+        if (!decodeBlock(i, fixes)) {
+            return false;
+        }
+        fixes.erase(std::remove_if(fixes.begin() + appendedFrom, fixes.end(), [=](const Fix &fix) {
+            const std::int32_t latitude = trackfile::toFixedPoint(fix.latitude), longitude = trackfile::toFixedPoint(fix.longitude);
+            return latitude < south || latitude > north || longitude < west || longitude > east;
+        }), fixes.end());
+    }
+    return true;
+}
+
+
+bool convertGPXToTrackFile(const std::string &gpxPath, const std::string &trackPath, double horizontalAccuracy) {
+    TrackFileWriter writer;
+    if (!writer.open(trackPath)) {
+        return false;
+    }
+    bool written = true;
+    const GPXResult result = GPXReader::readFile(gpxPath, [&](const GPXPoint &point) {
+        written = writer.append(makeFix(point, horizontalAccuracy)) && written;
+    });
+    return writer.close() && written && result.status == GPXStatus::Ok;
+}
+
+} // namespace oslocation
@@ -0,0 +1,174 @@
+//
+//  OSTrackFile.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+#include "OSMappedFile.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  Index entry describing one block of a track file. Coordinates are in
+ *  units of 1e-7 degrees and times in milliseconds since 1970; a block
+ *  without timestamps has `startTime` > `endTime`.
+ */
+struct TrackBlock {
+    std::uint64_t offset;
+    std::uint32_t size;
+    std::uint32_t pointCount;
+    std::int32_t minLatitude;
+    std::int32_t minLongitude;
+    std::int32_t maxLatitude;
+    std::int32_t maxLongitude;
+    std::int64_t startTime;
+    std::int64_t endTime;
+};
+static_assert(sizeof(TrackBlock) == 48, "TrackBlock is written to disk as is");
+
+/**
+ *  Compact binary track file.
+ *
+ *  Layout (native byte order): a 32 byte header of the magic `OSTRACK\0`,
+ *  uint32 version, uint32 block count, uint64 point count and uint64 offset
+ *  of the block index; the encoded blocks; then, 8 byte aligned, the index
+ *  of one `TrackBlock` per block.
+ *
+ *  Each point stores its time (ms), latitude and longitude (1e-7 degrees),
+ *  altitude (cm) and horizontal and vertical accuracy (dm), each as the
+ *  zig-zag varint of the difference from the previous point in the block.
+ *  The first point of a block is relative to zero, so blocks decode on
+ *  their own. Missing times and altitudes are stored as sentinels; speed
+ *  and course are not stored.
+ */
+namespace trackfile {
+
+constexpr char kMagic[8] = {'O', 'S', 'T', 'R', 'A', 'C', 'K', '\0'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::uint32_t kDefaultPointsPerBlock = 1024;
+
+/**
+ *  Coordinate in the file's fixed point units
+ */
+inline std::int32_t toFixedPoint(double degrees) {
+    return static_cast<std::int32_t>(std::llround(degrees * 1e7));
+}
+
+inline double fromFixedPoint(std::int32_t value) {
+    return value * 1e-7;
+}
+
+} // namespace trackfile
+
+/**
+ *  Writes fixes to a track file block by block
+ */
+class TrackFileWriter {
+public:
+    TrackFileWriter() = default;
+    ~TrackFileWriter();
+    TrackFileWriter(const TrackFileWriter &) = delete;
+    TrackFileWriter &operator=(const TrackFileWriter &) = delete;
+
+    bool open(const std::string &path, std::uint32_t pointsPerBlock = trackfile::kDefaultPointsPerBlock);
+
+    /**
+     *  Appends a fix. Fixes should be appended in chronological order for
+     *  time lookups to skip blocks effectively.
+     */
+    bool append(const Fix &fix);
+
+    /**
+     *  Writes the last block and the index
+     *
+     *  @return false if any write failed
+     */
+    bool close();
+
+private:
+    bool flushBlock();
+
+    std::FILE *m_file = nullptr;
+    bool m_failed = false;
+    std::uint32_t m_pointsPerBlock = trackfile::kDefaultPointsPerBlock;
+    std::uint64_t m_offset = 0;
+    std::uint64_t m_pointCount = 0;
+    std::string m_block;
+    TrackBlock m_current = {};
+    std::int64_t m_previous[6] = {};
+    std::vector<TrackBlock> m_index;
+};
+
+/**
+ *  Memory mapped reader for track files. Lookups by time or area consult
+ *  the block index and only decode the blocks that can match.
+ */
+class TrackFile {
+public:
+    TrackFile() = default;
+
+    /**
+     *  @return false if the file is missing, truncated or not a track file
+     */
+    bool open(const std::string &path);
+    void close();
+
+    bool isOpen() const { return m_index != nullptr; }
+    std::uint64_t pointCount() const { return m_pointCount; }
+    std::uint32_t blockCount() const { return m_blockCount; }
+    const TrackBlock &block(std::uint32_t index) const { return m_index[index]; }
+    std::size_t fileSize() const { return m_file.size(); }
+
+    /**
+     *  Appends the fixes of one block. `sourceIndex` is set to the fix's
+     *  position in the file.
+     *
+     *  @return false if the block is corrupt
+     */
+    bool decodeBlock(std::uint32_t index, FixBuffer &fixes) const;
+
+    bool readAll(FixBuffer &fixes) const;
+
+    /**
+     *  Appends the fixes with timestamps in [start, end]. Binary searches
+     *  the index when the blocks are in time order, and scans it otherwise.
+     */
+    bool readTimeRange(double start, double end, FixBuffer &fixes) const;
+
+    /**
+     *  Appends the fixes inside the box, given in degrees
+     */
+    bool readBoundingBox(double minLatitude, double minLongitude, double maxLatitude, double maxLongitude, FixBuffer &fixes) const;
+
+private:
+    MappedFile m_file;
+    const TrackBlock *m_index = nullptr;
+    std::uint32_t m_blockCount = 0;
+    std::uint64_t m_pointCount = 0;
+    std::vector<std::uint64_t> m_firstPoint;
+    /**
+     *  True if every block has timestamps and starts no earlier than the
+     *  one before it ends, so time lookups can binary search the index
+     */
+    bool m_timeOrdered = false;
+};
+
+/**
+ *  Converts a GPX file to a track file. GPX carries no accuracy, so every
+ *  fix gets `horizontalAccuracy`.
+ *
+ *  @return false if the GPX is malformed or either file cannot be used
+ */
+bool convertGPXToTrackFile(const std::string &gpxPath, const std::string &trackPath, double horizontalAccuracy = 5);
+
+} // namespace oslocation
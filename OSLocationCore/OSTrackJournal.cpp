@@ -0,0 +1,322 @@
+//
+//  OSTrackJournal.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackJournal.h"
+#include "OSMappedFile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+namespace oslocation {
+
+namespace {
+
+struct JournalHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+};
+static_assert(sizeof(JournalHeader) == journal::kHeaderSize, "JournalHeader is written to disk as is");
+
+constexpr std::size_t kChecksummedBytes = offsetof(JournalRecord, checksum);
+
+using CRCTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+// Slicing-by-8: table k gives the CRC of a byte followed by k zero bytes
+constexpr CRCTables makeCRCTables() {
+    CRCTables tables{};
+    for (std::uint32_t byte = 0; byte < 256; byte++) {
+        std::uint32_t crc = byte;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0x82f63b78u & (~(crc & 1) + 1));
+        }
+        tables[0][byte] = crc;
+    }
+    for (std::size_t k = 1; k < 8; k++) {
+        for (std::size_t byte = 0; byte < 256; byte++) {
+            tables[k][byte] = (tables[k - 1][byte] >> 8) ^ tables[0][tables[k - 1][byte] & 0xff];
+        }
+    }
+    return tables;
+}
+
+constexpr CRCTables kCRCTables = makeCRCTables();
+
+bool writeFully(int descriptor, const void *data, std::size_t size) {
+    const char *bytes = static_cast<const char *>(data);
+    while (size > 0) {
+        const ssize_t written = ::write(descriptor, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+/**
+ *  Flushes to storage. On Apple platforms `fsync` only reaches the drive's
+ *  cache, so a full flush is asked for first.
+ */
+bool syncDescriptor(int descriptor) {
+#if defined(__APPLE__)
+    if (fcntl(descriptor, F_FULLFSYNC) == 0) {
+        return true;
+    }
+#endif
+    return fsync(descriptor) == 0;
+}
+
+JournalHeader makeHeader() {
+    JournalHeader header = {};
+    std::memcpy(header.magic, journal::kMagic, sizeof(header.magic));
+    header.version = journal::kVersion;
+    header.recordSize = sizeof(JournalRecord);
+    return header;
+}
+
+} // namespace
+
+namespace journal {
+
+std::uint32_t crc32c(const void *data, std::size_t size, std::uint32_t crc) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    crc = ~crc;
+    while (size >= 8) {
+        std::uint32_t low, high;
+        std::memcpy(&low, bytes, 4);
+        std::memcpy(&high, bytes + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        low = __builtin_bswap32(low);
+        high = __builtin_bswap32(high);
+#endif
+        low ^= crc;
+        crc = kCRCTables[7][low & 0xff] ^ kCRCTables[6][(low >> 8) & 0xff] ^ kCRCTables[5][(low >> 16) & 0xff] ^ kCRCTables[4][low >> 24] ^
+              kCRCTables[3][high & 0xff] ^ kCRCTables[2][(high >> 8) & 0xff] ^ kCRCTables[1][(high >> 16) & 0xff] ^ kCRCTables[0][high >> 24];
+        bytes += 8;
+        size -= 8;
+    }
+    while (size-- > 0) {
+        crc = (crc >> 8) ^ kCRCTables[0][(crc ^ *bytes++) & 0xff];
+    }
+    return ~crc;
+}
+
+JournalRecord encode(const Fix &fix) {
+    JournalRecord record = {};
+    record.timestamp = fix.timestamp;
+    record.latitude = fix.latitude;
+    record.longitude = fix.longitude;
+    record.altitude = static_cast<float>(fix.altitude);
+    record.horizontalAccuracy = static_cast<float>(fix.horizontalAccuracy);
+    record.verticalAccuracy = static_cast<float>(fix.verticalAccuracy);
+    record.speed = static_cast<float>(fix.speed);
+    record.course = static_cast<float>(fix.course);
+    record.checksum = crc32c(&record, kChecksummedBytes);
+    return record;
+}
+
+bool decode(const JournalRecord &record, Fix &fix) {
+    if (crc32c(&record, kChecksummedBytes) != record.checksum) {
+        return false;
+    }
+    fix = makeFix(record.timestamp, record.latitude, record.longitude, record.altitude);
+    fix.horizontalAccuracy = record.horizontalAccuracy;
+    fix.verticalAccuracy = record.verticalAccuracy;
+    fix.speed = record.speed;
+    fix.course = record.course;
+    return true;
+}
+
+} // namespace journal
+
+bool recoverTrackJournal(const std::string &path, FixBuffer *fixes, JournalRecovery &recovery) {
+    recovery = JournalRecovery();
+    const int descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(descriptor, &info) != 0) {
+        ::close(descriptor);
+        return false;
+    }
+    const auto size = static_cast<std::uint64_t>(info.st_size);
+
+    // Killed while creating the journal, if what there is of the header
+    // matches; any other short file is not a journal
+    if (size < journal::kHeaderSize) {
+        const JournalHeader header = makeHeader();
+        char written[journal::kHeaderSize];
+        if (pread(descriptor, written, size, 0) != static_cast<ssize_t>(size) || std::memcmp(written, &header, size) != 0) {
+            ::close(descriptor);
+            errno = EINVAL;
+            return false;
+        }
+        const bool created = ftruncate(descriptor, 0) == 0 && writeFully(descriptor, &header, sizeof(header)) && syncDescriptor(descriptor);
+        recovery.truncatedBytes = size;
+        ::close(descriptor);
+        return created;
+    }
+
+    MappedFile file;
+    if (!file.open(path)) {
+        ::close(descriptor);
+        return false;
+    }
+    JournalHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, journal::kMagic, sizeof(header.magic)) != 0 || header.version != journal::kVersion || header.recordSize != sizeof(JournalRecord)) {
+        ::close(descriptor);
+        errno = EINVAL;
+        return false;
+    }
+
+    const std::uint64_t available = (size - journal::kHeaderSize) / sizeof(JournalRecord);
+    if (fixes) {
+        fixes->reserve(fixes->size() + available);
+    }
+    const char *records = file.data() + journal::kHeaderSize;
+    std::uint64_t count = 0;
+    for (; count < available; count++) {
+        JournalRecord record;
+        std::memcpy(&record, records + count * sizeof(JournalRecord), sizeof(record));
+        Fix fix;
+        if (!journal::decode(record, fix)) {
+            break;
+        }
+        if (fixes) {
+            fix.sourceIndex = static_cast<std::int32_t>(count);
+            fixes->push_back(fix);
+        }
+    }
+    file.close();
+
+    const std::uint64_t intact = journal::kHeaderSize + count * sizeof(JournalRecord);
+    bool recovered = true;
+    if (intact < size) {
+        recovered = ftruncate(descriptor, static_cast<off_t>(intact)) == 0 && syncDescriptor(descriptor);
+    }
+    recovery.recordCount = count;
+    recovery.truncatedBytes = size - intact;
+    ::close(descriptor);
+    return recovered;
+}
+
+TrackJournalWriter::TrackJournalWriter(Clock &clock, const TrackJournalOptions &options) : m_clock(clock), m_options(options) {
+    m_options.maximumBatch = std::max<std::size_t>(m_options.maximumBatch, 1);
+}
+
+TrackJournalWriter::~TrackJournalWriter() {
+    close();
+}
+
+bool TrackJournalWriter::open(const std::string &path, FixBuffer *recovered) {
+    close();
+    if (!recoverTrackJournal(path, recovered, m_recovery)) {
+        return false;
+    }
+    m_descriptor = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (m_descriptor < 0) {
+        return false;
+    }
+    m_failed = false;
+    m_pending.clear();
+    m_pending.reserve(m_options.maximumBatch);
+    m_lastSync = m_clock.now();
+    m_unsynced = false;
+    m_writtenCount = m_recovery.recordCount;
+    m_writeCount = 0;
+    m_syncCount = 0;
+    return true;
+}
+
+bool TrackJournalWriter::append(const Fix &fix) {
+    if (!isOpen() || m_failed) {
+        return false;
+    }
+    const double now = m_clock.now();
+    if (m_pending.empty()) {
+        m_pendingSince = now;
+    }
+    m_pending.push_back(journal::encode(fix));
+    if (m_pending.size() >= m_options.maximumBatch || now - m_pendingSince >= m_options.commitInterval) {
+        return commit();
+    }
+    return true;
+}
+
+bool TrackJournalWriter::flush() {
+    if (m_pending.empty()) {
+        return true;
+    }
+    if (!writeFully(m_descriptor, m_pending.data(), m_pending.size() * sizeof(JournalRecord))) {
+        // Cut off whatever part of the batch did land, so later records are
+        // not stranded behind a torn one
+        m_failed = true;
+        (void)ftruncate(m_descriptor, static_cast<off_t>(journal::kHeaderSize + m_writtenCount * sizeof(JournalRecord)));
+        return false;
+    }
+    m_writtenCount += m_pending.size();
+    m_writeCount++;
+    m_pending.clear();
+    m_unsynced = true;
+    return true;
+}
+
+bool TrackJournalWriter::commit() {
+    if (!isOpen() || m_failed) {
+        return false;
+    }
+    if (!flush()) {
+        return false;
+    }
+    if (m_unsynced && m_options.syncInterval >= 0 && m_clock.now() - m_lastSync >= m_options.syncInterval) {
+        return sync();
+    }
+    return true;
+}
+
+bool TrackJournalWriter::sync() {
+    if (!isOpen() || m_failed || !flush()) {
+        return false;
+    }
+    if (m_unsynced) {
+        if (!syncDescriptor(m_descriptor)) {
+            m_failed = true;
+            return false;
+        }
+        m_syncCount++;
+        m_unsynced = false;
+    }
+    m_lastSync = m_clock.now();
+    return true;
+}
+
+bool TrackJournalWriter::close() {
+    if (!isOpen()) {
+        return true;
+    }
+    const bool written = m_options.syncInterval >= 0 ? sync() : (!m_failed && flush());
+    ::close(m_descriptor);
+    m_descriptor = -1;
+    m_pending.clear();
+    return written;
+}
+
+} // namespace oslocation
@@ -0,0 +1,186 @@
+//
+//  OSTrackJournal.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSClock.h"
+#include "OSFix.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  One fix as stored in a journal. The checksum is the CRC-32C of the
+ *  bytes before it.
+ */
+struct JournalRecord {
+    double timestamp;
+    double latitude;
+    double longitude;
+    float altitude;
+    float horizontalAccuracy;
+    float verticalAccuracy;
+    float speed;
+    float course;
+    std::uint32_t checksum;
+};
+static_assert(sizeof(JournalRecord) == 48, "JournalRecord is written to disk as is");
+
+/**
+ *  Append-only journal of fixes that survives the process being killed at
+ *  any point.
+ *
+ *  Layout (native byte order): a 16 byte header of the magic `OSJRNL\0\0`,
+ *  uint32 version and uint32 record size, then one `JournalRecord` after
+ *  another. Records are only ever appended, so a crash can at worst leave
+ *  part of a record at the end; recovery keeps the records up to the first
+ *  that is short or fails its checksum and truncates the rest.
+ */
+namespace journal {
+
+constexpr char kMagic[8] = {'O', 'S', 'J', 'R', 'N', 'L', '\0', '\0'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kHeaderSize = 16;
+
+/**
+ *  CRC-32C (Castagnoli) of a buffer, continuing from `crc`
+ */
+std::uint32_t crc32c(const void *data, std::size_t size, std::uint32_t crc = 0);
+
+JournalRecord encode(const Fix &fix);
+
+/**
+ *  @return false if the checksum does not match
+ */
+bool decode(const JournalRecord &record, Fix &fix);
+
+} // namespace journal
+
+struct JournalRecovery {
+    /**
+     *  Intact records kept
+     */
+    std::uint64_t recordCount = 0;
+    /**
+     *  Bytes of torn or corrupt records cut from the end
+     */
+    std::uint64_t truncatedBytes = 0;
+};
+
+/**
+ *  Validates a journal, truncating any torn tail, and appends its fixes
+ *  with `sourceIndex` set to their record number. A missing or empty file,
+ *  or one cut short inside the header, is recovered as a new empty journal;
+ *  a short file whose bytes are not the start of a header is left alone.
+ *
+ *  @param fixes receives the fixes, or nullptr to only validate
+ *
+ *  @return false if the file cannot be opened or is not a journal
+ */
+bool recoverTrackJournal(const std::string &path, FixBuffer *fixes, JournalRecovery &recovery);
+
+struct TrackJournalOptions {
+    /**
+     *  Records held in memory before they are written together
+     */
+    std::size_t maximumBatch = 64;
+    /**
+     *  Seconds a record may wait in memory for others to join its write.
+     *  Checked as records are appended, so with fixes every second the
+     *  journal is at most a fix behind.
+     */
+    double commitInterval = 1;
+    /**
+     *  Seconds between flushes to storage. Written records survive the
+     *  process being killed straight away but only survive the device
+     *  losing power once flushed. 0 flushes after every write; negative
+     *  leaves it to the system.
+     */
+    double syncInterval = 10;
+};
+
+/**
+ *  Appends fixes to a journal, grouping them into one write per batch and
+ *  flushing to storage at most every `syncInterval`
+ */
+class TrackJournalWriter {
+public:
+    explicit TrackJournalWriter(Clock &clock, const TrackJournalOptions &options = TrackJournalOptions());
+    ~TrackJournalWriter();
+    TrackJournalWriter(const TrackJournalWriter &) = delete;
+    TrackJournalWriter &operator=(const TrackJournalWriter &) = delete;
+
+    const TrackJournalOptions &options() const { return m_options; }
+
+    /**
+     *  Opens a journal to append to, recovering what it already holds
+     *
+     *  @param recovered receives the fixes already in the journal, or
+     *  nullptr
+     */
+    bool open(const std::string &path, FixBuffer *recovered = nullptr);
+
+    /**
+     *  Queues a fix, writing the batch if it is full or its oldest record
+     *  has waited `commitInterval`
+     *
+     *  @return false if the journal is closed or a write has failed
+     */
+    bool append(const Fix &fix);
+
+    /**
+     *  Writes any queued records, flushing to storage if `syncInterval` has
+     *  passed since the last flush
+     */
+    bool commit();
+
+    /**
+     *  Writes any queued records and flushes to storage
+     */
+    bool sync();
+
+    /**
+     *  Writes any queued records, flushes them unless `syncInterval` is
+     *  negative, and closes the file
+     *
+     *  @return false if any write failed
+     */
+    bool close();
+
+    bool isOpen() const { return m_descriptor >= 0; }
+    const JournalRecovery &recovery() const { return m_recovery; }
+
+    /**
+     *  Records in the journal, including those still queued
+     */
+    std::uint64_t recordCount() const { return m_writtenCount + m_pending.size(); }
+    std::size_t pendingCount() const { return m_pending.size(); }
+    std::uint64_t writeCount() const { return m_writeCount; }
+    std::uint64_t syncCount() const { return m_syncCount; }
+
+private:
+    bool flush();
+
+    Clock &m_clock;
+    TrackJournalOptions m_options;
+    int m_descriptor = -1;
+    bool m_failed = false;
+    JournalRecovery m_recovery;
+    std::vector<JournalRecord> m_pending;
+    double m_pendingSince = 0;
+    double m_lastSync = 0;
+    bool m_unsynced = false;
+    std::uint64_t m_writtenCount = 0;
+    std::uint64_t m_writeCount = 0;
+    std::uint64_t m_syncCount = 0;
+};
+
+} // namespace oslocation
@@ -0,0 +1,194 @@
+//
+//  OSTrackSimplifier.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackSimplifier.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace oslocation {
+
+namespace {
+
+/**
+ *  Squared distance from (x, y) to the segment from (ax, ay) to (bx, by)
+ */
+inline double segmentDistanceSquared(double x, double y, double ax, double ay, double bx, double by) {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double lengthSquared = dx * dx + dy * dy;
+    double t = 0;
+    if (lengthSquared > 0) {
+        t = std::min(1.0, std::max(0.0, ((x - ax) * dx + (y - ay) * dy) / lengthSquared));
+    }
+    const double ex = x - (ax + t * dx);
+    const double ey = y - (ay + t * dy);
+    return ex * ex + ey * ey;
+}
+
+// Douglas-Peucker is quadratic at worst, so long tracks are cut into runs of
+// this many segments. Each boundary costs at most one extra kept fix.
+constexpr std::size_t kRunLength = 4096;
+
+/**
+ *  Douglas-Peucker over fixes [first, last], marking kept fixes in `keep`.
+ *  Positions are taken in a frame centred on the first fix of the run.
+ */
+void simplifyRun(const FixBuffer &track, std::size_t first, std::size_t last, double tolerance, std::vector<std::uint8_t> &keep) {
+    const std::size_t count = last - first + 1;
+    std::vector<double> east(count), north(count);
+    const LocalFrame frame(track[first].latitude, track[first].longitude);
+    for (std::size_t i = 0; i < count; i++) {
+        frame.toLocal(track[first + i].latitude, track[first + i].longitude, east[i], north[i]);
+    }
+
+    const double toleranceSquared = tolerance * tolerance;
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    stack.emplace_back(0, count - 1);
+    while (!stack.empty()) {
+        const auto [a, b] = stack.back();
+        stack.pop_back();
+        double worst = 0;
+        std::size_t worstIndex = a;
+        for (std::size_t i = a + 1; i < b; i++) {
+            const double d = segmentDistanceSquared(east[i], north[i], east[a], north[a], east[b], north[b]);
+            if (d > worst) {
+                worst = d;
+                worstIndex = i;
+            }
+        }
+        if (worst > toleranceSquared) {
+            keep[first + worstIndex] = 1;
+            stack.emplace_back(a, worstIndex);
+            stack.emplace_back(worstIndex, b);
+        }
+    }
+}
+
+} // namespace
+
+TrackSimplifier::TrackSimplifier(double tolerance, std::size_t maximumPending)
+    : m_tolerance(tolerance), m_maximumPending(std::max<std::size_t>(maximumPending, 1)) {
+    m_pending.reserve(m_maximumPending);
+}
+
+void TrackSimplifier::reset() {
+    m_hasAnchor = false;
+    m_pending.clear();
+}
+
+bool TrackSimplifier::fits(double east, double north) const {
+    // The anchor is the frame origin
+    const double toleranceSquared = m_tolerance * m_tolerance;
+    for (const Pending &pending : m_pending) {
+        if (segmentDistanceSquared(pending.east, pending.north, 0, 0, east, north) > toleranceSquared) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TrackSimplifier::add(const Fix &fix, Fix &kept) {
+    if (!m_hasAnchor) {
+        m_hasAnchor = true;
+        m_frame.setOrigin(fix.latitude, fix.longitude);
+        kept = fix;
+        return true;
+    }
+    double east, north;
+    m_frame.toLocal(fix.latitude, fix.longitude, east, north);
+    if (m_pending.size() < m_maximumPending && fits(east, north)) {
+        m_pending.push_back(Pending{fix, east, north});
+        return false;
+    }
+
+    // The previous end becomes the anchor, and the new fix the only pending
+    // one
+    kept = m_pending.back().fix;
+    m_frame.setOrigin(kept.latitude, kept.longitude);
+    m_frame.toLocal(fix.latitude, fix.longitude, east, north);
+    m_pending.clear();
+    m_pending.push_back(Pending{fix, east, north});
+    return true;
+}
+
+void TrackSimplifier::process(FixBuffer &fixes) {
+    // Each fix closes at most one window, so kept fixes can be written back
+    // over the batch behind the read position
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const Fix fix = fixes[i];
+        Fix kept;
+        if (add(fix, kept)) {
+            fixes[written++] = kept;
+        }
+    }
+    fixes.resize(written);
+
+    // Pending fixes no longer belong to this batch
+    for (Pending &pending : m_pending) {
+        pending.fix.sourceIndex = -1;
+    }
+}
+
+void TrackSimplifier::flush(FixBuffer &fixes) {
+    if (!m_pending.empty()) {
+        fixes.push_back(m_pending.back().fix);
+    }
+    reset();
+}
+
+std::vector<std::size_t> simplifyTrack(const FixBuffer &track, double tolerance, unsigned threads) {
+    std::vector<std::size_t> kept;
+    if (track.size() <= 2) {
+        for (std::size_t i = 0; i < track.size(); i++) {
+            kept.push_back(i);
+        }
+        return kept;
+    }
+
+    // Runs share their end points, which are marked up front so no two
+    // threads ever write the same element
+    const std::size_t runs = (track.size() - 2) / kRunLength + 1;
+    std::vector<std::uint8_t> keep(track.size(), 0);
+    for (std::size_t run = 0; run < runs; run++) {
+        keep[run * kRunLength] = 1;
+    }
+    keep.back() = 1;
+
+    std::atomic<std::size_t> nextRun(0);
+    auto work = [&] {
+        for (std::size_t run = nextRun++; run < runs; run = nextRun++) {
+            const std::size_t start = run * kRunLength;
+            simplifyRun(track, start, std::min(start + kRunLength, track.size() - 1), tolerance, keep);
+        }
+    };
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < std::min<std::size_t>(threads, runs); i++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t i = 0; i < keep.size(); i++) {
+        if (keep[i]) {
+            kept.push_back(i);
+        }
+    }
+    return kept;
+}
+
+} // namespace oslocation
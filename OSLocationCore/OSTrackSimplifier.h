@@ -0,0 +1,78 @@
+//
+//  OSTrackSimplifier.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSLocalFrame.h"
+#include "OSPipeline.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  Streaming track simplification with the opening window variant of
+ *  Douglas-Peucker.
+ *
+ *  The last kept fix anchors a window of pending fixes. Each new fix is
+ *  tried as the window's end; while every pending fix stays within
+ *  `tolerance` metres of the segment from the anchor to it, the window
+ *  grows. Otherwise the previous end is kept and becomes the anchor. Memory
+ *  is bounded by `maximumPending`, after which the window is closed
+ *  regardless.
+ *
+ *  A kept fix is only known to be kept once a later fix breaks the window,
+ *  so output lags input by one kept fix; `flush` delivers the held end
+ *  point when recording stops.
+ */
+class TrackSimplifier : public Stage {
+public:
+    explicit TrackSimplifier(double tolerance, std::size_t maximumPending = 256);
+
+    void process(FixBuffer &fixes) override;
+    void flush(FixBuffer &fixes) override;
+    void reset() override;
+
+    double tolerance() const { return m_tolerance; }
+
+private:
+    struct Pending {
+        Fix fix;
+        double east;
+        double north;
+    };
+
+    /**
+     *  @return true and sets `kept` when `fix` closes the window
+     */
+    bool add(const Fix &fix, Fix &kept);
+    bool fits(double east, double north) const;
+
+    double m_tolerance;
+    std::size_t m_maximumPending;
+    bool m_hasAnchor = false;
+    LocalFrame m_frame;
+    std::vector<Pending> m_pending;
+};
+
+/**
+ *  Douglas-Peucker simplification of a whole recorded track.
+ *
+ *  The track is cut into runs of a few thousand fixes, which bounds the
+ *  algorithm's quadratic worst case, and the runs are simplified
+ *  concurrently on `threads` threads (0 for one per core). Run boundaries
+ *  are always kept, so the result can hold a few more fixes than a single
+ *  pass, but never deviates from the original by more than `tolerance`
+ *  metres.
+ *
+ *  @return indices of the kept fixes in ascending order, always including
+ *  the first and last
+ */
+std::vector<std::size_t> simplifyTrack(const FixBuffer &track, double tolerance, unsigned threads = 0);
+
+} // namespace oslocation
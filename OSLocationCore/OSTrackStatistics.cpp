@@ -0,0 +1,100 @@
+//
+//  OSTrackStatistics.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackStatistics.h"
+#include "OSGeodesic.h"
+
+namespace oslocation {
+
+void TrackStatistics::add(const Fix &fix, std::vector<TrackSplit> &splits) {
+    if (!hasValidCoordinate(fix)) {
+        return;
+    }
+    m_summary.fixCount++;
+    if (fix.verticalAccuracy >= 0) {
+        addAltitude(fix.altitude);
+    }
+    if (m_hasPrevious) {
+        const double legDistance = distanceBetween(m_previous.latitude, m_previous.longitude, fix.latitude, fix.longitude);
+        const double legTime = fix.timestamp > m_previous.timestamp ? fix.timestamp - m_previous.timestamp : 0;
+        const bool moving = legTime > 0 && legTime <= m_options.maximumGap && legDistance >= m_options.movingSpeed * legTime;
+        addSplits(m_previous, legDistance, legTime, moving, splits);
+        m_summary.distance += legDistance;
+        m_summary.elapsedTime += legTime;
+        if (moving) {
+            m_summary.movingTime += legTime;
+        }
+    }
+    m_previous = fix;
+    m_hasPrevious = true;
+}
+
+void TrackStatistics::addAltitude(double altitude) {
+    if (!m_hasAltitude) {
+        m_altitudeAnchor = altitude;
+        m_hasAltitude = true;
+    } else if (altitude >= m_altitudeAnchor + m_options.climbThreshold) {
+        m_summary.ascent += altitude - m_altitudeAnchor;
+        m_altitudeAnchor = altitude;
+    } else if (altitude <= m_altitudeAnchor - m_options.climbThreshold) {
+        m_summary.descent += m_altitudeAnchor - altitude;
+        m_altitudeAnchor = altitude;
+    }
+}
+
+void TrackStatistics::addSplits(const Fix &from, double legDistance, double legTime, bool moving, std::vector<TrackSplit> &splits) {
+    if (m_options.splitDistance <= 0 || legDistance <= 0) {
+        return;
+    }
+    // A long leg can complete more than one split
+    for (;;) {
+        const double boundary = (m_lastSplit.number + 1) * m_options.splitDistance;
+        const double fraction = (boundary - m_summary.distance) / legDistance;
+        if (fraction > 1) {
+            return;
+        }
+        const double elapsed = m_summary.elapsedTime + fraction * legTime;
+        const double movingTime = m_summary.movingTime + (moving ? fraction * legTime : 0);
+        TrackSplit split;
+        split.number = m_lastSplit.number + 1;
+        split.distance = boundary;
+        split.timestamp = from.timestamp + fraction * legTime;
+        split.elapsedTime = elapsed - m_lastSplit.elapsedTime;
+        split.movingTime = movingTime - m_lastSplit.movingTime;
+        // Altitude is only known at fixes, so climbing counts to the split
+        // the fix it was seen at completes
+        split.ascent = m_summary.ascent - m_lastSplit.ascent;
+        split.descent = m_summary.descent - m_lastSplit.descent;
+        splits.push_back(split);
+
+        m_lastSplit.number = split.number;
+        m_lastSplit.elapsedTime = elapsed;
+        m_lastSplit.movingTime = movingTime;
+        m_lastSplit.ascent = m_summary.ascent;
+        m_lastSplit.descent = m_summary.descent;
+    }
+}
+
+void TrackStatistics::reset() {
+    m_summary = TrackSummary();
+    m_hasPrevious = false;
+    m_hasAltitude = false;
+    m_lastSplit = TrackSplit{};
+}
+
+void TrackStatisticsStage::process(FixBuffer &fixes) {
+    for (const Fix &fix : fixes) {
+        m_statistics.add(fix, m_splits);
+    }
+}
+
+void TrackStatisticsStage::reset() {
+    m_statistics.endSegment();
+    m_splits.clear();
+}
+
+} // namespace oslocation
@@ -0,0 +1,177 @@
+//
+//  OSTrackStatistics.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSPipeline.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace oslocation {
+
+constexpr double kMetresPerKilometre = 1000;
+constexpr double kMetresPerMile = 1609.344;
+
+struct TrackStatisticsOptions {
+    /**
+     *  Altitude must move this many metres past the last turning point
+     *  before it counts as ascent or descent, so GPS altitude noise does
+     *  not add up over a long track
+     */
+    double climbThreshold = 5;
+    /**
+     *  Legs between fixes slower than this many metres per second count as
+     *  stopped rather than moving
+     */
+    double movingSpeed = 0.5;
+    /**
+     *  Legs spanning more seconds than this, such as after losing the
+     *  signal, add distance but not moving time
+     */
+    double maximumGap = 60;
+    /**
+     *  Distance in metres between split events, such as
+     *  `kMetresPerKilometre` or `kMetresPerMile`. 0 turns splits off.
+     */
+    double splitDistance = kMetresPerKilometre;
+};
+
+/**
+ *  Totals over a track so far
+ */
+struct TrackSummary {
+    /**
+     *  Metres along the track
+     */
+    double distance = 0;
+    /**
+     *  Metres climbed and descended, after the climb threshold
+     */
+    double ascent = 0;
+    double descent = 0;
+    /**
+     *  Seconds between the first and latest fix, less the gaps between
+     *  segments
+     */
+    double elapsedTime = 0;
+    /**
+     *  Seconds spent moving
+     */
+    double movingTime = 0;
+    std::uint64_t fixCount = 0;
+
+    /**
+     *  Metres per second while moving
+     */
+    double movingSpeed() const { return movingTime > 0 ? distance / movingTime : 0; }
+
+    /**
+     *  Moving seconds per `unit` metres
+     */
+    double pace(double unit = kMetresPerKilometre) const { return distance > 0 ? movingTime / distance * unit : 0; }
+};
+
+/**
+ *  One split distance completed. Times are interpolated to the point along
+ *  the leg where the split distance was reached.
+ */
+struct TrackSplit {
+    /**
+     *  1 for the first split
+     */
+    std::uint32_t number;
+    /**
+     *  Distance along the track at the end of the split, `number` times the
+     *  split distance
+     */
+    double distance;
+    /**
+     *  When the split was completed
+     */
+    double timestamp;
+    double elapsedTime;
+    double movingTime;
+    double ascent;
+    double descent;
+};
+
+/**
+ *  Accumulates distance, ascent, descent and moving time as fixes arrive,
+ *  in constant time per fix, and reports each completed split.
+ *
+ *  Distances are geodesic on WGS84. Ascent and descent follow the altitude
+ *  of fixes with a valid vertical accuracy through a hysteresis band of
+ *  `climbThreshold`. A new segment, after `endSegment`, starts without a
+ *  leg from the previous fix.
+ */
+class TrackStatistics {
+public:
+    explicit TrackStatistics(const TrackStatisticsOptions &options = TrackStatisticsOptions()) : m_options(options) {}
+
+    const TrackStatisticsOptions &options() const { return m_options; }
+
+    /**
+     *  Adds the next fix in chronological order. Fixes without a valid
+     *  coordinate are ignored.
+     *
+     *  @param splits completed splits are appended here
+     */
+    void add(const Fix &fix, std::vector<TrackSplit> &splits);
+
+    /**
+     *  Starts a new segment with the next fix, such as after updates were
+     *  stopped. Totals carry on.
+     */
+    void endSegment() { m_hasPrevious = false; }
+
+    void reset();
+
+    const TrackSummary &summary() const { return m_summary; }
+
+private:
+    void addAltitude(double altitude);
+    void addSplits(const Fix &from, double legDistance, double legTime, bool moving, std::vector<TrackSplit> &splits);
+
+    TrackStatisticsOptions m_options;
+    TrackSummary m_summary;
+    bool m_hasPrevious = false;
+    Fix m_previous{};
+    bool m_hasAltitude = false;
+    double m_altitudeAnchor = 0;
+    // Totals when the last split was completed
+    TrackSplit m_lastSplit{};
+};
+
+/**
+ *  Feeds the fixes passing through the pipeline to a `TrackStatistics` and
+ *  collects the completed splits. Fixes are left untouched.
+ *
+ *  The statistics are owned by the caller so they outlive the pipeline
+ *  being rebuilt. Resetting the stage ends the segment rather than
+ *  clearing the totals.
+ */
+class TrackStatisticsStage : public Stage {
+public:
+    explicit TrackStatisticsStage(TrackStatistics &statistics) : m_statistics(statistics) {}
+
+    void process(FixBuffer &fixes) override;
+    void reset() override;
+
+    TrackStatistics &statistics() { return m_statistics; }
+
+    /**
+     *  Splits completed since the last call, oldest first
+     */
+    std::vector<TrackSplit> &splits() { return m_splits; }
+
+private:
+    TrackStatistics &m_statistics;
+    std::vector<TrackSplit> m_splits;
+};
+
+} // namespace oslocation
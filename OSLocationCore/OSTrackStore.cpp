@@ -0,0 +1,84 @@
+//
+//  OSTrackStore.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackStore.h"
+
+#include <algorithm>
+
+namespace oslocation {
+
+namespace {
+
+enum DoubleColumn { Timestamps, Latitudes, Longitudes, DoubleColumns };
+enum FloatColumn { Altitudes, HorizontalAccuracies, VerticalAccuracies, Speeds, Courses, FloatColumns };
+
+} // namespace
+
+TrackStore::Chunk::Chunk()
+    : doubles(new double[DoubleColumns * kTrackChunkSize]), floats(new float[FloatColumns * kTrackChunkSize]) {}
+
+void TrackStore::append(const Fix &fix) {
+    const std::size_t offset = m_size % kTrackChunkSize;
+    if (offset == 0) {
+        m_chunks.push_back(std::make_unique<Chunk>());
+    }
+    Chunk &chunk = *m_chunks.back();
+    chunk.doubles[Timestamps * kTrackChunkSize + offset] = fix.timestamp;
+    chunk.doubles[Latitudes * kTrackChunkSize + offset] = fix.latitude;
+    chunk.doubles[Longitudes * kTrackChunkSize + offset] = fix.longitude;
+    chunk.floats[Altitudes * kTrackChunkSize + offset] = static_cast<float>(fix.altitude);
+    chunk.floats[HorizontalAccuracies * kTrackChunkSize + offset] = static_cast<float>(fix.horizontalAccuracy);
+    chunk.floats[VerticalAccuracies * kTrackChunkSize + offset] = static_cast<float>(fix.verticalAccuracy);
+    chunk.floats[Speeds * kTrackChunkSize + offset] = static_cast<float>(fix.speed);
+    chunk.floats[Courses * kTrackChunkSize + offset] = static_cast<float>(fix.course);
+    m_size++;
+}
+
+void TrackStore::append(const FixBuffer &fixes) {
+    for (const Fix &fix : fixes) {
+        append(fix);
+    }
+}
+
+void TrackStore::clear() {
+    m_chunks.clear();
+    m_size = 0;
+}
+
+std::size_t TrackStore::capacityBytes() const {
+    return m_chunks.size() * kTrackChunkSize * (DoubleColumns * sizeof(double) + FloatColumns * sizeof(float));
+}
+
+TrackColumns TrackView::chunk(std::size_t index) const {
+    const TrackStore::Chunk &chunk = *m_store->m_chunks[index];
+    const double *doubles = chunk.doubles.get();
+    const float *floats = chunk.floats.get();
+    return TrackColumns{
+        doubles + Timestamps * kTrackChunkSize,
+        doubles + Latitudes * kTrackChunkSize,
+        doubles + Longitudes * kTrackChunkSize,
+        floats + Altitudes * kTrackChunkSize,
+        floats + HorizontalAccuracies * kTrackChunkSize,
+        floats + VerticalAccuracies * kTrackChunkSize,
+        floats + Speeds * kTrackChunkSize,
+        floats + Courses * kTrackChunkSize,
+        std::min(kTrackChunkSize, m_size - index * kTrackChunkSize)};
+}
+
+Fix TrackView::operator[](std::size_t index) const {
+    const TrackColumns columns = chunk(index / kTrackChunkSize);
+    const std::size_t offset = index % kTrackChunkSize;
+    Fix fix = makeFix(columns.timestamps[offset], columns.latitudes[offset], columns.longitudes[offset], columns.altitudes[offset]);
+    fix.horizontalAccuracy = columns.horizontalAccuracies[offset];
+    fix.verticalAccuracy = columns.verticalAccuracies[offset];
+    fix.speed = columns.speeds[offset];
+    fix.course = columns.courses[offset];
+    fix.sourceIndex = static_cast<std::int32_t>(index);
+    return fix;
+}
+
+} // namespace oslocation
@@ -0,0 +1,132 @@
+//
+//  OSTrackStore.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace oslocation {
+
+/**
+ *  Points per chunk of a `TrackStore`
+ */
+constexpr std::size_t kTrackChunkSize = 4096;
+
+/**
+ *  One chunk of a track as contiguous columns, each `count` long. Missing
+ *  values follow `Fix`: negative accuracies, speeds and courses.
+ */
+struct TrackColumns {
+    const double *timestamps;
+    const double *latitudes;
+    const double *longitudes;
+    const float *altitudes;
+    const float *horizontalAccuracies;
+    const float *verticalAccuracies;
+    const float *speeds;
+    const float *courses;
+    std::size_t count;
+};
+
+class TrackStore;
+
+/**
+ *  Read-only view of the points a `TrackStore` held when the view was
+ *  taken. Views are two words, stay valid while the store grows and are
+ *  invalidated by `clear` or destroying the store.
+ */
+class TrackView {
+public:
+    TrackView() = default;
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     *  Gathers one point back into a fix, with `sourceIndex` set to its
+     *  index in the track
+     */
+    Fix operator[](std::size_t index) const;
+
+    std::size_t chunkCount() const { return (m_size + kTrackChunkSize - 1) / kTrackChunkSize; }
+
+    /**
+     *  Columns of one chunk, the last cut short at the end of the view
+     */
+    TrackColumns chunk(std::size_t index) const;
+
+private:
+    friend class TrackStore;
+    TrackView(const TrackStore *store, std::size_t size) : m_store(store), m_size(size) {}
+
+    const TrackStore *m_store = nullptr;
+    std::size_t m_size = 0;
+};
+
+/**
+ *  In-memory track held as columns rather than one object per point.
+ *  Coordinates and times stay doubles; altitude, accuracies, speed and
+ *  course are floats, which keeps them to well under a millimetre or
+ *  millidegree, for 44 bytes a point.
+ *
+ *  The store grows a chunk of `kTrackChunkSize` points at a time and never
+ *  moves a point once appended, so growing costs no copies and views stay
+ *  valid. Not thread safe; take views on the thread appending.
+ */
+class TrackStore {
+public:
+    TrackStore() = default;
+    TrackStore(const TrackStore &) = delete;
+    TrackStore &operator=(const TrackStore &) = delete;
+
+    /**
+     *  Appends a fix. Grid positions, flags and `sourceIndex` are not kept.
+     */
+    void append(const Fix &fix);
+    void append(const FixBuffer &fixes);
+
+    /**
+     *  Frees every chunk, invalidating views
+     */
+    void clear();
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    Fix operator[](std::size_t index) const { return view()[index]; }
+
+    /**
+     *  The track as it is now
+     */
+    TrackView view() const { return TrackView(this, m_size); }
+
+    /**
+     *  Bytes allocated for points, including the unused end of the last
+     *  chunk
+     */
+    std::size_t capacityBytes() const;
+
+private:
+    friend class TrackView;
+
+    struct Chunk {
+        Chunk();
+
+        // Timestamps, latitudes and longitudes, then altitudes, horizontal
+        // and vertical accuracies, speeds and courses, a column at a time
+        std::unique_ptr<double[]> doubles;
+        std::unique_ptr<float[]> floats;
+    };
+
+    std::vector<std::unique_ptr<Chunk>> m_chunks;
+    std::size_t m_size = 0;
+};
+
+} // namespace oslocation
@@ -0,0 +1,117 @@
+//
+//  OSTransverseMercator.cpp
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTransverseMercator.h"
+#include "OSTransverseMercatorKernel.h"
+
+#include <cmath>
+
+namespace oslocation {
+
+namespace detail {
+
+TransverseMercatorConstants makeConstants(const TransverseMercator &projection) {
+    const double a = projection.ellipsoid.semiMajorAxis;
+    const double b = projection.ellipsoid.semiMinorAxis;
+    const double n = (a - b) / (a + b);
+    const double n2 = n * n;
+    const double n3 = n2 * n;
+    const double originLatitude = projection.originLatitude * kDegreesToRadians;
+    return TransverseMercatorConstants{
+        a * projection.scaleFactor,
+        b * projection.scaleFactor,
+        projection.ellipsoid.eccentricitySquared(),
+        1 - projection.ellipsoid.eccentricitySquared(),
+        originLatitude,
+        projection.originLongitude * kDegreesToRadians,
+        std::sin(originLatitude),
+        std::cos(originLatitude),
+        projection.falseEasting,
+        projection.falseNorthing,
+        1 + n + 5.0 / 4 * n2 + 5.0 / 4 * n3,
+        3 * n + 3 * n2 + 21.0 / 8 * n3,
+        15.0 / 8 * n2 + 15.0 / 8 * n3,
+        35.0 / 24 * n3,
+    };
+}
+
+} // namespace detail
+
+void projectTransverseMercator(const TransverseMercator &projection, double latitude, double longitude, double &easting, double &northing) {
+    const double a = projection.ellipsoid.semiMajorAxis;
+    const double b = projection.ellipsoid.semiMinorAxis;
+    const double f0 = projection.scaleFactor;
+    const double e2 = projection.ellipsoid.eccentricitySquared();
+    const double n = (a - b) / (a + b);
+    const double phi = latitude * kDegreesToRadians;
+    const double phi0 = projection.originLatitude * kDegreesToRadians;
+    const double lambda = longitude * kDegreesToRadians;
+    const double lambda0 = projection.originLongitude * kDegreesToRadians;
+
+    const double sinPhi = std::sin(phi);
+    const double cosPhi = std::cos(phi);
+    const double tanPhi = std::tan(phi);
+    const double nu = a * f0 / std::sqrt(1 - e2 * sinPhi * sinPhi);
+    const double rho = a * f0 * (1 - e2) / std::pow(1 - e2 * sinPhi * sinPhi, 1.5);
+    const double eta2 = nu / rho - 1;
+
+    const double m = b * f0 * ((1 + n + 5.0 / 4 * n * n + 5.0 / 4 * n * n * n) * (phi - phi0) -
+                               (3 * n + 3 * n * n + 21.0 / 8 * n * n * n) * std::sin(phi - phi0) * std::cos(phi + phi0) +
+                               (15.0 / 8 * n * n + 15.0 / 8 * n * n * n) * std::sin(2 * (phi - phi0)) * std::cos(2 * (phi + phi0)) -
+                               35.0 / 24 * n * n * n * std::sin(3 * (phi - phi0)) * std::cos(3 * (phi + phi0)));
+
+    const double i1 = m + projection.falseNorthing;
+    const double i2 = nu / 2 * sinPhi * cosPhi;
+    const double i3 = nu / 24 * sinPhi * std::pow(cosPhi, 3) * (5 - tanPhi * tanPhi + 9 * eta2);
+    const double i3a = nu / 720 * sinPhi * std::pow(cosPhi, 5) * (61 - 58 * tanPhi * tanPhi + std::pow(tanPhi, 4));
+    const double i4 = nu * cosPhi;
+    const double i5 = nu / 6 * std::pow(cosPhi, 3) * (nu / rho - tanPhi * tanPhi);
+    const double i6 = nu / 120 * std::pow(cosPhi, 5) * (5 - 18 * tanPhi * tanPhi + std::pow(tanPhi, 4) + 14 * eta2 - 58 * tanPhi * tanPhi * eta2);
+
+    const double dl = lambda - lambda0;
+    northing = i1 + i2 * dl * dl + i3 * std::pow(dl, 4) + i3a * std::pow(dl, 6);
+    easting = projection.falseEasting + i4 * dl + i5 * std::pow(dl, 3) + i6 * std::pow(dl, 5);
+}
+
+double gridConvergence(const TransverseMercator &projection, double latitude, double longitude) {
+    const double e2 = projection.ellipsoid.eccentricitySquared();
+    const double phi = latitude * kDegreesToRadians;
+    const double sinPhi = std::sin(phi);
+    const double cosPhi = std::cos(phi);
+    const double tanPhi = std::tan(phi);
+    // nu / rho - 1, the second eccentricity squared times cos^2(phi)
+    const double eta2 = e2 * cosPhi * cosPhi / (1 - e2);
+    const double dl = (longitude - projection.originLongitude) * kDegreesToRadians;
+    const double dlCos2 = dl * dl * cosPhi * cosPhi;
+    const double gamma = dl * sinPhi * (1 + dlCos2 / 3 * (1 + 3 * eta2 + 2 * eta2 * eta2) + dlCos2 * dlCos2 / 15 * (2 - tanPhi * tanPhi));
+    return gamma * kRadiansToDegrees;
+}
+
+void projectTransverseMercator(const TransverseMercator &projection, const double *latitudes, const double *longitudes, std::size_t count, double *eastings, double *northings, simd::Level level) {
+    const detail::TransverseMercatorConstants constants = detail::makeConstants(projection);
+    std::size_t done = 0;
+    if (!simd::isSupported(level)) {
+        level = simd::Level::Scalar;
+    }
+    switch (level) {
+        case simd::Level::AVX2:
+#if defined(__x86_64__) || defined(__i386__)
+            done = detail::projectBatchAVX2(constants, latitudes, longitudes, count, eastings, northings);
+#endif
+            break;
+        case simd::Level::NEON:
+#if OS_SIMD_NEON
+            done = detail::projectBatch<simd::NEON>(constants, latitudes, longitudes, count, eastings, northings);
+#endif
+            break;
+        case simd::Level::Scalar:
+            break;
+    }
+    detail::projectBatch<simd::Scalar>(constants, latitudes + done, longitudes + done, count - done, eastings + done, northings + done);
+}
+
+} // namespace oslocation
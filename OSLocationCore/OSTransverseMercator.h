@@ -0,0 +1,57 @@
+//
+//  OSTransverseMercator.h
+//  OSLocationCore
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSEllipsoid.h"
+#include "OSSIMD.h"
+
+#include <cstddef>
+
+namespace oslocation {
+
+/**
+ *  Parameters of a Transverse Mercator projection. Origins are in degrees.
+ */
+struct TransverseMercator {
+    Ellipsoid ellipsoid;
+    double scaleFactor;
+    double originLatitude;
+    double originLongitude;
+    double falseEasting;
+    double falseNorthing;
+};
+
+/**
+ *  The British National Grid projection on the given ellipsoid. Use
+ *  `kAiry1830` for OSGB36 and `kGRS80` for the ETRS89 grid OSTN15 shifts from.
+ */
+constexpr TransverseMercator nationalGridProjection(const Ellipsoid &ellipsoid) {
+    return TransverseMercator{ellipsoid, 0.9996012717, 49, -2, 400000, -100000};
+}
+
+/**
+ *  Projects one point using the series in "A guide to coordinate systems in
+ *  Great Britain", annex C. This is the reference the batch kernels are
+ *  checked against.
+ */
+void projectTransverseMercator(const TransverseMercator &projection, double latitude, double longitude, double &easting, double &northing);
+
+/**
+ *  Grid convergence at a point: degrees clockwise from true north to grid
+ *  north, positive east of the central meridian. A grid bearing is the true
+ *  bearing less the convergence.
+ */
+double gridConvergence(const TransverseMercator &projection, double latitude, double longitude);
+
+/**
+ *  Projects a batch of points held as separate latitude and longitude arrays
+ *  using the widest kernel available at the requested level
+ */
+void projectTransverseMercator(const TransverseMercator &projection, const double *latitudes, const double *longitudes, std::size_t count, double *eastings, double *northings, simd::Level level = simd::bestLevel());
+
+} // namespace oslocation
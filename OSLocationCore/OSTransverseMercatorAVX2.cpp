@@ -0,0 +1,30 @@
+//
+//  OSTransverseMercatorAVX2.cpp
+//  OSLocationCore
+//
+//  Built with AVX2 and FMA enabled. Nothing in here may run before
+//  simd::isSupported(simd::Level::AVX2) has been checked.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTransverseMercatorKernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+namespace oslocation {
+namespace detail {
+
+std::size_t projectBatchAVX2(const TransverseMercatorConstants &k, const double *latitudes, const double *longitudes, std::size_t count, double *eastings, double *northings) {
+#if OS_SIMD_AVX2
+    return projectBatch<simd::AVX2>(k, latitudes, longitudes, count, eastings, northings);
+#else
+    (void)k, (void)latitudes, (void)longitudes, (void)count, (void)eastings, (void)northings;
+    return 0;
+#endif
+}
+
+} // namespace detail
+} // namespace oslocation
+
+#endif
@@ -0,0 +1,111 @@
+//
+//  OSTransverseMercatorKernel.h
+//  OSLocationCore
+//
+//  Batch Transverse Mercator kernel shared by every instruction set. Only
+//  included by the translation units that instantiate it.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSSIMD.h"
+#include "OSTransverseMercator.h"
+
+#include <cstddef>
+
+namespace oslocation {
+namespace detail {
+
+/**
+ *  Per projection constants hoisted out of the per point loop
+ */
+struct TransverseMercatorConstants {
+    double aF0;
+    double bF0;
+    double e2;
+    double oneMinusE2;
+    double originLatitude;
+    double originLongitude;
+    double sinOrigin;
+    double cosOrigin;
+    double falseEasting;
+    double falseNorthing;
+    double m0, m1, m2, m3;
+};
+
+TransverseMercatorConstants makeConstants(const TransverseMercator &projection);
+
+/**
+ *  Projects `count - count % V::width` points and returns how many it did
+ */
+template <typename V>
+std::size_t projectBatch(const TransverseMercatorConstants &k, const double *latitudes, const double *longitudes, std::size_t count, double *eastings, double *northings) {
+    const V degrees = V::broadcast(kDegreesToRadians);
+    const V one = V::broadcast(1);
+    std::size_t i = 0;
+    for (; i + V::width <= count; i += V::width) {
+        const V phi = V::load(latitudes + i) * degrees;
+        const V lambda = V::load(longitudes + i) * degrees;
+        V s, c;
+        simd::sincos(phi, s, c);
+
+        const V t = s / c;
+        const V t2 = t * t;
+        const V w = fma(-V::broadcast(k.e2) * s, s, one);
+        const V nu = V::broadcast(k.aF0) / sqrt(w);
+        const V nuOverRho = w * V::broadcast(1 / k.oneMinusE2);
+        const V eta2 = nuOverRho - one;
+
+        // Meridional arc from the multiple angle terms of φ - φ0 and φ + φ0
+        const V sinOrigin = V::broadcast(k.sinOrigin);
+        const V cosOrigin = V::broadcast(k.cosOrigin);
+        const V sinDiff = s * cosOrigin - c * sinOrigin;
+        const V cosDiff = c * cosOrigin + s * sinOrigin;
+        const V sinSum = s * cosOrigin + c * sinOrigin;
+        const V cosSum = c * cosOrigin - s * sinOrigin;
+        const V sin2Diff = V::broadcast(2) * sinDiff * cosDiff;
+        const V cos2Diff = cosDiff * cosDiff - sinDiff * sinDiff;
+        const V sin2Sum = V::broadcast(2) * sinSum * cosSum;
+        const V cos2Sum = cosSum * cosSum - sinSum * sinSum;
+        const V sin3Diff = sin2Diff * cosDiff + cos2Diff * sinDiff;
+        const V cos3Sum = cos2Sum * cosSum - sin2Sum * sinSum;
+        V m = V::broadcast(k.m0) * (phi - V::broadcast(k.originLatitude));
+        m = fma(V::broadcast(-k.m1), sinDiff * cosSum, m);
+        m = fma(V::broadcast(k.m2), sin2Diff * cos2Sum, m);
+        m = fma(V::broadcast(-k.m3), sin3Diff * cos3Sum, m);
+        m = m * V::broadcast(k.bF0);
+
+        const V c3 = c * c * c;
+        const V c5 = c3 * c * c;
+        const V t4 = t2 * t2;
+        const V i1 = m + V::broadcast(k.falseNorthing);
+        const V i2 = nu * V::broadcast(0.5) * s * c;
+        const V i3 = nu * V::broadcast(1.0 / 24) * s * c3 * (V::broadcast(5) - t2 + V::broadcast(9) * eta2);
+        const V i3a = nu * V::broadcast(1.0 / 720) * s * c5 * (V::broadcast(61) - V::broadcast(58) * t2 + t4);
+        const V i4 = nu * c;
+        const V i5 = nu * V::broadcast(1.0 / 6) * c3 * (nuOverRho - t2);
+        const V i6 = nu * V::broadcast(1.0 / 120) * c5 * (V::broadcast(5) - V::broadcast(18) * t2 + t4 + V::broadcast(14) * eta2 - V::broadcast(58) * t2 * eta2);
+
+        const V dl = lambda - V::broadcast(k.originLongitude);
+        const V dl2 = dl * dl;
+        const V northing = fma(dl2, fma(dl2, fma(dl2, i3a, i3), i2), i1);
+        const V easting = fma(dl, fma(dl2, fma(dl2, i6, i5), i4), V::broadcast(k.falseEasting));
+        easting.store(eastings + i);
+        northing.store(northings + i);
+    }
+    return i;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ *  Defined in OSTransverseMercatorAVX2.cpp, which is the only translation
+ *  unit compiled with AVX2 enabled. Returns 0 if the build has no AVX2
+ *  kernel.
+ */
+std::size_t projectBatchAVX2(const TransverseMercatorConstants &k, const double *latitudes, const double *longitudes, std::size_t count, double *eastings, double *northings);
+#endif
+
+} // namespace detail
+} // namespace oslocation
@@ -0,0 +1,108 @@
+//
+//  OSAdaptiveSchedulerBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replays a day out (a walk to a café, a drive, a long stop at a trig
+//  point and the walk back) sampled once a second against the static
+//  update purposes and the adaptive scheduler, and reports fixes per
+//  kilometre, time spent at high accuracy and every reconfiguration made.
+//  A GPX file with one point per second can be given instead.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSAdaptiveScheduler.h"
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSLocalFrame.h"
+
+#include <cstdio>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+struct Leg {
+    double seconds;
+    double speed;
+};
+
+FixBuffer dayOut() {
+    const Leg legs[] = {{900, 1.4}, {2700, 0}, {600, 1.4}, {1800, 14}, {600, 1.2}, {3600, 0}, {1200, 1.2}, {1500, 12}, {300, 1.4}};
+    const LocalFrame frame(54.4541, -3.2117);
+    FixBuffer fixes;
+    double east = 0, north = 0, timestamp = 0;
+    bool eastwards = true;
+    for (const Leg &leg : legs) {
+        for (double elapsed = 0; elapsed < leg.seconds; elapsed++) {
+            Fix fix = makeFix(timestamp++, 0, 0);
+            frame.toGeodetic(east, north, fix.latitude, fix.longitude);
+            fix.horizontalAccuracy = 5;
+            fixes.push_back(fix);
+            (eastwards ? east : north) += leg.speed;
+        }
+        eastwards = !eastwards;
+    }
+    return fixes;
+}
+
+const char *stateName(MotionState state) {
+    switch (state) {
+        case MotionState::Stationary:
+            return "stationary";
+        case MotionState::Walking:
+            return "walking";
+        case MotionState::Driving:
+            return "driving";
+    }
+    return "";
+}
+
+void report(const char *name, const ScheduleReport &report) {
+    std::printf("%-16s %7zu fixes %7.1f fixes/km %5.1f%% at high accuracy %3zu reconfigurations\n", name, report.fixesDelivered, report.fixesPerKilometre(), report.highAccuracyFraction() * 100, report.reconfigurations);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    FixBuffer track;
+    if (argc > 1) {
+        GPXReader::readFile(argv[1], [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    } else {
+        track = dayOut();
+    }
+    if (track.size() < 2) {
+        std::fprintf(stderr, "No track to replay\n");
+        return 1;
+    }
+
+    AdaptiveScheduler scheduler;
+    const ScheduleReport adaptive = simulateSchedule(track, LocationSettings(), &scheduler);
+    const ScheduleReport currentLocation = simulateSchedule(track, {LocationAccuracy::Best, 0, true});
+    const ScheduleReport navigation = simulateSchedule(track, {LocationAccuracy::BestForNavigation, 0, true});
+    const ScheduleReport routeRecording = simulateSchedule(track, {LocationAccuracy::BestForNavigation, 5, true});
+
+    std::printf("%.1f km over %.1f h\n", adaptive.distance / 1000, adaptive.duration / 3600);
+    report("current location", currentLocation);
+    report("navigation", navigation);
+    report("route recording", routeRecording);
+    report("adaptive", adaptive);
+
+    const double start = track.front().timestamp;
+    for (const Reconfiguration &change : scheduler.log()) {
+        std::printf("  %7.0f s %-10s -> %-10s speed %5.1f m/s filter %4.0f m heading %s\n", change.timestamp - start, stateName(change.from), stateName(change.to), change.speed, change.settings.distanceFilter, change.settings.headingUpdates ? "on" : "off");
+    }
+
+    FixBuffer batch(1);
+    const double seconds = bestOf(5, [&] {
+        AdaptiveScheduler timed;
+        for (const Fix &fix : track) {
+            batch[0] = fix;
+            timed.process(batch);
+        }
+        doNotOptimise(timed.state());
+    });
+    std::printf("%zu fixes in %.2f ms, %.1f ns/fix\n", track.size(), seconds * 1e3, seconds * 1e9 / track.size());
+    return 0;
+}
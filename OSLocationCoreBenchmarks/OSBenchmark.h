@@ -0,0 +1,57 @@
+//
+//  OSBenchmark.h
+//  OSLocationCoreBenchmarks
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace oslocation {
+namespace benchmark {
+
+inline std::string fixturePath(const std::string &name) {
+    return std::string(OS_FIXTURES_DIR) + "/" + name;
+}
+
+inline std::string readFile(const std::string &path) {
+    std::ifstream stream(path, std::ios::binary);
+    std::stringstream contents;
+    contents << stream.rdbuf();
+    return contents.str();
+}
+
+/**
+ *  Runs the block `repetitions` times and returns the fastest wall clock
+ *  time in seconds
+ */
+template <typename Block>
+double bestOf(int repetitions, Block &&block) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repetitions; i++) {
+        auto start = std::chrono::steady_clock::now();
+        block();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+/**
+ *  Keeps the optimiser from discarding a computed value
+ */
+template <typename T>
+inline void doNotOptimise(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace benchmark
+} // namespace oslocation
@@ -0,0 +1,109 @@
+//
+//  OSDeliveryQueueBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Feeds a DeliveryQueue synthetic fixes at 1 kHz from one thread while
+//  another handles them, and reports the enqueue to handle latency for each
+//  backpressure policy. The stalling consumer pauses for 50 ms every 500
+//  records, as a recorder flushing to disk might, which overflows the queue.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSClock.h"
+#include "OSDeliveryQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const double kRate = 1000;
+const std::size_t kRecords = 3000;
+const std::size_t kCapacity = 32;
+const std::size_t kStallInterval = 500;
+const double kStall = 0.05;
+
+const char *policyName(Backpressure policy) {
+    switch (policy) {
+        case Backpressure::DropOldest:
+            return "drop oldest";
+        case Backpressure::Coalesce:
+            return "coalesce";
+        case Backpressure::Block:
+            return "block";
+    }
+    return "";
+}
+
+void spinFor(const SystemClock &clock, double seconds) {
+    const double end = clock.now() + seconds;
+    while (clock.now() < end) {
+    }
+}
+
+void run(Backpressure policy, bool stalls) {
+    SystemClock clock;
+    DeliveryQueue queue(kCapacity, policy);
+    std::atomic<bool> finished(false);
+    std::vector<double> latencies;
+    latencies.reserve(kRecords);
+
+    std::thread consumer([&] {
+        DeliveryRecord record;
+        std::size_t handled = 0;
+        for (;;) {
+            const bool last = finished.load(std::memory_order_acquire);
+            if (queue.pop(record)) {
+                latencies.push_back(clock.now() - record.enqueueTime);
+                if (stalls && ++handled % kStallInterval == 0) {
+                    spinFor(clock, kStall);
+                }
+            } else if (last) {
+                break;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    const double start = clock.now();
+    for (std::size_t i = 0; i < kRecords; i++) {
+        clock.sleepUntil(start + i / kRate);
+        const double now = clock.now();
+        queue.push(makeRecord(makeFix(now, 50.9, -1.4), now));
+    }
+    finished.store(true, std::memory_order_release);
+    consumer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    const DeliveryStatistics statistics = queue.statistics();
+    std::printf("%-11s %-9s %5zu handled  %4llu dropped  %4llu coalesced  %4llu blocked  p50 %8.1f us  p99 %8.1f us\n",
+                policyName(policy),
+                stalls ? "stalling" : "steady",
+                latencies.size(),
+                static_cast<unsigned long long>(statistics.dropped),
+                static_cast<unsigned long long>(statistics.coalesced),
+                static_cast<unsigned long long>(statistics.blocked),
+                latencies[latencies.size() / 2] * 1e6,
+                latencies[latencies.size() * 99 / 100] * 1e6);
+}
+
+} // namespace
+
+int main() {
+    std::printf("%zu records at %.0f Hz, capacity %zu\n", kRecords, kRate, kCapacity);
+    for (bool stalls : {false, true}) {
+        for (Backpressure policy : {Backpressure::DropOldest, Backpressure::Coalesce, Backpressure::Block}) {
+            run(policy, stalls);
+        }
+    }
+    return 0;
+}
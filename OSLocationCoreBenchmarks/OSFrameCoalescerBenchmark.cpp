@@ -0,0 +1,207 @@
+//
+//  OSFrameCoalescerBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replays the GPX fixtures at one fix a second alongside a synthetic 100 Hz
+//  compass stream, which follows the direction of travel with sensor noise
+//  and glances 60 degrees either side every 30 seconds. Every callback
+//  redraws a 2000 point route overlay. Reports the callbacks and the CPU
+//  time of callbacks plus coalescing with and without a frame interval.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSFrameCoalescer.h"
+#include "OSGPXReader.h"
+#include "OSLocalFrame.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const double kHeadingRate = 100;
+const std::size_t kOverlayPoints = 2000;
+
+double gaussian(std::uint64_t &state) {
+    auto uniform = [&state] {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (static_cast<double>(state >> 11) + 0.5) / 9007199254740992.0;
+    };
+    return std::sqrt(-2 * std::log(uniform())) * std::cos(2 * M_PI * uniform());
+}
+
+FixBuffer loadTrack(const char *name) {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath(name), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    for (std::size_t i = 0; i < track.size(); i++) {
+        track[i].timestamp = static_cast<double>(i);
+    }
+    return track;
+}
+
+double bearing(const Fix &from, const Fix &to) {
+    double east, north;
+    LocalFrame(from.latitude, from.longitude).toLocal(to.latitude, to.longitude, east, north);
+    const double degrees = std::atan2(east, north) / kDegreesToRadians;
+    return degrees < 0 ? degrees + 360 : degrees;
+}
+
+std::vector<Heading> headingsFor(const FixBuffer &track) {
+    std::vector<Heading> headings;
+    std::uint64_t state = 23;
+    const double duration = track.back().timestamp;
+    for (double t = 0; t < duration; t += 1 / kHeadingRate) {
+        const std::size_t i = static_cast<std::size_t>(t);
+        double direction = bearing(track[i], track[i + 1]);
+        const double glance = std::fmod(t, 30);
+        if (glance < 2) {
+            direction += 60 * std::sin(M_PI * glance);
+        }
+        direction = std::fmod(direction + gaussian(state) * 1.5 + 360, 360);
+        headings.push_back(Heading{t, direction, direction, -1, 5, 0, 0, 0});
+    }
+    return headings;
+}
+
+struct Overlay {
+    explicit Overlay(const FixBuffer &track) : route(kOverlayPoints), screen(kOverlayPoints * 2) {
+        for (std::size_t i = 0; i < kOverlayPoints; i++) {
+            route[i] = track[i % track.size()];
+        }
+    }
+
+    /**
+     *  Stands in for the map redraw: projects the route around the latest
+     *  position, rotated to the heading
+     */
+    void redraw(const Fix &position, double heading) {
+        const LocalFrame frame(position.latitude, position.longitude);
+        const double c = std::cos(heading * kDegreesToRadians), s = std::sin(heading * kDegreesToRadians);
+        for (std::size_t i = 0; i < kOverlayPoints; i++) {
+            double east, north;
+            frame.toLocal(route[i].latitude, route[i].longitude, east, north);
+            screen[2 * i] = east * c - north * s;
+            screen[2 * i + 1] = east * s + north * c;
+        }
+        doNotOptimise(screen.data());
+    }
+
+    FixBuffer route;
+    std::vector<double> screen;
+};
+
+struct Outcome {
+    std::uint64_t callbacks = 0;
+    double seconds = 0;
+};
+
+Outcome replayOnce(const FixBuffer &track, const std::vector<Heading> &headings, const FrameOptions *options) {
+    Overlay overlay(track);
+    Outcome outcome;
+    Fix position = track.front();
+    double heading = 0;
+    auto callback = [&](const FixBuffer &fixes, const Heading *newHeading) {
+        if (!fixes.empty()) {
+            position = fixes.back();
+        }
+        if (newHeading) {
+            heading = newHeading->trueHeading;
+        }
+        overlay.redraw(position, heading);
+        outcome.callbacks++;
+    };
+
+    FrameCoalescer coalescer(options ? *options : FrameOptions());
+    Frame frame;
+    double lastUpdate = 0;
+    // A frame fires when it falls due, but never before the update it carries
+    auto deliverDueFrames = [&](double until) {
+        for (double due = coalescer.nextFrameTime(); due <= until; due = coalescer.nextFrameTime()) {
+            coalescer.takeFrame(std::max(due, lastUpdate), frame);
+            callback(frame.fixes, frame.hasHeading ? &frame.heading : nullptr);
+        }
+    };
+
+    FixBuffer batch(1);
+    std::size_t nextFix = 0;
+    for (const Heading &reading : headings) {
+        while (nextFix < track.size() && track[nextFix].timestamp <= reading.timestamp) {
+            batch[0] = track[nextFix++];
+            if (options) {
+                deliverDueFrames(batch[0].timestamp);
+                coalescer.addFixes(batch, batch[0].timestamp);
+                lastUpdate = batch[0].timestamp;
+            } else {
+                callback(batch, nullptr);
+            }
+        }
+        if (options) {
+            deliverDueFrames(reading.timestamp);
+            coalescer.addHeading(reading, reading.timestamp);
+            lastUpdate = reading.timestamp;
+        } else {
+            callback(FixBuffer(), &reading);
+        }
+    }
+    if (options) {
+        deliverDueFrames(std::numeric_limits<double>::max());
+    }
+    return outcome;
+}
+
+Outcome replay(const FixBuffer &track, const std::vector<Heading> &headings, const FrameOptions *options) {
+    Outcome outcome;
+    const double seconds = bestOf(5, [&] { outcome = replayOnce(track, headings, options); });
+    outcome.seconds = seconds;
+    return outcome;
+}
+
+} // namespace
+
+int main() {
+    struct Configuration {
+        const char *name;
+        double frameInterval;
+        double minimumHeadingChange;
+        double minimumDistance;
+    };
+    const Configuration configurations[] = {
+        {"60 Hz, no thresholds", 1.0 / 60, 0, 0},
+        {"60 Hz, 1 deg / 1 m", 1.0 / 60, 1, 1},
+        {"30 Hz, 2 deg / 2 m", 1.0 / 30, 2, 2},
+    };
+
+    for (const char *name : {"Southampton-OS-route.gpx", "lake-district-trail.gpx"}) {
+        const FixBuffer track = loadTrack(name);
+        const std::vector<Heading> headings = headingsFor(track);
+        std::printf("%s: %zu fixes, %zu headings\n", name, track.size(), headings.size());
+
+        const Outcome direct = replay(track, headings, nullptr);
+        std::printf("  %-22s %7llu callbacks  %7.1f ms\n", "uncoalesced", static_cast<unsigned long long>(direct.callbacks), direct.seconds * 1e3);
+        for (const Configuration &configuration : configurations) {
+            FrameOptions options;
+            options.frameInterval = configuration.frameInterval;
+            options.minimumHeadingChange = configuration.minimumHeadingChange;
+            options.minimumDistance = configuration.minimumDistance;
+            const Outcome coalesced = replay(track, headings, &options);
+            std::printf("  %-22s %7llu callbacks  %7.1f ms  (callbacks %+.1f%%, CPU %+.1f%%)\n",
+                        configuration.name,
+                        static_cast<unsigned long long>(coalesced.callbacks),
+                        coalesced.seconds * 1e3,
+                        100.0 * (static_cast<double>(coalesced.callbacks) / direct.callbacks - 1),
+                        100.0 * (coalesced.seconds / direct.seconds - 1));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+//  OSGPXReaderBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Compares the streaming GPX reader against a libxml2 DOM parse of the GPX
+//  fixtures scaled up 1000 times.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSMappedFile.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+#ifdef OS_HAVE_LIBXML2
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#endif
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const int kScale = 1000;
+
+/**
+ *  Writes a GPX document containing the fixture's points `scale` times and
+ *  returns its path
+ */
+std::string writeScaledFixture(const std::string &name, int scale) {
+    std::string fixture = readFile(fixturePath(name));
+    std::size_t first = fixture.find("<wpt");
+    std::size_t last = fixture.rfind("</gpx>");
+    std::string body = fixture.substr(first, last - first);
+
+    std::string path = "/tmp/oslocation-benchmark-" + std::to_string(getpid()) + "-" + name;
+    FILE *file = std::fopen(path.c_str(), "wb");
+    std::fputs("<gpx xmlns=\"http://www.topografix.com/GPX/1/1\" version=\"1.1\">\n", file);
+    for (int i = 0; i < scale; i++) {
+        std::fwrite(body.data(), 1, body.size(), file);
+    }
+    std::fputs("</gpx>\n", file);
+    std::fclose(file);
+    return path;
+}
+
+struct Checksum {
+    std::size_t points = 0;
+    double sum = 0;
+};
+
+Checksum readStreaming(std::string_view document) {
+    Checksum checksum;
+    GPXReader::read(document, [&checksum](const GPXPoint &point) {
+        checksum.points++;
+        checksum.sum += point.latitude + point.longitude + point.elevation + point.time * 1e-9;
+    });
+    return checksum;
+}
+
+#ifdef OS_HAVE_LIBXML2
+Checksum readDOM(std::string_view document) {
+    Checksum checksum;
+    xmlDocPtr doc = xmlReadMemory(document.data(), static_cast<int>(document.size()), nullptr, nullptr, XML_PARSE_NONET | XML_PARSE_HUGE);
+    for (xmlNodePtr node = xmlDocGetRootElement(doc)->children; node; node = node->next) {
+        if (node->type != XML_ELEMENT_NODE || std::strcmp(reinterpret_cast<const char *>(node->name), "wpt") != 0) {
+            continue;
+        }
+        xmlChar *latitude = xmlGetProp(node, BAD_CAST "lat");
+        xmlChar *longitude = xmlGetProp(node, BAD_CAST "lon");
+        double elevation = 0, time = 0;
+        for (xmlNodePtr child = node->children; child; child = child->next) {
+            if (child->type != XML_ELEMENT_NODE) {
+                continue;
+            }
+            xmlChar *text = xmlNodeGetContent(child);
+            if (std::strcmp(reinterpret_cast<const char *>(child->name), "ele") == 0) {
+                elevation = std::strtod(reinterpret_cast<const char *>(text), nullptr);
+            } else if (std::strcmp(reinterpret_cast<const char *>(child->name), "time") == 0) {
+                gpx::parseTimestamp(reinterpret_cast<const char *>(text), time);
+            }
+            xmlFree(text);
+        }
+        checksum.points++;
+        checksum.sum += std::strtod(reinterpret_cast<const char *>(latitude), nullptr) + std::strtod(reinterpret_cast<const char *>(longitude), nullptr) + elevation + time * 1e-9;
+        xmlFree(latitude);
+        xmlFree(longitude);
+    }
+    xmlFreeDoc(doc);
+    return checksum;
+}
+#endif
+
+void run(const std::string &name) {
+    std::string path = writeScaledFixture(name, kScale);
+    MappedFile file;
+    if (!file.open(path)) {
+        std::fprintf(stderr, "Could not map %s\n", path.c_str());
+        std::exit(1);
+    }
+    double megabytes = static_cast<double>(file.size()) / 1e6;
+    std::printf("%s x%d: %.1f MB\n", name.c_str(), kScale, megabytes);
+
+    Checksum streaming;
+    double seconds = bestOf(5, [&] { streaming = readStreaming(file.contents()); });
+    std::printf("  streaming  %9zu points  %8.1f ms  %8.1f MB/s  %6.1f Mpoints/s\n", streaming.points, seconds * 1e3, megabytes / seconds, streaming.points / seconds / 1e6);
+
+#ifdef OS_HAVE_LIBXML2
+    Checksum dom;
+    seconds = bestOf(3, [&] { dom = readDOM(file.contents()); });
+    std::printf("  libxml2    %9zu points  %8.1f ms  %8.1f MB/s  %6.1f Mpoints/s\n", dom.points, seconds * 1e3, megabytes / seconds, dom.points / seconds / 1e6);
+    if (dom.points != streaming.points || std::abs(dom.sum - streaming.sum) > 1e-6 * std::abs(dom.sum)) {
+        std::printf("  MISMATCH between readers\n");
+    }
+#else
+    std::printf("  libxml2 baseline not built\n");
+#endif
+
+    file.close();
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    run("Southampton-OS-route.gpx");
+    run("lake-district-trail.gpx");
+    return 0;
+}
@@ -0,0 +1,172 @@
+//
+//  OSGeodesicBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replicates the Southampton fixture to ten million points held as
+//  separate latitude and longitude arrays, and times the distances between
+//  consecutive points and from the first point to every other: one pair at
+//  a time with a spherical haversine, the equirectangular formula and
+//  Karney's geodesic, then through the batch kernels at each instruction
+//  set. The error table offsets points of the track by fixed separations
+//  and compares each method with the geodesic.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSFix.h"
+#include "OSGPXReader.h"
+#include "OSGeodesic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kPoints = 10000000;
+const std::size_t kErrorSamples = 100000;
+const double kMeanEarthRadius = 6371008.8;
+
+double haversineDistance(double latitude1, double longitude1, double latitude2, double longitude2) {
+    const double phi1 = latitude1 * kDegreesToRadians, phi2 = latitude2 * kDegreesToRadians;
+    const double sinHalfPhi = std::sin((phi2 - phi1) / 2);
+    const double sinHalfLambda = std::sin((longitude2 - longitude1) * kDegreesToRadians / 2);
+    const double h = sinHalfPhi * sinHalfPhi + std::cos(phi1) * std::cos(phi2) * sinHalfLambda * sinHalfLambda;
+    return 2 * kMeanEarthRadius * std::asin(std::min(1.0, std::sqrt(h)));
+}
+
+struct Track {
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+};
+
+void report(const char *label, double seconds, std::size_t count, double baseline) {
+    std::printf("  %-30s %8.1f ms  %6.2f ns/pair  %7.1f M/s  %5.1fx\n", label, seconds * 1e3, seconds * 1e9 / count, count / seconds / 1e6, baseline / seconds);
+}
+
+template <typename Distance>
+double timePairs(const Track &track, std::vector<double> &distances, Distance distance) {
+    const std::size_t pairs = track.latitudes.size() - 1;
+    const double *latitudes = track.latitudes.data();
+    const double *longitudes = track.longitudes.data();
+    return bestOf(3, [&] {
+        for (std::size_t i = 0; i < pairs; i++) {
+            distances[i] = distance(latitudes[i], longitudes[i], latitudes[i + 1], longitudes[i + 1]);
+        }
+        doNotOptimise(distances.data());
+    });
+}
+
+template <typename Distance>
+double timeFrom(const Track &track, std::vector<double> &distances, Distance distance) {
+    const double latitude = track.latitudes[0], longitude = track.longitudes[0];
+    return bestOf(3, [&] {
+        for (std::size_t i = 0; i < kPoints; i++) {
+            distances[i] = distance(latitude, longitude, track.latitudes[i], track.longitudes[i]);
+        }
+        doNotOptimise(distances.data());
+    });
+}
+
+void throughput(const Track &track) {
+    std::vector<double> distances(kPoints);
+    const simd::Level levels[] = {simd::Level::Scalar, simd::Level::NEON, simd::Level::AVX2};
+
+    std::printf("consecutive pairs (%zu):\n", kPoints - 1);
+    const double haversine = timePairs(track, distances, haversineDistance);
+    report("haversine, one at a time", haversine, kPoints - 1, haversine);
+    report("equirectangular, one at a time", timePairs(track, distances, equirectangularDistance), kPoints - 1, haversine);
+    report("Karney, one at a time", timePairs(track, distances, geodesicDistance), kPoints - 1, haversine);
+    for (simd::Level level : levels) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        const double seconds = bestOf(3, [&] {
+            consecutiveDistances(track.latitudes.data(), track.longitudes.data(), kPoints, distances.data(), level);
+            doNotOptimise(distances.data());
+        });
+        char label[64];
+        std::snprintf(label, sizeof(label), "batch, %s", simd::name(level));
+        report(label, seconds, kPoints - 1, haversine);
+    }
+    const std::size_t pairs = kPoints - 1;
+    const std::size_t refined = static_cast<std::size_t>(std::count_if(distances.begin(), distances.begin() + pairs, [](double d) { return d > kEquirectangularLimit; }));
+    std::printf("  %zu legs longer than %.0f m solved by Karney\n", refined, kEquirectangularLimit);
+
+    std::printf("from the first point (%zu):\n", kPoints);
+    const double haversineFrom = timeFrom(track, distances, haversineDistance);
+    report("haversine, one at a time", haversineFrom, kPoints, haversineFrom);
+    report("equirectangular, one at a time", timeFrom(track, distances, equirectangularDistance), kPoints, haversineFrom);
+    report("Karney, one at a time", timeFrom(track, distances, geodesicDistance), kPoints, haversineFrom);
+    for (simd::Level level : levels) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        const double seconds = bestOf(3, [&] {
+            distancesFrom(track.latitudes[0], track.longitudes[0], track.latitudes.data(), track.longitudes.data(), kPoints, distances.data(), level);
+            doNotOptimise(distances.data());
+        });
+        char label[64];
+        std::snprintf(label, sizeof(label), "batch, %s", simd::name(level));
+        report(label, seconds, kPoints, haversineFrom);
+    }
+    std::printf("  farthest point %.0f m\n", *std::max_element(distances.begin(), distances.end()));
+}
+
+void errors(const Track &track) {
+    std::printf("error against Karney, %zu points of the track offset at each separation:\n", kErrorSamples);
+    std::printf("  %10s  %16s  %16s  %16s\n", "separation", "haversine max", "equirect. max", "batch max");
+    std::vector<double> latitudes(kErrorSamples), longitudes(kErrorSamples);
+    for (double separation : {10.0, 100.0, 1000.0, 5000.0, 20000.0, 100000.0}) {
+        double worstHaversine = 0, worstEquirectangular = 0, worstBatch = 0;
+        for (std::size_t i = 0; i < kErrorSamples; i++) {
+            const double bearing = (i * 7.5) * kDegreesToRadians;
+            const double latitude = track.latitudes[i];
+            const double d = separation / 111200;
+            latitudes[i] = latitude + d * std::cos(bearing);
+            longitudes[i] = track.longitudes[i] + d * std::sin(bearing) / std::cos(latitude * kDegreesToRadians);
+        }
+        // Every sample is measured from its own track point, so the batch
+        // column runs the consecutive kernel over interleaved pairs
+        std::vector<double> pairLatitudes(2 * kErrorSamples), pairLongitudes(2 * kErrorSamples), pairDistances(2 * kErrorSamples - 1);
+        for (std::size_t i = 0; i < kErrorSamples; i++) {
+            pairLatitudes[2 * i] = track.latitudes[i];
+            pairLongitudes[2 * i] = track.longitudes[i];
+            pairLatitudes[2 * i + 1] = latitudes[i];
+            pairLongitudes[2 * i + 1] = longitudes[i];
+        }
+        consecutiveDistances(pairLatitudes.data(), pairLongitudes.data(), 2 * kErrorSamples, pairDistances.data());
+        for (std::size_t i = 0; i < kErrorSamples; i++) {
+            const double exact = geodesicDistance(track.latitudes[i], track.longitudes[i], latitudes[i], longitudes[i]);
+            worstHaversine = std::max(worstHaversine, std::fabs(haversineDistance(track.latitudes[i], track.longitudes[i], latitudes[i], longitudes[i]) - exact));
+            worstEquirectangular = std::max(worstEquirectangular, std::fabs(equirectangularDistance(track.latitudes[i], track.longitudes[i], latitudes[i], longitudes[i]) - exact));
+            worstBatch = std::max(worstBatch, std::fabs(pairDistances[2 * i] - exact));
+        }
+        std::printf("  %8.0f m  %13.3f mm  %13.3f mm  %13.6f mm\n", separation, worstHaversine * 1e3, worstEquirectangular * 1e3, worstBatch * 1e3);
+    }
+}
+
+} // namespace
+
+int main() {
+    FixBuffer fixture;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixture](const GPXPoint &point) { fixture.push_back(makeFix(point, 5)); });
+
+    Track track;
+    track.latitudes.resize(kPoints);
+    track.longitudes.resize(kPoints);
+    for (std::size_t i = 0; i < kPoints; i++) {
+        track.latitudes[i] = fixture[i % fixture.size()].latitude;
+        track.longitudes[i] = fixture[i % fixture.size()].longitude;
+    }
+    std::printf("%zu fixture points replicated to %zu\n", fixture.size(), kPoints);
+
+    throughput(track);
+    errors(track);
+    return 0;
+}
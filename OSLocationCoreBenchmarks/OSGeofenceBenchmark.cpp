@@ -0,0 +1,132 @@
+//
+//  OSGeofenceBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replays the Southampton fixture through a geofence stage holding 10k
+//  circle and polygon fences spread over 40 x 40 km around it, against
+//  testing every fence on every fix.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSGeofence.h"
+#include "OSHelmertTransform.h"
+#include "OSReplaySource.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::uint32_t kFences = 10000;
+
+struct Random {
+    std::uint64_t state = 42;
+    double uniform() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<double>(state >> 11) / 9007199254740992.0;
+    }
+};
+
+/**
+ *  Circles of 20-500 m and irregular polygons of 8-24 vertices. One in a
+ *  hundred is a 20-100 m fence on the route (a few hundred metres across)
+ *  so the track really crosses fences.
+ */
+void addFences(GeofenceEngine &engine, const FixBuffer &track) {
+    Random random;
+    const GridPosition centre = approximateNationalGrid(track.front().latitude, track.front().longitude, 0);
+    for (std::uint32_t id = 0; id < kFences; id++) {
+        double e = centre.easting + (random.uniform() - 0.5) * 40000;
+        double n = centre.northing + (random.uniform() - 0.5) * 40000;
+        double size = 20 + random.uniform() * 480;
+        if (id % 100 == 0) {
+            size = 20 + random.uniform() * 80;
+            const Fix &fix = track[static_cast<std::size_t>(random.uniform() * track.size())];
+            const GridPosition position = approximateNationalGrid(fix.latitude, fix.longitude, 0);
+            e = position.easting + (random.uniform() - 0.5) * 100;
+            n = position.northing + (random.uniform() - 0.5) * 100;
+        }
+        if (id % 2) {
+            engine.addCircle(id, e, n, size);
+            continue;
+        }
+        const int count = 8 + static_cast<int>(random.uniform() * 17);
+        double eastings[24], northings[24];
+        for (int i = 0; i < count; i++) {
+            const double angle = 2 * M_PI * i / count;
+            const double radius = size * (0.5 + 0.5 * random.uniform());
+            eastings[i] = e + radius * std::cos(angle);
+            northings[i] = n + radius * std::sin(angle);
+        }
+        engine.addPolygon(id, eastings, northings, count);
+    }
+}
+
+} // namespace
+
+int main() {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+
+    VirtualClock clock;
+    ReplayOptions options;
+    options.mode = ReplayMode::AsFastAsPossible;
+    options.loops = 200;
+    ReplaySource replay(track, clock, options);
+    GeofenceEngine fences;
+    addFences(fences, track);
+    Pipeline pipeline;
+    GeofenceStage *stage = pipeline.addStage(std::make_unique<GeofenceStage>(fences));
+
+    // Candidates per fix, measured on one pass outside the timing
+    std::size_t candidates = 0;
+    {
+        GeofenceEngine engine;
+        addFences(engine, track);
+        std::vector<GeofenceEvent> scratch;
+        for (const Fix &fix : track) {
+            const GridPosition position = approximateNationalGrid(fix.latitude, fix.longitude, fix.altitude);
+            engine.update(fix.timestamp, position.easting, position.northing, scratch);
+            candidates += engine.lastCandidateCount();
+        }
+    }
+
+    std::size_t events = 0;
+    ReplayStatistics statistics;
+    double seconds = bestOf(1, [&] {
+        statistics = replay.run(pipeline, [&](const FixBuffer &) {
+            events += stage->events().size();
+            stage->events().clear();
+        });
+    });
+    std::printf("indexed     %5u fences  %8llu fixes  %7.1f ms  %6.2f us/fix  %zu events  %.1f candidates/fix\n", kFences, static_cast<unsigned long long>(statistics.fixesEmitted), seconds * 1e3, statistics.nanosecondsPerFix() / 1e3, events, double(candidates) / track.size());
+
+    // Every fence on every fix, as the app does today
+    GeofenceEngine engine;
+    addFences(engine, track);
+    std::vector<GridPosition> positions;
+    for (const Fix &fix : track) {
+        positions.push_back(approximateNationalGrid(fix.latitude, fix.longitude, fix.altitude));
+    }
+    std::size_t inside = 0;
+    seconds = bestOf(3, [&] {
+        inside = 0;
+        for (const GridPosition &position : positions) {
+            for (std::uint32_t id = 0; id < kFences; id++) {
+                inside += engine.signedDistance(id, position.easting, position.northing) >= 0;
+            }
+        }
+    });
+    doNotOptimise(inside);
+    std::printf("linear scan %5u fences  %8zu fixes  %7.1f ms  %6.2f us/fix\n", kFences, positions.size(), seconds * 1e3, seconds * 1e6 / positions.size());
+    return 0;
+}
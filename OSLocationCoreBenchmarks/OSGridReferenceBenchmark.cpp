@@ -0,0 +1,89 @@
+//
+//  OSGridReferenceBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Formats and parses 10 figure grid references for positions spread over
+//  the whole grid, against snprintf/sscanf doing the digit work.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGridReference.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kOperations = 4000000;
+
+void report(const char *label, double seconds) {
+    std::printf("%-22s %8.1f ms  %6.1f ns/op  %6.1f M ops/s\n", label, seconds * 1e3, seconds * 1e9 / kOperations, kOperations / seconds / 1e6);
+}
+
+} // namespace
+
+int main() {
+    // Deterministic spread of positions over the grid
+    std::vector<double> eastings(kOperations), northings(kOperations);
+    std::uint64_t state = 88172645463325252ull;
+    for (std::size_t i = 0; i < kOperations; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        eastings[i] = static_cast<double>(state % 70000000) / 100;
+        northings[i] = static_cast<double>((state >> 32) % 130000000) / 100;
+    }
+
+    std::vector<char> references(kOperations * kGridReferenceMaxLength);
+    std::size_t total = 0;
+    double seconds = bestOf(5, [&] {
+        total = 0;
+        for (std::size_t i = 0; i < kOperations; i++) {
+            total += formatGridReference(eastings[i], northings[i], 10, &references[i * kGridReferenceMaxLength], kGridReferenceMaxLength);
+        }
+    });
+    doNotOptimise(total);
+    report("format", seconds);
+
+    char scratch[32];
+    seconds = bestOf(5, [&] {
+        total = 0;
+        for (std::size_t i = 0; i < kOperations; i++) {
+            const int e = static_cast<int>(eastings[i]), n = static_cast<int>(northings[i]);
+            total += static_cast<std::size_t>(std::snprintf(scratch, sizeof(scratch), "%c%c %05d %05d", 'S', 'U', e % 100000, n % 100000));
+        }
+    });
+    doNotOptimise(total);
+    report("format (snprintf)", seconds);
+
+    double sum = 0;
+    seconds = bestOf(5, [&] {
+        sum = 0;
+        for (std::size_t i = 0; i < kOperations; i++) {
+            double easting, northing;
+            parseGridReference(std::string_view(&references[i * kGridReferenceMaxLength], 14), easting, northing);
+            sum += easting + northing;
+        }
+    });
+    doNotOptimise(sum);
+    report("parse", seconds);
+
+    seconds = bestOf(5, [&] {
+        sum = 0;
+        for (std::size_t i = 0; i < kOperations; i++) {
+            char letters[3];
+            int easting, northing;
+            std::sscanf(&references[i * kGridReferenceMaxLength], "%2s %d %d", letters, &easting, &northing);
+            sum += easting + northing;
+        }
+    });
+    doNotOptimise(sum);
+    report("parse (sscanf)", seconds);
+    return 0;
+}
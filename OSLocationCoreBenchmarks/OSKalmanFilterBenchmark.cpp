@@ -0,0 +1,92 @@
+//
+//  OSKalmanFilterBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Adds gaussian noise to the Southampton fixture, treating the recorded
+//  track as ground truth, and reports the error before and after the
+//  Kalman filter along with the cost per fix.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSKalmanFilter.h"
+#include "OSLocalFrame.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kFixes = 1000000;
+
+double gaussian(std::uint64_t &state) {
+    auto uniform = [&state] {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (static_cast<double>(state >> 11) + 0.5) / 9007199254740992.0;
+    };
+    return std::sqrt(-2 * std::log(uniform())) * std::cos(2 * M_PI * uniform());
+}
+
+FixBuffer noisy(const FixBuffer &truth, double sigma) {
+    FixBuffer fixes = truth;
+    std::uint64_t state = 42;
+    for (Fix &fix : fixes) {
+        const LocalFrame frame(fix.latitude, fix.longitude);
+        frame.toGeodetic(gaussian(state) * sigma, gaussian(state) * sigma, fix.latitude, fix.longitude);
+        fix.horizontalAccuracy = sigma;
+    }
+    return fixes;
+}
+
+double rmsError(const FixBuffer &fixes, const FixBuffer &truth) {
+    double sum = 0;
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const LocalFrame frame(truth[i].latitude, truth[i].longitude);
+        double east, north;
+        frame.toLocal(fixes[i].latitude, fixes[i].longitude, east, north);
+        sum += east * east + north * north;
+    }
+    return std::sqrt(sum / fixes.size());
+}
+
+} // namespace
+
+int main() {
+    FixBuffer truth;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&truth](const GPXPoint &point) { truth.push_back(makeFix(point, 5)); });
+
+    for (double sigma : {3.0, 5.0, 10.0, 20.0}) {
+        FixBuffer fixes = noisy(truth, sigma);
+        const double raw = rmsError(fixes, truth);
+        KalmanFilter filter;
+        filter.process(fixes);
+        std::printf("noise %4.0f m: rms error raw %5.2f m, filtered %5.2f m\n", sigma, raw, rmsError(fixes, truth));
+    }
+
+    // The fixture repeated with its timestamps continued, so the filter sees
+    // one long journey rather than restarting on each repetition
+    const FixBuffer once = noisy(truth, 5);
+    const double duration = once.back().timestamp - once.front().timestamp + 1;
+    FixBuffer track(kFixes);
+    for (std::size_t i = 0; i < kFixes; i++) {
+        track[i] = once[i % once.size()];
+        track[i].timestamp += duration * static_cast<double>(i / once.size());
+    }
+    FixBuffer fixes;
+    const double seconds = bestOf(5, [&] {
+        fixes = track;
+        KalmanFilter filter;
+        filter.process(fixes);
+    });
+    doNotOptimise(fixes.back().latitude);
+    std::printf("%zu fixes in %.1f ms, %.1f ns/fix\n", kFixes, seconds * 1e3, seconds * 1e9 / kFixes);
+    return 0;
+}
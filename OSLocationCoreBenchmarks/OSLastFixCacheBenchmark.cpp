@@ -0,0 +1,127 @@
+//
+//  OSLastFixCacheBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replays launches along the Southampton fixture on a virtual clock. A
+//  first session caches fixes until it ends, and after a gap a second
+//  session starts whose live fixes only begin once an assumed five second
+//  cold start has passed. Reports the time to the first callback with the
+//  cache on and off, and how far the provisional fix was from where the
+//  user had got to against the accuracy it claimed.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSGeodesic.h"
+#include "OSLastFixCache.h"
+#include "OSReplaySource.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+/**
+ *  Seconds CoreLocation is assumed to take to produce its first fix
+ */
+const double kColdStart = 5;
+
+double median(std::vector<double> values) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+    return values[values.size() / 2];
+}
+
+/**
+ *  Time from launch to the first live batch, replaying from `launch`
+ */
+double timeToFirstLiveFix(const FixBuffer &track, double launch) {
+    FixBuffer session;
+    for (const Fix &fix : track) {
+        if (fix.timestamp >= launch) {
+            session.push_back(fix);
+        }
+    }
+    VirtualClock clock(launch);
+    ReplaySource replay(session, clock);
+    FixBuffer batch;
+    while (replay.nextBatch(batch)) {
+        // Nothing comes out of CoreLocation until the cold start is over
+        if (batch.front().timestamp >= launch + kColdStart) {
+            break;
+        }
+    }
+    return clock.now() - launch;
+}
+
+} // namespace
+
+int main() {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    const std::string path = "/tmp/OSLastFixCacheBenchmark.cache";
+    const double start = track.front().timestamp;
+
+    std::printf("gap     launches  provisional  first callback off / on    provisional error  claimed accuracy  within claim\n");
+    for (double gap : {10.0, 60.0, 300.0}) {
+        std::vector<double> off, on, errors, accuracies;
+        std::size_t launches = 0, provisional = 0, covered = 0;
+        for (std::size_t launchIndex = 0; launchIndex < track.size(); launchIndex += 10) {
+            const double launch = track[launchIndex].timestamp;
+            if (launch - gap - start < 30) {
+                continue;
+            }
+            launches++;
+
+            // The first session, ended `gap` before the launch
+            std::remove(path.c_str());
+            {
+                LastFixCache cache;
+                cache.open(path);
+                for (const Fix &fix : track) {
+                    if (fix.timestamp > launch - gap) {
+                        break;
+                    }
+                    cache.update(fix);
+                }
+            }
+
+            const double live = timeToFirstLiveFix(track, launch);
+            off.push_back(live);
+
+            auto loadStart = std::chrono::steady_clock::now();
+            LastFixCache cache;
+            cache.open(path);
+            Fix fix;
+            const bool hasProvisional = cache.provisionalFix(launch, fix);
+            const std::chrono::duration<double> load = std::chrono::steady_clock::now() - loadStart;
+            if (!hasProvisional) {
+                on.push_back(live);
+                continue;
+            }
+            provisional++;
+            on.push_back(load.count());
+            const Fix &truth = track[launchIndex];
+            const double error = distanceBetween(fix.latitude, fix.longitude, truth.latitude, truth.longitude);
+            errors.push_back(error);
+            accuracies.push_back(fix.horizontalAccuracy);
+            covered += error <= fix.horizontalAccuracy;
+        }
+        std::printf("%4.0f s  %8zu  %10zu   %6.2f s / %8.1f us       %7.1f m          %7.1f m       %5.1f%%\n",
+                    gap, launches, provisional, median(off), median(on) * 1e6, median(errors), median(accuracies),
+                    provisional ? 100.0 * covered / provisional : 0.0);
+    }
+    std::printf("(medians; launches after gaps beyond the %.0f minute maximum age wait for a live fix)\n", LastFixCacheOptions().maximumAge / 60);
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,71 @@
+//
+//  OSNationalGridBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Compares the approximate Helmert conversion with OSTN15 on a track built
+//  from the Southampton fixture, in time per fix and in how far apart the
+//  two land. Set OSTN15_GRID to a file written by OSTN15Convert for the
+//  real accuracy envelope; without it only the timings are meaningful.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSFix.h"
+#include "OSGPXReader.h"
+#include "OSNationalGridStage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kFixes = 200000;
+
+void run(const char *label, GridConversion conversion, const OSTN15Grid *grid, const FixBuffer &track, FixBuffer &fixes) {
+    NationalGridStage stage(conversion, grid);
+    const double seconds = bestOf(5, [&] {
+        fixes = track;
+        stage.process(fixes);
+    });
+    doNotOptimise(fixes.back().easting);
+    std::printf("%-12s %8.2f ms  %6.1f ns/fix\n", label, seconds * 1e3, seconds * 1e9 / fixes.size());
+}
+
+} // namespace
+
+int main() {
+    FixBuffer fixture;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixture](const GPXPoint &point) { fixture.push_back(makeFix(point, 5)); });
+
+    FixBuffer track(kFixes);
+    for (std::size_t i = 0; i < kFixes; i++) {
+        track[i] = fixture[i % fixture.size()];
+    }
+
+    OSTN15Grid grid;
+    const char *path = std::getenv("OSTN15_GRID");
+    const bool haveGrid = path && grid.open(path);
+
+    FixBuffer approximate, precise;
+    run("approximate", GridConversion::Approximate, nullptr, track, approximate);
+    if (!haveGrid) {
+        std::printf("precise      skipped (set OSTN15_GRID)\n");
+        return 0;
+    }
+    run("precise", GridConversion::Precise, &grid, track, precise);
+
+    double worst = 0, total = 0;
+    for (std::size_t i = 0; i < kFixes; i++) {
+        const double distance = std::hypot(approximate[i].easting - precise[i].easting, approximate[i].northing - precise[i].northing);
+        worst = std::max(worst, distance);
+        total += distance;
+    }
+    std::printf("approximate vs precise: mean %.2f m, max %.2f m\n", total / kFixes, worst);
+    return 0;
+}
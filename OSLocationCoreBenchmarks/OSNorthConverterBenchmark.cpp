@@ -0,0 +1,108 @@
+//
+//  OSNorthConverterBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Converts a 50 Hz compass stream to grid north along the GPX fixtures,
+//  replayed at one fix a second. Compares building and evaluating the World
+//  Magnetic Model for every heading, as a direct port of the reference code
+//  would, against the precomputed evaluator and against NorthConverter's
+//  per-cell cache. Reports the time per heading, the cache hit rate and the
+//  largest difference from the exact grid heading.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSNorthConverter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const int kHeadingsPerFix = 50;
+const double kDecimalYear = 2026.5;
+
+struct Sample {
+    double latitude;
+    double longitude;
+    Heading heading;
+};
+
+std::vector<Sample> loadSamples(const char *name) {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath(name), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    std::vector<Sample> samples;
+    for (std::size_t i = 0; i + 1 < track.size(); i++) {
+        for (int j = 0; j < kHeadingsPerFix; j++) {
+            const double t = static_cast<double>(j) / kHeadingsPerFix;
+            const double latitude = track[i].latitude + t * (track[i + 1].latitude - track[i].latitude);
+            const double longitude = track[i].longitude + t * (track[i + 1].longitude - track[i].longitude);
+            const double magnetic = std::fmod(i * 7.0 + j * 0.3, 360);
+            samples.push_back(Sample{latitude, longitude, Heading{i + t, magnetic, -1, -1, 5, 0, 0, 0}});
+        }
+    }
+    return samples;
+}
+
+double exactGrid(const MagneticModel &model, const TransverseMercator &projection, const Sample &sample) {
+    const double grid = sample.heading.magneticHeading + model.declination(sample.latitude, sample.longitude) - gridConvergence(projection, sample.latitude, sample.longitude);
+    return std::fmod(grid + 360, 360);
+}
+
+} // namespace
+
+int main() {
+    const TransverseMercator projection = nationalGridProjection(kGRS80);
+    const MagneticModel model(kDecimalYear);
+
+    for (const char *name : {"Southampton-OS-route.gpx", "lake-district-trail.gpx"}) {
+        const std::vector<Sample> samples = loadSamples(name);
+        std::vector<double> grid(samples.size());
+        std::printf("%s: %zu headings\n", name, samples.size());
+
+        const double naive = bestOf(5, [&] {
+            for (std::size_t i = 0; i < samples.size(); i++) {
+                grid[i] = exactGrid(MagneticModel(kDecimalYear), projection, samples[i]);
+            }
+            doNotOptimise(grid.data());
+        });
+        const double precomputed = bestOf(5, [&] {
+            for (std::size_t i = 0; i < samples.size(); i++) {
+                grid[i] = exactGrid(model, projection, samples[i]);
+            }
+            doNotOptimise(grid.data());
+        });
+        const std::vector<double> exact = grid;
+
+        NorthCacheStatistics statistics;
+        const double cached = bestOf(5, [&] {
+            NorthConverter converter(model, projection);
+            for (std::size_t i = 0; i < samples.size(); i++) {
+                grid[i] = converter.apply(samples[i].heading, samples[i].latitude, samples[i].longitude).gridHeading;
+            }
+            doNotOptimise(grid.data());
+            statistics = converter.statistics();
+        });
+        double largestError = 0;
+        for (std::size_t i = 0; i < samples.size(); i++) {
+            largestError = std::max(largestError, angularDifference(grid[i], exact[i]));
+        }
+
+        const double count = static_cast<double>(samples.size());
+        std::printf("  naive WMM per call   %8.1f ns/heading\n", naive / count * 1e9);
+        std::printf("  precomputed WMM      %8.1f ns/heading  (%.1fx)\n", precomputed / count * 1e9, naive / precomputed);
+        std::printf("  1 km cell cache      %8.1f ns/heading  (%.1fx)  %.2f%% hits  largest error %.4f deg\n",
+                    cached / count * 1e9,
+                    naive / cached,
+                    100.0 * statistics.hits / (statistics.hits + statistics.misses),
+                    largestError);
+    }
+    return 0;
+}
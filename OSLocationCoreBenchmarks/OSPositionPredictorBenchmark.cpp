@@ -0,0 +1,98 @@
+//
+//  OSPositionPredictorBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Feeds the Southampton fixture, recorded at 1 Hz, to the predictor one
+//  fix at a time and compares the position it predicts 1 s and 3 s ahead
+//  with the fixes recorded then, which it has not yet seen. Holding the
+//  last fix, as a display without prediction does, is the baseline. Then
+//  times the query a display link would make on every frame.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSGeodesic.h"
+#include "OSPositionPredictor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kQueries = 10000000;
+
+struct Errors {
+    double median;
+    double p95;
+};
+
+Errors summarise(std::vector<double> &errors) {
+    std::sort(errors.begin(), errors.end());
+    return {errors[errors.size() / 2], errors[errors.size() * 95 / 100]};
+}
+
+/**
+ *  Errors of predictions `horizon` seconds after each fix against the fix
+ *  recorded then, holding the last fix when `predictor` is null
+ */
+Errors evaluate(const FixBuffer &fixes, double horizon, PositionPredictor *predictor) {
+    std::vector<double> errors;
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const Fix &fix = fixes[i];
+        if (predictor) {
+            predictor->update(fix);
+        }
+        // The first fix recorded `horizon` after this one
+        std::size_t j = i + 1;
+        while (j < fixes.size() && fixes[j].timestamp < fix.timestamp + horizon) {
+            j++;
+        }
+        if (j == fixes.size() || fixes[j].timestamp != fix.timestamp + horizon) {
+            continue;
+        }
+        double latitude = fix.latitude, longitude = fix.longitude;
+        if (predictor) {
+            predictor->predict(fix.timestamp + horizon, latitude, longitude);
+        }
+        errors.push_back(equirectangularDistance(latitude, longitude, fixes[j].latitude, fixes[j].longitude));
+    }
+    return summarise(errors);
+}
+
+} // namespace
+
+int main() {
+    FixBuffer fixes;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixes](const GPXPoint &point) { fixes.push_back(makeFix(point, 5)); });
+
+    std::printf("error against held out fixes  median / 95th percentile\n");
+    for (double horizon : {1.0, 3.0}) {
+        const Errors held = evaluate(fixes, horizon, nullptr);
+        PositionPredictor predictor;
+        const Errors predicted = evaluate(fixes, horizon, &predictor);
+        std::printf("%.0f s ahead: last fix %5.2f / %5.2f m, predicted %5.2f / %5.2f m\n", horizon, held.median, held.p95, predicted.median, predicted.p95);
+    }
+
+    // A display link at 60 Hz between fixes a second apart
+    PositionPredictor predictor;
+    predictor.update(fixes[0]);
+    predictor.update(fixes[1]);
+    double sum = 0;
+    const double seconds = bestOf(5, [&] {
+        for (std::size_t i = 0; i < kQueries; i++) {
+            double latitude = 0, longitude = 0;
+            predictor.predict(fixes[1].timestamp + static_cast<double>(i % 60) / 60, latitude, longitude);
+            sum += latitude + longitude;
+        }
+    });
+    doNotOptimise(sum);
+    std::printf("predict: %.1f ns per query\n", seconds / kQueries * 1e9);
+    return 0;
+}
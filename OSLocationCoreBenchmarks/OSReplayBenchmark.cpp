@@ -0,0 +1,59 @@
+//
+//  OSReplayBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Soaks the pipeline with the Southampton fixture looped for a simulated
+//  day, on a virtual clock at recorded cadence and as fast as possible.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSReplaySource.h"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+FixBuffer loadTrack() {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    return track;
+}
+
+void report(const char *label, const ReplayStatistics &statistics, double wallSeconds) {
+    std::printf("%-22s %9llu fixes  %7.1f h of track  %8.1f ms wall  %7.1f ns/fix in pipeline  slowest batch %lld ns\n",
+                label,
+                static_cast<unsigned long long>(statistics.fixesEmitted),
+                statistics.trackSeconds / 3600,
+                wallSeconds * 1e3,
+                statistics.nanosecondsPerFix(),
+                static_cast<long long>(statistics.slowestBatch.count()));
+}
+
+} // namespace
+
+int main() {
+    FixBuffer track = loadTrack();
+    const unsigned loops = 24 * 3600 / 469;
+
+    for (ReplayMode mode : {ReplayMode::Timed, ReplayMode::AsFastAsPossible}) {
+        VirtualClock clock;
+        ReplayOptions options;
+        options.mode = mode;
+        options.loops = loops;
+        ReplaySource replay(track, clock, options);
+        Pipeline pipeline;
+        std::size_t delivered = 0;
+        ReplayStatistics statistics;
+        double seconds = bestOf(1, [&] { statistics = replay.run(pipeline, [&delivered](const FixBuffer &batch) { delivered += batch.size(); }); });
+        doNotOptimise(delivered);
+        report(mode == ReplayMode::Timed ? "virtual clock 1x" : "as fast as possible", statistics, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+//
+//  OSRouteMatcherBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Lays copies of the Southampton route side by side into a route of
+//  50,000 vertices and rides it at 10 m/s with 3 m of noise, leaving it for
+//  a minute every 2,000 fixes. Compares the time per fix of the incremental
+//  matcher with projecting every fix onto every segment, as an app holding
+//  the route polyline would, and how often each places the rider more than
+//  50 m along the route from where they are.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSGeodesic.h"
+#include "OSLocalFrame.h"
+#include "OSRouteMatcher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kVertices = 50000;
+const double kSpeed = 10;
+const double kNoise = 3;
+const std::size_t kDetourInterval = 2000;
+const std::size_t kDetourLength = 60;
+
+double gaussian(std::uint64_t &state) {
+    auto uniform = [&state] {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (static_cast<double>(state >> 11) + 0.5) / 9007199254740992.0;
+    };
+    return std::sqrt(-2 * std::log(uniform())) * std::cos(2 * M_PI * uniform());
+}
+
+struct Position {
+    double timestamp, latitude, longitude;
+};
+
+std::vector<Position> ride(const std::vector<double> &latitudes, const std::vector<double> &longitudes) {
+    std::vector<Position> positions;
+    std::uint64_t state = 29;
+    double carried = 0;
+    for (std::size_t i = 0; i + 1 < latitudes.size(); i++) {
+        const double length = distanceBetween(latitudes[i], longitudes[i], latitudes[i + 1], longitudes[i + 1]);
+        double along = carried;
+        for (; along < length; along += kSpeed) {
+            const double t = along / length;
+            Position position{static_cast<double>(positions.size()), latitudes[i] + t * (latitudes[i + 1] - latitudes[i]), longitudes[i] + t * (longitudes[i + 1] - longitudes[i])};
+            // Detours head 150 m out to the north and back
+            const std::size_t phase = positions.size() % kDetourInterval;
+            double north = 0;
+            if (phase >= kDetourInterval - kDetourLength) {
+                north = 150 * std::sin(M_PI * (phase - (kDetourInterval - kDetourLength)) / kDetourLength);
+            }
+            LocalFrame(position.latitude, position.longitude).toGeodetic(gaussian(state) * kNoise, north + gaussian(state) * kNoise, position.latitude, position.longitude);
+            positions.push_back(position);
+        }
+        carried = along - length;
+    }
+    return positions;
+}
+
+RouteMatch bruteForce(const Route &route, const Position &position) {
+    RouteMatch best = route.project(0, position.latitude, position.longitude);
+    for (std::uint32_t segment = 1; segment < route.segmentCount(); segment++) {
+        const RouteMatch match = route.project(segment, position.latitude, position.longitude);
+        if (match.distanceFromRoute < best.distanceFromRoute) {
+            best = match;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    std::vector<double> fixtureLatitudes, fixtureLongitudes;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&](const GPXPoint &point) {
+        fixtureLatitudes.push_back(point.latitude);
+        fixtureLongitudes.push_back(point.longitude);
+    });
+
+    // The fixture is a loop, so copies go side by side to the east with a
+    // leg from the end of each to the start of the next
+    const auto extent = std::minmax_element(fixtureLongitudes.begin(), fixtureLongitudes.end());
+    const double spacing = *extent.second - *extent.first + 0.002;
+    std::vector<double> latitudes, longitudes;
+    for (std::size_t copy = 0; latitudes.size() < kVertices; copy++) {
+        for (std::size_t i = 0; i < fixtureLatitudes.size() && latitudes.size() < kVertices; i++) {
+            latitudes.push_back(fixtureLatitudes[i]);
+            longitudes.push_back(fixtureLongitudes[i] + copy * spacing);
+        }
+    }
+
+    Route route;
+    const double buildSeconds = bestOf(3, [&] { route.assign(latitudes.data(), longitudes.data(), latitudes.size()); });
+    const std::vector<Position> positions = ride(latitudes, longitudes);
+    std::printf("route: %zu vertices, %.1f km, indexed in %.1f ms; %zu fixes\n", route.vertexCount(), route.length() / 1000, buildSeconds * 1e3, positions.size());
+
+    std::vector<RouteProgress> matched(positions.size());
+    std::size_t tested = 0, offRouteEvents = 0;
+    const double matcherSeconds = bestOf(5, [&] {
+        RouteMatcher matcher(route);
+        std::vector<RouteEvent> events;
+        tested = 0;
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            matcher.update(positions[i].timestamp, positions[i].latitude, positions[i].longitude, matched[i], events);
+            tested += matcher.lastSegmentsTested();
+        }
+        offRouteEvents = 0;
+        for (const RouteEvent &event : events) {
+            offRouteEvents += event.transition == RouteTransition::OffRoute;
+        }
+        doNotOptimise(matched.data());
+    });
+
+    std::vector<RouteMatch> scanned(positions.size());
+    const double bruteSeconds = bestOf(1, [&] {
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            scanned[i] = bruteForce(route, positions[i]);
+        }
+        doNotOptimise(scanned.data());
+    });
+
+    // Fixes are a known distance along the route, away from detours
+    std::size_t counted = 0, matcherWrong = 0, bruteWrong = 0;
+    for (std::size_t i = 0; i < positions.size(); i++) {
+        if (i % kDetourInterval >= kDetourInterval - kDetourLength) {
+            continue;
+        }
+        const double truth = i * kSpeed;
+        counted++;
+        matcherWrong += std::fabs(matched[i].distanceAlongRoute - truth) > 50;
+        bruteWrong += std::fabs(scanned[i].distanceAlongRoute - truth) > 50;
+    }
+
+    std::printf("%-12s %9.1f ms  %9.2f us/fix  %8.1f segments/fix\n", "brute force", bruteSeconds * 1e3, bruteSeconds * 1e6 / positions.size(), static_cast<double>(route.segmentCount()));
+    std::printf("%-12s %9.1f ms  %9.2f us/fix  %8.1f segments/fix  (%.0fx)\n", "incremental", matcherSeconds * 1e3, matcherSeconds * 1e6 / positions.size(), static_cast<double>(tested) / positions.size(), bruteSeconds / matcherSeconds);
+    std::printf("fixes matched more than 50 m along the route from the truth: brute force %zu of %zu, incremental %zu\n", bruteWrong, counted, matcherWrong);
+    std::printf("%zu off route events for %zu detours\n", offRouteEvents, positions.size() / kDetourInterval);
+    return 0;
+}
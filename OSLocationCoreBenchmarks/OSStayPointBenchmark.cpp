@@ -0,0 +1,130 @@
+//
+//  OSStayPointBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Replays the Southampton fixture at one fix a second with a lunch break
+//  and two shorter stops inserted, with and without stay point detection,
+//  and reports the delegate callbacks and stored points each produces.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSLocalFrame.h"
+#include "OSReplaySource.h"
+#include "OSStayPointDetector.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const unsigned kLoops = 20;
+
+struct Pause {
+    std::size_t index;
+    double seconds;
+};
+
+double gaussian(std::uint64_t &state) {
+    auto uniform = [&state] {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (static_cast<double>(state >> 11) + 0.5) / 9007199254740992.0;
+    };
+    return std::sqrt(-2 * std::log(uniform())) * std::cos(2 * M_PI * uniform());
+}
+
+/**
+ *  The fixture at one fix a second, with each pause inserted as a fix a
+ *  second of 3 m noise around the stopping point
+ */
+FixBuffer trackWithPauses() {
+    FixBuffer walk;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&walk](const GPXPoint &point) { walk.push_back(makeFix(point, 5)); });
+
+    const Pause pauses[] = {{120, 45 * 60}, {300, 10 * 60}, {420, 5 * 60}};
+    std::uint64_t state = 17;
+    FixBuffer track;
+    double timestamp = 0;
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < walk.size(); i++) {
+        if (next < 3 && pauses[next].index == i) {
+            const LocalFrame frame(walk[i].latitude, walk[i].longitude);
+            for (double elapsed = 0; elapsed < pauses[next].seconds; elapsed++) {
+                Fix fix = walk[i];
+                frame.toGeodetic(gaussian(state) * 3, gaussian(state) * 3, fix.latitude, fix.longitude);
+                fix.timestamp = timestamp++;
+                track.push_back(fix);
+            }
+            next++;
+        }
+        Fix fix = walk[i];
+        fix.timestamp = timestamp++;
+        track.push_back(fix);
+    }
+    return track;
+}
+
+struct Outcome {
+    std::uint64_t emitted = 0;
+    std::uint64_t callbacks = 0;
+    std::uint64_t stored = 0;
+    std::uint64_t stays = 0;
+    double nanosecondsPerFix = 0;
+};
+
+Outcome replay(const FixBuffer &track, bool detectStays) {
+    VirtualClock clock;
+    ReplayOptions options;
+    options.mode = ReplayMode::AsFastAsPossible;
+    options.loops = kLoops;
+    ReplaySource source(track, clock, options);
+    Pipeline pipeline;
+    StayPointDetector *detector = detectStays ? pipeline.addStage(std::make_unique<StayPointDetector>()) : nullptr;
+
+    Outcome outcome;
+    const ReplayStatistics statistics = source.run(pipeline, [&outcome, detector](const FixBuffer &batch) {
+        outcome.callbacks++;
+        outcome.stored += batch.size();
+        if (detector) {
+            outcome.stays += detector->events().size();
+            detector->events().clear();
+        }
+    });
+    outcome.emitted = statistics.fixesEmitted;
+    outcome.nanosecondsPerFix = statistics.nanosecondsPerFix();
+    return outcome;
+}
+
+void report(const char *label, const Outcome &outcome) {
+    std::printf("%-20s %8llu fixes in  %8llu callbacks  %8llu points stored  %4llu stay events  %5.1f ns/fix\n",
+                label,
+                static_cast<unsigned long long>(outcome.emitted),
+                static_cast<unsigned long long>(outcome.callbacks),
+                static_cast<unsigned long long>(outcome.stored),
+                static_cast<unsigned long long>(outcome.stays),
+                outcome.nanosecondsPerFix);
+}
+
+} // namespace
+
+int main() {
+    const FixBuffer track = trackWithPauses();
+    const Outcome plain = replay(track, false);
+    const Outcome stays = replay(track, true);
+    std::printf("%u loops of %.1f min with 60 min of stops each\n", kLoops, (track.back().timestamp - track.front().timestamp) / 60);
+    report("no stay detection", plain);
+    report("stay detection", stays);
+    std::printf("callbacks cut by %.1f%%, stored points cut by %.1f%%\n",
+                100.0 * (1 - static_cast<double>(stays.callbacks) / plain.callbacks),
+                100.0 * (1 - static_cast<double>(stays.stored) / plain.stored));
+    return 0;
+}
@@ -0,0 +1,74 @@
+//
+//  OSSubscriptionHubBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Publishes the Southampton fixture, one fix per batch as CoreLocation
+//  usually delivers them, to a growing number of subscribers with a mix of
+//  distance, interval and accuracy filters, and reports the dispatch cost.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSSubscriptionHub.h"
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kFixes = 200000;
+
+SubscriptionOptions optionsFor(std::size_t index) {
+    SubscriptionOptions options;
+    switch (index % 4) {
+        case 0:
+            break;
+        case 1:
+            options.minimumDistance = 10;
+            break;
+        case 2:
+            options.minimumInterval = 5;
+            break;
+        case 3:
+            options.maximumAccuracy = 20;
+            options.minimumDistance = 3;
+            break;
+    }
+    return options;
+}
+
+} // namespace
+
+int main() {
+    FixBuffer once;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&once](const GPXPoint &point) { once.push_back(makeFix(point, 5)); });
+    FixBuffer track(kFixes);
+    for (std::size_t i = 0; i < kFixes; i++) {
+        track[i] = once[i % once.size()];
+        track[i].timestamp = static_cast<double>(i);
+        track[i].sourceIndex = 0;
+    }
+
+    for (std::size_t subscribers : {1, 2, 4, 8, 16, 64, 256}) {
+        std::uint64_t delivered = 0;
+        FixBuffer batch(1);
+        const double seconds = bestOf(3, [&] {
+            SubscriptionHub hub;
+            for (std::size_t s = 0; s < subscribers; s++) {
+                hub.subscribe(optionsFor(s), [&delivered](const FixBuffer &fixes) { delivered += fixes.size(); });
+            }
+            for (const Fix &fix : track) {
+                batch[0] = fix;
+                hub.publish(batch);
+            }
+        });
+        doNotOptimise(delivered);
+        std::printf("%4zu subscribers: %8.1f ns/fix  %6.1f ns/fix/subscriber\n", subscribers, seconds * 1e9 / kFixes, seconds * 1e9 / kFixes / subscribers);
+    }
+    return 0;
+}
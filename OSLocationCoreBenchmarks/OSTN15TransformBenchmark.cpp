@@ -0,0 +1,97 @@
+//
+//  OSTN15TransformBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Converts a 1M point track built from the Southampton fixture to the
+//  National Grid, point by point with the reference projection and in batch
+//  with each kernel. Set OSTN15_GRID to a file written by OSTN15Convert to
+//  use the real grid; otherwise a synthetic grid of the same size is used.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSTN15Transform.h"
+#include "OSTransverseMercator.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kPoints = 1000000;
+
+void loadGrid(OSTN15Grid &grid) {
+    const char *path = std::getenv("OSTN15_GRID");
+    if (path && grid.open(path)) {
+        std::printf("grid: %s\n", path);
+        return;
+    }
+    std::vector<OSTN15Node> nodes;
+    nodes.reserve(static_cast<std::size_t>(OSTN15Grid::kColumns) * OSTN15Grid::kRows);
+    for (std::uint32_t row = 0; row < OSTN15Grid::kRows; row++) {
+        for (std::uint32_t column = 0; column < OSTN15Grid::kColumns; column++) {
+            nodes.push_back(OSTN15Node{95.0f + column * 0.01f, -80.0f + row * 0.01f, 45.0f + (column % 7) * 0.1f, 1});
+        }
+    }
+    grid.assign(std::move(nodes), OSTN15Grid::kColumns, OSTN15Grid::kRows);
+    std::printf("grid: synthetic (set OSTN15_GRID for the real one)\n");
+}
+
+} // namespace
+
+int main() {
+    std::vector<GPXPoint> fixture;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixture](const GPXPoint &point) { fixture.push_back(point); });
+
+    std::vector<double> latitudes(kPoints), longitudes(kPoints), heights(kPoints);
+    for (std::size_t i = 0; i < kPoints; i++) {
+        const GPXPoint &point = fixture[i % fixture.size()];
+        const double offset = static_cast<double>(i / fixture.size()) * 1e-4;
+        latitudes[i] = point.latitude + offset;
+        longitudes[i] = point.longitude - offset;
+        heights[i] = point.elevation;
+    }
+
+    OSTN15Grid grid;
+    loadGrid(grid);
+    OSTN15Transform transform(grid);
+    std::vector<double> eastings(kPoints), northings(kPoints), orthometric(kPoints);
+
+    double seconds = bestOf(3, [&] {
+        const TransverseMercator projection = nationalGridProjection(kGRS80);
+        for (std::size_t i = 0; i < kPoints; i++) {
+            double e, n;
+            projectTransverseMercator(projection, latitudes[i], longitudes[i], e, n);
+            OSTN15Shift shift{};
+            grid.shift(e, n, shift);
+            eastings[i] = e + shift.eastShift;
+            northings[i] = n + shift.northShift;
+            orthometric[i] = heights[i] - shift.geoidHeight;
+        }
+    });
+    doNotOptimise(eastings[kPoints - 1]);
+    std::printf("%-26s %8.1f ms  %6.1f ns/point\n", "reference, point by point", seconds * 1e3, seconds * 1e9 / kPoints);
+    const std::vector<double> referenceEastings = eastings, referenceNorthings = northings;
+
+    for (simd::Level level : {simd::Level::Scalar, simd::Level::NEON, simd::Level::AVX2}) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        seconds = bestOf(5, [&] {
+            transform.transform(latitudes.data(), longitudes.data(), heights.data(), kPoints, eastings.data(), northings.data(), orthometric.data(), level);
+        });
+        double worst = 0;
+        for (std::size_t i = 0; i < kPoints; i++) {
+            worst = std::max(worst, std::max(std::abs(eastings[i] - referenceEastings[i]), std::abs(northings[i] - referenceNorthings[i])));
+        }
+        std::printf("batch %-20s %8.1f ms  %6.1f ns/point  max difference from reference %.2e m\n", simd::name(level), seconds * 1e3, seconds * 1e9 / kPoints, worst);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+//
+//  OSTrackFileBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Writes a 1M point GPX track built from the Southampton fixture (a day
+//  of recording at one fix per 86 ms), converts it to a track file and
+//  compares size and load time, plus lookups of one minute and of a small
+//  area that only decode the blocks they need.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSTrackFile.h"
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kPoints = 1000000;
+
+bool writeLargeGPX(const std::string &path) {
+    std::vector<GPXPoint> fixture;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixture](const GPXPoint &point) { fixture.push_back(point); });
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    if (!file || fixture.empty()) {
+        return false;
+    }
+    std::fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<gpx xmlns=\"http://www.topografix.com/GPX/1/1\" version=\"1.1\">\n<trk><trkseg>\n");
+    const double start = fixture.front().time;
+    for (std::size_t i = 0; i < kPoints; i++) {
+        const GPXPoint &point = fixture[i % fixture.size()];
+        const double offset = static_cast<double>(i / fixture.size()) * 1e-3;
+        const auto time = static_cast<std::time_t>(start + i * 0.086);
+        std::tm utc;
+        gmtime_r(&time, &utc);
+        char stamp[32];
+        std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+        std::fprintf(file, "<trkpt lat=\"%.6f\" lon=\"%.6f\"><ele>%.2f</ele><time>%s</time></trkpt>\n", point.latitude + offset, point.longitude, point.elevation, stamp);
+    }
+    std::fprintf(file, "</trkseg></trk>\n</gpx>\n");
+    return std::fclose(file) == 0;
+}
+
+} // namespace
+
+int main() {
+    const std::string gpxPath = "/tmp/OSTrackFileBenchmark.gpx";
+    const std::string trackPath = "/tmp/OSTrackFileBenchmark.ostrack";
+    if (!writeLargeGPX(gpxPath) || !convertGPXToTrackFile(gpxPath, trackPath)) {
+        std::fprintf(stderr, "Could not write the benchmark files in /tmp\n");
+        return 1;
+    }
+
+    FixBuffer fixes;
+    fixes.reserve(kPoints);
+    std::size_t gpxSize = 0;
+    double seconds = bestOf(3, [&] {
+        fixes.clear();
+        MappedFile file;
+        file.open(gpxPath);
+        gpxSize = file.size();
+        GPXReader::read(file.contents(), [&fixes](const GPXPoint &point) { fixes.push_back(makeFix(point, 5)); });
+    });
+    doNotOptimise(fixes.back().latitude);
+    std::printf("GPX         %9zu bytes  %5.1f bytes/point  load %7.1f ms\n", gpxSize, double(gpxSize) / kPoints, seconds * 1e3);
+
+    TrackFile track;
+    seconds = bestOf(5, [&] {
+        fixes.clear();
+        track.open(trackPath);
+        track.readAll(fixes);
+    });
+    doNotOptimise(fixes.back().latitude);
+    std::printf("track file  %9zu bytes  %5.1f bytes/point  load %7.1f ms  (%zu blocks)\n", track.fileSize(), double(track.fileSize()) / kPoints, seconds * 1e3, static_cast<std::size_t>(track.blockCount()));
+
+    const double middle = (fixes.front().timestamp + fixes.back().timestamp) / 2;
+    seconds = bestOf(20, [&] {
+        fixes.clear();
+        track.readTimeRange(middle, middle + 60, fixes);
+    });
+    std::printf("one minute  %9zu points  %9.3f ms\n", fixes.size(), seconds * 1e3);
+
+    seconds = bestOf(20, [&] {
+        fixes.clear();
+        track.readBoundingBox(50.9375 + 1, -1.471, 50.938 + 1, -1.4703, fixes);
+    });
+    std::printf("small area  %9zu points  %9.3f ms\n", fixes.size(), seconds * 1e3);
+
+    std::remove(gpxPath.c_str());
+    std::remove(trackPath.c_str());
+    return 0;
+}
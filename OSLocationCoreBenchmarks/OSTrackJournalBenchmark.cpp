@@ -0,0 +1,126 @@
+//
+//  OSTrackJournalBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Appends a million fixes built from the Southampton fixture to a journal
+//  in /tmp: one write per fix, grouped writes with the default ten second
+//  flush to storage, and grouped writes flushed every time. Then recovers
+//  the million record journal, and for comparison times rewriting the same
+//  track as a whole file, as recording did before the journal, spread over
+//  the 60 fixes between rewrites.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSFix.h"
+#include "OSGPXReader.h"
+#include "OSTrackFile.h"
+#include "OSTrackJournal.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kRecords = 1000000;
+
+/**
+ *  Appends `count` fixes to a fresh journal
+ *
+ *  @return appends per second, or 0 if the journal could not be written
+ */
+double appendRate(const std::string &path, const FixBuffer &fixes, std::size_t count, const TrackJournalOptions &options, std::uint64_t &writes, std::uint64_t &syncs) {
+    std::remove(path.c_str());
+    SystemClock clock;
+    TrackJournalWriter writer(clock, options);
+    bool written = writer.open(path);
+    const double elapsed = bestOf(1, [&] {
+        for (std::size_t i = 0; i < count && written; i++) {
+            written = writer.append(fixes[i]);
+        }
+        written = written && writer.close();
+    });
+    writes = writer.writeCount();
+    syncs = writer.syncCount();
+    return written ? count / elapsed : 0;
+}
+
+} // namespace
+
+int main() {
+    FixBuffer fixture;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&fixture](const GPXPoint &point) {
+        fixture.push_back(makeFix(point, 5));
+    });
+    FixBuffer fixes(kRecords);
+    for (std::size_t i = 0; i < kRecords; i++) {
+        fixes[i] = fixture[i % fixture.size()];
+        fixes[i].timestamp = fixture.front().timestamp + static_cast<double>(i);
+        fixes[i].latitude += static_cast<double>(i / fixture.size()) * 1e-3;
+    }
+
+    const std::string path = "/tmp/OSTrackJournalBenchmark.osjournal";
+    std::uint64_t writes = 0, syncs = 0;
+
+    TrackJournalOptions single;
+    single.maximumBatch = 1;
+    single.syncInterval = -1;
+    const double singleRate = appendRate(path, fixes, kRecords, single, writes, syncs);
+    std::printf("write per fix:                 %9.0f appends/s (%llu writes)\n", singleRate, static_cast<unsigned long long>(writes));
+
+    const TrackJournalOptions grouped;
+    const double groupedRate = appendRate(path, fixes, kRecords, grouped, writes, syncs);
+    std::printf("grouped, flushed every 10 s:   %9.0f appends/s (%llu writes, %llu flushes)\n", groupedRate, static_cast<unsigned long long>(writes), static_cast<unsigned long long>(syncs));
+
+    TrackJournalOptions eager;
+    eager.syncInterval = 0;
+    const std::size_t eagerCount = kRecords / 20;
+    const double eagerRate = appendRate(path, fixes, eagerCount, eager, writes, syncs);
+    std::printf("grouped, flushed every write:  %9.0f appends/s (%llu writes, %llu flushes, first %zu fixes)\n", eagerRate, static_cast<unsigned long long>(writes), static_cast<unsigned long long>(syncs), eagerCount);
+
+    if (singleRate == 0 || groupedRate == 0 || eagerRate == 0) {
+        std::fprintf(stderr, "Could not write the journal in /tmp\n");
+        return 1;
+    }
+
+    // The grouped run left the full journal; tear its last record
+    appendRate(path, fixes, kRecords, grouped, writes, syncs);
+    if (truncate(path.c_str(), static_cast<off_t>(journal::kHeaderSize + kRecords * sizeof(JournalRecord) - 20)) != 0) {
+        std::fprintf(stderr, "Could not truncate the journal\n");
+        return 1;
+    }
+    FixBuffer recovered;
+    JournalRecovery recovery;
+    bool recoveredJournal = false;
+    const double recoverTime = bestOf(1, [&] { recoveredJournal = recoverTrackJournal(path, &recovered, recovery); });
+    std::printf("recovery of %zu records:  %9.1f ms (%llu kept, %llu bytes cut)\n", kRecords, recoverTime * 1e3,
+                static_cast<unsigned long long>(recovery.recordCount), static_cast<unsigned long long>(recovery.truncatedBytes));
+    double validateTime = 0;
+    if (recoveredJournal) {
+        validateTime = bestOf(5, [&] { recoveredJournal = recoverTrackJournal(path, nullptr, recovery); });
+        std::printf("validation only:              %9.1f ms (%.0f M records/s)\n", validateTime * 1e3, recovery.recordCount / validateTime / 1e6);
+    }
+
+    const std::string trackPath = "/tmp/OSTrackJournalBenchmark.ostrack";
+    bool rewritten = false;
+    const double rewriteTime = bestOf(3, [&] {
+        TrackFileWriter writer;
+        rewritten = writer.open(trackPath);
+        for (std::size_t i = 0; i < kRecords && rewritten; i++) {
+            rewritten = writer.append(fixes[i]);
+        }
+        rewritten = writer.close() && rewritten;
+    });
+    std::printf("rewriting the %zu point track: %.1f ms, %.0f us a fix when rewritten every 60 fixes, against %.2f us a fix journalled\n",
+                kRecords, rewriteTime * 1e3, rewriteTime / 60 * 1e6, 1e6 / groupedRate);
+
+    std::remove(path.c_str());
+    std::remove(trackPath.c_str());
+    return recoveredJournal && rewritten ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+//
+//  OSTrackSimplifierBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Reports the compression ratio of online and batch simplification on both
+//  GPX fixtures, and throughput on a long journey built from copies of the
+//  Southampton fixture (a loop), each moved a little further north and
+//  jittered so no two are identical.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSTrackSimplifier.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kFixes = 2000000;
+
+FixBuffer load(const char *name) {
+    FixBuffer fixes;
+    GPXReader::readFile(fixturePath(name), [&fixes](const GPXPoint &point) { fixes.push_back(makeFix(point, 5)); });
+    return fixes;
+}
+
+std::size_t simplifyOnline(const FixBuffer &track, double tolerance, FixBuffer &scratch) {
+    TrackSimplifier simplifier(tolerance);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < track.size(); i += 16) {
+        scratch.assign(track.begin() + i, track.begin() + std::min(i + 16, track.size()));
+        simplifier.process(scratch);
+        kept += scratch.size();
+    }
+    scratch.clear();
+    simplifier.flush(scratch);
+    return kept + scratch.size();
+}
+
+} // namespace
+
+int main() {
+    FixBuffer scratch;
+    for (const char *name : {"Southampton-OS-route.gpx", "lake-district-trail.gpx"}) {
+        const FixBuffer track = load(name);
+        for (double tolerance : {1.0, 2.0, 5.0, 10.0}) {
+            const std::size_t online = simplifyOnline(track, tolerance, scratch);
+            const std::size_t batch = simplifyTrack(track, tolerance).size();
+            std::printf("%-26s %4.0f m: %4zu fixes -> online %4zu (%5.1fx), batch %4zu (%5.1fx)\n", name, tolerance, track.size(), online, double(track.size()) / online, batch, double(track.size()) / batch);
+        }
+    }
+
+    const FixBuffer fixture = load("Southampton-OS-route.gpx");
+    FixBuffer track(kFixes);
+    std::uint64_t state = 42;
+    for (std::size_t i = 0; i < kFixes; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const double copy = static_cast<double>(i / fixture.size());
+        const double jitter = (static_cast<double>(state % 2001) - 1000) * 2e-8;
+        track[i] = fixture[i % fixture.size()];
+        track[i].latitude += copy * 0.002 + jitter;
+        track[i].longitude -= jitter;
+    }
+
+    std::size_t kept = 0;
+    double seconds = bestOf(3, [&] { kept = simplifyOnline(track, 5, scratch); });
+    std::printf("online         %8.1f ms  %6.1f M fixes/s  kept %zu\n", seconds * 1e3, kFixes / seconds / 1e6, kept);
+
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%u hardware threads\n", cores);
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        if (threads > cores) {
+            break;
+        }
+        seconds = bestOf(3, [&] { kept = simplifyTrack(track, 5, threads).size(); });
+        std::printf("batch %2u thread%s %6.1f ms  %6.1f M fixes/s  kept %zu\n", threads, threads == 1 ? " " : "s", seconds * 1e3, kFixes / seconds / 1e6, kept);
+    }
+    return 0;
+}
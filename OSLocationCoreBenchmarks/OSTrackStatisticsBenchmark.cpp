@@ -0,0 +1,114 @@
+//
+//  OSTrackStatisticsBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Records a hike of 14400 fixes, about five hours, by walking the
+//  Southampton fixture back and forth at walking pace, and keeps its distance, ascent and moving time
+//  up to date after every fix. Compares walking the whole recording after
+//  each update, as consumers do today, with TrackStatistics, and reports
+//  the total CPU time and the cost of the last update of the hike.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGPXReader.h"
+#include "OSGeodesic.h"
+#include "OSTrackStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kFixes = 4 * 3600;
+const double kWalkingSpeed = 1.4;
+
+double distance(const Fix &from, const Fix &to) {
+    return equirectangularDistance(from.latitude, from.longitude, to.latitude, to.longitude);
+}
+
+FixBuffer hikeAlong(const char *name) {
+    FixBuffer track;
+    GPXReader::readFile(fixturePath(name), [&track](const GPXPoint &point) { track.push_back(makeFix(point, 5)); });
+    FixBuffer hike;
+    hike.reserve(kFixes);
+    for (std::size_t i = 0; hike.size() < kFixes; i++) {
+        // There and back again, so consecutive fixes stay close
+        const std::size_t lap = i / track.size();
+        const std::size_t j = i % track.size();
+        Fix fix = track[lap % 2 ? track.size() - 1 - j : j];
+        fix.timestamp = hike.empty() ? 0 : hike.back().timestamp + std::max(1.0, distance(hike.back(), fix) / kWalkingSpeed);
+        hike.push_back(fix);
+    }
+    return hike;
+}
+
+/**
+ *  What a consumer does after each update: walk everything recorded so far
+ */
+TrackSummary walkRecording(const FixBuffer &recording, std::size_t count, const TrackStatisticsOptions &options) {
+    TrackSummary summary;
+    double anchor = recording[0].altitude;
+    for (std::size_t i = 1; i < count; i++) {
+        const Fix &from = recording[i - 1], &to = recording[i];
+        const double leg = distance(from, to);
+        const double dt = to.timestamp - from.timestamp;
+        summary.distance += leg;
+        summary.elapsedTime += dt;
+        if (dt > 0 && dt <= options.maximumGap && leg >= options.movingSpeed * dt) {
+            summary.movingTime += dt;
+        }
+        if (std::fabs(to.altitude - anchor) >= options.climbThreshold) {
+            (to.altitude > anchor ? summary.ascent : summary.descent) += std::fabs(to.altitude - anchor);
+            anchor = to.altitude;
+        }
+    }
+    summary.fixCount = count;
+    return summary;
+}
+
+} // namespace
+
+int main() {
+    const TrackStatisticsOptions options;
+    const FixBuffer hike = hikeAlong("Southampton-OS-route.gpx");
+
+    TrackSummary walked;
+    const double walking = bestOf(3, [&] {
+        for (std::size_t count = 1; count <= hike.size(); count++) {
+            walked = walkRecording(hike, count, options);
+            doNotOptimise(&walked);
+        }
+    });
+    const double lastWalk = bestOf(20, [&] {
+        walked = walkRecording(hike, hike.size(), options);
+        doNotOptimise(&walked);
+    });
+
+    TrackSummary incremental;
+    std::vector<TrackSplit> splits;
+    const double accumulating = bestOf(20, [&] {
+        TrackStatistics statistics(options);
+        splits.clear();
+        for (const Fix &fix : hike) {
+            statistics.add(fix, splits);
+        }
+        incremental = statistics.summary();
+        doNotOptimise(&incremental);
+    });
+
+    std::printf("%zu fixes, %.1f h, %.1f km, %.0f m ascent, %zu splits\n", hike.size(), hike.back().timestamp / 3600, incremental.distance / 1000, incremental.ascent, splits.size());
+    std::printf("  walk recording per update  %9.1f ms total  %9.1f us last update\n", walking * 1e3, lastWalk * 1e6);
+    std::printf("  TrackStatistics            %9.3f ms total  %9.3f us per update  (%.0fx)\n", accumulating * 1e3, accumulating / hike.size() * 1e6, walking / accumulating);
+    std::printf("  difference from walking    distance %.2e m  ascent %.2e m  moving time %.2e s\n",
+                std::fabs(incremental.distance - walked.distance),
+                std::fabs(incremental.ascent - walked.ascent),
+                std::fabs(incremental.movingTime - walked.movingTime));
+    return 0;
+}
@@ -0,0 +1,173 @@
+//
+//  OSTrackStoreBenchmark.cpp
+//  OSLocationCoreBenchmarks
+//
+//  Builds a synthetic track of a million points twice: in a `TrackStore`,
+//  and as an array of reference counted heap objects standing in for
+//  `NSArray<CLLocation *>`, each with the fields of a `CLLocation`. Reports
+//  the heap used per point and the time to scan each for the distance
+//  along the track and its bounding box.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSBenchmark.h"
+#include "OSGeodesic.h"
+#include "OSLocalFrame.h"
+#include "OSTrackStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace oslocation;
+using namespace oslocation::benchmark;
+
+namespace {
+
+const std::size_t kPoints = 1000000;
+
+/**
+ *  The instance variables of a `CLLocation`, behind a vtable pointer in
+ *  place of `isa`
+ */
+struct LocationObject {
+    virtual ~LocationObject() = default;
+
+    double latitude, longitude;
+    double altitude, ellipsoidalAltitude;
+    double horizontalAccuracy, verticalAccuracy;
+    double speed, speedAccuracy;
+    double course, courseAccuracy;
+    double timestamp;
+    void *floor;
+    void *sourceInformation;
+};
+
+struct Scan {
+    double distance;
+    double minLatitude, minLongitude, maxLatitude, maxLongitude;
+};
+
+/**
+ *  Bytes the heap has handed out, or 0 where that cannot be measured
+ */
+std::size_t heapInUse() {
+#if defined(__GLIBC__)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+/**
+ *  A walk with a gentle random turn at 1 Hz
+ */
+Fix syntheticFix(std::size_t i, double &east, double &north, double &course) {
+    static const LocalFrame frame(50.9, -1.4);
+    course += std::sin(static_cast<double>(i) * 0.013) * 5;
+    east += 1.4 * std::sin(course * kDegreesToRadians);
+    north += 1.4 * std::cos(course * kDegreesToRadians);
+    double latitude, longitude;
+    frame.toGeodetic(east, north, latitude, longitude);
+    Fix fix = makeFix(static_cast<double>(i), latitude, longitude, 20 + std::sin(static_cast<double>(i) * 0.001) * 10);
+    fix.horizontalAccuracy = 5;
+    fix.verticalAccuracy = 3;
+    fix.speed = 1.4;
+    fix.course = std::fmod(course + 3600, 360);
+    return fix;
+}
+
+Scan scanObjects(const std::vector<std::shared_ptr<LocationObject>> &locations) {
+    Scan scan{0, 90, 180, -90, -180};
+    for (std::size_t i = 0; i < locations.size(); i++) {
+        const LocationObject &location = *locations[i];
+        if (i > 0) {
+            scan.distance += distanceBetween(locations[i - 1]->latitude, locations[i - 1]->longitude, location.latitude, location.longitude);
+        }
+        scan.minLatitude = std::min(scan.minLatitude, location.latitude);
+        scan.maxLatitude = std::max(scan.maxLatitude, location.latitude);
+        scan.minLongitude = std::min(scan.minLongitude, location.longitude);
+        scan.maxLongitude = std::max(scan.maxLongitude, location.longitude);
+    }
+    return scan;
+}
+
+Scan scanStore(const TrackView &view, std::vector<double> &distances) {
+    Scan scan{0, 90, 180, -90, -180};
+    for (std::size_t c = 0; c < view.chunkCount(); c++) {
+        const TrackColumns columns = view.chunk(c);
+        if (c > 0) {
+            const TrackColumns previous = view.chunk(c - 1);
+            scan.distance += distanceBetween(previous.latitudes[previous.count - 1], previous.longitudes[previous.count - 1], columns.latitudes[0], columns.longitudes[0]);
+        }
+        consecutiveDistances(columns.latitudes, columns.longitudes, columns.count, distances.data());
+        for (std::size_t i = 0; i + 1 < columns.count; i++) {
+            scan.distance += distances[i];
+        }
+        for (std::size_t i = 0; i < columns.count; i++) {
+            scan.minLatitude = std::min(scan.minLatitude, columns.latitudes[i]);
+            scan.maxLatitude = std::max(scan.maxLatitude, columns.latitudes[i]);
+            scan.minLongitude = std::min(scan.minLongitude, columns.longitudes[i]);
+            scan.maxLongitude = std::max(scan.maxLongitude, columns.longitudes[i]);
+        }
+    }
+    return scan;
+}
+
+} // namespace
+
+int main() {
+    double east = 0, north = 0, course = 0;
+    std::size_t before = heapInUse();
+    std::vector<std::shared_ptr<LocationObject>> locations;
+    const double objectBuild = bestOf(1, [&] {
+        for (std::size_t i = 0; i < kPoints; i++) {
+            const Fix fix = syntheticFix(i, east, north, course);
+            auto location = std::make_shared<LocationObject>();
+            location->latitude = fix.latitude;
+            location->longitude = fix.longitude;
+            location->altitude = fix.altitude;
+            location->horizontalAccuracy = fix.horizontalAccuracy;
+            location->verticalAccuracy = fix.verticalAccuracy;
+            location->speed = fix.speed;
+            location->course = fix.course;
+            location->timestamp = fix.timestamp;
+            locations.push_back(std::move(location));
+        }
+    });
+    const std::size_t objectBytes = heapInUse() - before;
+
+    east = north = course = 0;
+    before = heapInUse();
+    TrackStore store;
+    const double storeBuild = bestOf(1, [&] {
+        for (std::size_t i = 0; i < kPoints; i++) {
+            store.append(syntheticFix(i, east, north, course));
+        }
+    });
+    const std::size_t storeBytes = heapInUse() - before;
+
+    if (objectBytes > 0) {
+        std::printf("heap per point: objects %.1f bytes, track store %.1f bytes\n", static_cast<double>(objectBytes) / kPoints, static_cast<double>(storeBytes) / kPoints);
+    }
+    std::printf("track store capacity: %.1f bytes per point\n", static_cast<double>(store.capacityBytes()) / kPoints);
+    std::printf("build, including generating points: objects %.1f ms, track store %.1f ms\n", objectBuild * 1e3, storeBuild * 1e3);
+
+    Scan objectScan{}, storeScan{};
+    std::vector<double> distances(kTrackChunkSize);
+    const double objectTime = bestOf(5, [&] { objectScan = scanObjects(locations); });
+    const double storeTime = bestOf(5, [&] { storeScan = scanStore(store.view(), distances); });
+    doNotOptimise(objectScan);
+    doNotOptimise(storeScan);
+    std::printf("scan for distance and bounds: objects %.2f ms (%.0f M points/s), track store %.2f ms (%.0f M points/s)  (%.1fx)\n",
+                objectTime * 1e3, kPoints / objectTime / 1e6, storeTime * 1e3, kPoints / storeTime / 1e6, objectTime / storeTime);
+    std::printf("distance %.1f km and %.1f km\n", objectScan.distance / 1000, storeScan.distance / 1000);
+    return 0;
+}
@@ -0,0 +1,126 @@
+//
+//  OSAdaptiveSchedulerTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSAdaptiveScheduler.h"
+#include "OSFixtures.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+using oslocation::testing::addPositionNoise;
+using oslocation::testing::makeJourney;
+
+namespace {
+
+const LocationSettings kRouteRecording = {LocationAccuracy::BestForNavigation, 5, true};
+const LocationSettings kNavigation = {LocationAccuracy::BestForNavigation, 0, true};
+
+}
+
+TEST(OSAdaptiveSchedulerTests, testItStaysWalkingOnAWalk) {
+    const FixBuffer journey = makeJourney({{600, 1.4}});
+    AdaptiveScheduler scheduler;
+    const ScheduleReport report = simulateSchedule(journey, kNavigation, &scheduler);
+    EXPECT_TRUE(scheduler.log().empty());
+    EXPECT_EQ(scheduler.state(), MotionState::Walking);
+    EXPECT_EQ(report.reconfigurations, 0u);
+    EXPECT_NEAR(report.fixesPerKilometre(), 1000.0 / 5.6, 2);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItGoesStationaryAtAStopAndLeavesOnTheFirstMovement) {
+    const FixBuffer journey = makeJourney({{300, 1.4}, {300, 0}, {300, 1.4}});
+    const double stop = journey[300].timestamp;
+    const double restart = journey[600].timestamp;
+
+    AdaptiveScheduler scheduler;
+    simulateSchedule(journey, kNavigation, &scheduler);
+    ASSERT_EQ(scheduler.log().size(), 2u);
+
+    const Reconfiguration &stay = scheduler.log()[0];
+    EXPECT_EQ(stay.from, MotionState::Walking);
+    EXPECT_EQ(stay.to, MotionState::Stationary);
+    EXPECT_FALSE(stay.settings.headingUpdates);
+    // The stay is timed from the last 20 m of the approach
+    EXPECT_GE(stay.timestamp, stop + 40);
+    EXPECT_LE(stay.timestamp, stop + 80);
+
+    // The stationary distance filter holds the next fix back for 50 m
+    const Reconfiguration &leave = scheduler.log()[1];
+    EXPECT_EQ(leave.to, MotionState::Walking);
+    EXPECT_GT(leave.timestamp, restart);
+    EXPECT_LE(leave.timestamp, restart + 40);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItSwitchesToDrivingWithHysteresis) {
+    const FixBuffer journey = makeJourney({{120, 1.4}, {300, 15}, {20, 3}, {300, 15}, {300, 1.4}});
+    const double driveStart = journey[120].timestamp;
+    const double walkStart = journey[740].timestamp;
+
+    AdaptiveScheduler scheduler;
+    simulateSchedule(journey, kNavigation, &scheduler);
+
+    // The 20 second crawl is shorter than `walkingTime` and is not reported
+    ASSERT_EQ(scheduler.log().size(), 2u);
+    EXPECT_EQ(scheduler.log()[0].to, MotionState::Driving);
+    EXPECT_LE(scheduler.log()[0].timestamp, driveStart + 30);
+    EXPECT_GT(scheduler.log()[0].speed, 7);
+    EXPECT_EQ(scheduler.log()[1].to, MotionState::Walking);
+    EXPECT_GE(scheduler.log()[1].timestamp, walkStart + 30);
+    EXPECT_LE(scheduler.log()[1].timestamp, walkStart + 60);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItUsesReportedSpeed) {
+    FixBuffer journey = makeJourney({{60, 1.4}, {120, 15}}, true);
+    AdaptiveScheduler scheduler;
+    scheduler.process(journey);
+    ASSERT_EQ(scheduler.log().size(), 1u);
+    EXPECT_EQ(scheduler.log()[0].timestamp, journey[70].timestamp);
+    EXPECT_EQ(scheduler.speed(), 15);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItIgnoresPositionNoiseWhileStationary) {
+    FixBuffer fixes = makeJourney({{900, 0}});
+    addPositionNoise(fixes, 3, 7);
+    AdaptiveScheduler scheduler;
+    scheduler.process(fixes);
+    ASSERT_EQ(scheduler.log().size(), 1u);
+    EXPECT_EQ(scheduler.log()[0].to, MotionState::Stationary);
+    EXPECT_EQ(scheduler.state(), MotionState::Stationary);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItResetsWithoutLogging) {
+    FixBuffer fixes = makeJourney({{120, 0}});
+    AdaptiveScheduler scheduler;
+    scheduler.process(fixes);
+    ASSERT_EQ(scheduler.state(), MotionState::Stationary);
+    scheduler.reset();
+    EXPECT_EQ(scheduler.state(), MotionState::Walking);
+    EXPECT_EQ(scheduler.log().size(), 1u);
+    EXPECT_LT(scheduler.speed(), 0);
+}
+
+TEST(OSAdaptiveSchedulerTests, testItNeedsFewerFixesAndLessHighAccuracyThanStaticPurposes) {
+    const FixBuffer journey = makeJourney({{600, 1.4}, {1200, 0}, {600, 1.4}, {900, 13}, {1800, 0}, {300, 1.4}});
+
+    const ScheduleReport navigation = simulateSchedule(journey, kNavigation);
+    const ScheduleReport recording = simulateSchedule(journey, kRouteRecording);
+    AdaptiveScheduler scheduler;
+    const ScheduleReport adaptive = simulateSchedule(journey, kNavigation, &scheduler);
+
+    EXPECT_DOUBLE_EQ(navigation.highAccuracyFraction(), 1);
+    EXPECT_DOUBLE_EQ(recording.highAccuracyFraction(), 1);
+    EXPECT_LT(adaptive.highAccuracyFraction(), 0.5);
+    EXPECT_LT(adaptive.fixesPerKilometre(), recording.fixesPerKilometre() * 0.75);
+    EXPECT_LT(recording.fixesPerKilometre(), navigation.fixesPerKilometre() / 2);
+
+    // Parking goes straight from driving to stationary once updates stop
+    const MotionState expected[] = {MotionState::Stationary, MotionState::Walking, MotionState::Driving, MotionState::Stationary, MotionState::Walking};
+    ASSERT_EQ(adaptive.reconfigurations, 5u);
+    for (std::size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(scheduler.log()[i].to, expected[i]) << i;
+    }
+}
@@ -0,0 +1,192 @@
+//
+//  OSDeliveryQueueTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSDeliveryQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace oslocation;
+
+namespace {
+
+DeliveryRecord numbered(std::size_t number) {
+    return makeRecord(makeFix(static_cast<double>(number), 50.9, -1.4));
+}
+
+std::vector<std::size_t> popAll(DeliveryQueue &queue) {
+    std::vector<std::size_t> numbers;
+    DeliveryRecord record;
+    while (queue.pop(record)) {
+        numbers.push_back(static_cast<std::size_t>(record.fix.timestamp));
+    }
+    return numbers;
+}
+
+/**
+ *  Pushes `count` numbered records from one thread as fast as possible while
+ *  another pops them, and returns the numbers popped
+ */
+std::vector<std::size_t> stress(DeliveryQueue &queue, std::size_t count) {
+    std::atomic<bool> finished(false);
+    std::vector<std::size_t> received;
+    received.reserve(count);
+    std::thread consumer([&] {
+        DeliveryRecord record;
+        for (;;) {
+            const bool last = finished.load(std::memory_order_acquire);
+            if (queue.pop(record)) {
+                received.push_back(static_cast<std::size_t>(record.fix.timestamp));
+            } else if (last) {
+                break;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (std::size_t i = 0; i < count; i++) {
+        queue.push(numbered(i));
+    }
+    finished.store(true, std::memory_order_release);
+    consumer.join();
+    return received;
+}
+
+bool isIncreasing(const std::vector<std::size_t> &numbers) {
+    for (std::size_t i = 1; i < numbers.size(); i++) {
+        if (numbers[i] <= numbers[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(OSDeliveryQueueTests, testItDeliversInOrder) {
+    DeliveryQueue queue(5, Backpressure::Block);
+    EXPECT_EQ(queue.capacity(), 8u);
+    for (std::size_t i = 0; i < 8; i++) {
+        queue.push(numbered(i));
+    }
+    EXPECT_EQ(queue.size(), 8u);
+    EXPECT_EQ(popAll(queue), std::vector<std::size_t>({0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_EQ(queue.statistics().blocked, 0u);
+}
+
+TEST(OSDeliveryQueueTests, testItCarriesFixesAndHeadings) {
+    DeliveryQueue queue(4);
+    queue.push(numbered(1));
+    queue.push(makeRecord(Heading{2, 90, 89, -1, 5, 0, 0, 0}, 2.5));
+
+    DeliveryRecord record;
+    ASSERT_TRUE(queue.pop(record));
+    EXPECT_EQ(record.type, RecordType::Fix);
+    EXPECT_EQ(record.fix.timestamp, 1);
+    ASSERT_TRUE(queue.pop(record));
+    EXPECT_EQ(record.type, RecordType::Heading);
+    EXPECT_EQ(record.enqueueTime, 2.5);
+    EXPECT_EQ(record.heading.magneticHeading, 90);
+    EXPECT_FALSE(queue.pop(record));
+}
+
+TEST(OSDeliveryQueueTests, testItDropsTheOldestWhenFull) {
+    DeliveryQueue queue(4, Backpressure::DropOldest);
+    for (std::size_t i = 0; i < 10; i++) {
+        queue.push(numbered(i));
+    }
+    EXPECT_EQ(popAll(queue), std::vector<std::size_t>({6, 7, 8, 9}));
+    EXPECT_EQ(queue.statistics().pushed, 10u);
+    EXPECT_EQ(queue.statistics().dropped, 6u);
+}
+
+TEST(OSDeliveryQueueTests, testItCoalescesTheOverflowIntoTheNewest) {
+    DeliveryQueue queue(4, Backpressure::Coalesce);
+    for (std::size_t i = 0; i < 10; i++) {
+        queue.push(numbered(i));
+    }
+    EXPECT_EQ(queue.size(), 5u);
+    EXPECT_EQ(popAll(queue), std::vector<std::size_t>({0, 1, 2, 3, 9}));
+    EXPECT_EQ(queue.statistics().coalesced, 5u);
+
+    // Back to the ring once the overflow has been delivered
+    queue.push(numbered(10));
+    queue.push(numbered(11));
+    EXPECT_EQ(popAll(queue), std::vector<std::size_t>({10, 11}));
+    EXPECT_EQ(queue.statistics().coalesced, 5u);
+}
+
+TEST(OSDeliveryQueueTests, testItLosesNothingWhenBlockingUnderLoad) {
+    const std::size_t count = 200000;
+    DeliveryQueue queue(16, Backpressure::Block);
+    const std::vector<std::size_t> received = stress(queue, count);
+    ASSERT_EQ(received.size(), count);
+    for (std::size_t i = 0; i < count; i++) {
+        ASSERT_EQ(received[i], i);
+    }
+}
+
+/**
+ *  The consumer only runs when the producer starts it, one drain at a time
+ *  as on a serial dispatch queue, so a full queue must start one itself
+ */
+TEST(OSDeliveryQueueTests, testItWakesItsConsumerWhenBlockingOnAFullQueue) {
+    const std::size_t count = 1000;
+    DeliveryQueue queue(16, Backpressure::Block);
+    std::atomic<bool> drainScheduled(false);
+    std::thread drain;
+    std::vector<std::size_t> received;
+    const auto scheduleDrain = [&] {
+        if (drainScheduled.exchange(true)) {
+            return;
+        }
+        if (drain.joinable()) {
+            drain.join();
+        }
+        drain = std::thread([&] {
+            drainScheduled.store(false);
+            for (std::size_t number : popAll(queue)) {
+                received.push_back(number);
+            }
+        });
+    };
+    queue.setWakeHandler(scheduleDrain);
+
+    // One batch far bigger than the queue, with no drain pending
+    for (std::size_t i = 0; i < count; i++) {
+        queue.push(numbered(i));
+    }
+    scheduleDrain();
+    drain.join();
+    ASSERT_EQ(received.size(), count);
+    for (std::size_t i = 0; i < count; i++) {
+        ASSERT_EQ(received[i], i);
+    }
+    EXPECT_GT(queue.statistics().blocked, 0u);
+}
+
+TEST(OSDeliveryQueueTests, testItAccountsForEveryDroppedRecordUnderLoad) {
+    const std::size_t count = 200000;
+    DeliveryQueue queue(16, Backpressure::DropOldest);
+    const std::vector<std::size_t> received = stress(queue, count);
+    EXPECT_TRUE(isIncreasing(received));
+    EXPECT_EQ(received.size() + queue.statistics().dropped, count);
+    EXPECT_EQ(received.back(), count - 1);
+}
+
+TEST(OSDeliveryQueueTests, testItAccountsForEveryCoalescedRecordUnderLoad) {
+    const std::size_t count = 200000;
+    DeliveryQueue queue(16, Backpressure::Coalesce);
+    const std::vector<std::size_t> received = stress(queue, count);
+    EXPECT_TRUE(isIncreasing(received));
+    EXPECT_EQ(received.size() + queue.statistics().coalesced, count);
+    EXPECT_EQ(received.back(), count - 1);
+}
@@ -0,0 +1,172 @@
+//
+//  OSFixtures.h
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#pragma once
+
+#include "OSFix.h"
+#include "OSGPXReader.h"
+#include "OSLocalFrame.h"
+
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+namespace oslocation {
+namespace testing {
+
+inline std::string fixturePath(const std::string &name) {
+    return std::string(OS_FIXTURES_DIR) + "/" + name;
+}
+
+/**
+ *  Loads the points of one of the GPX fixtures shared with the XCTest
+ *  target. Fixes get a nominal 5 m horizontal accuracy since the fixtures
+ *  carry none.
+ */
+inline FixBuffer loadFixture(const std::string &name) {
+    FixBuffer fixes;
+    GPXReader::readFile(fixturePath(name), [&fixes](const GPXPoint &point) {
+        Fix fix = makeFix(point, 5);
+        fix.sourceIndex = static_cast<std::int32_t>(fixes.size());
+        fixes.push_back(fix);
+    });
+    return fixes;
+}
+
+/**
+ *  Deterministic normally distributed noise, the same on every platform
+ */
+class NoiseSource {
+public:
+    explicit NoiseSource(std::uint64_t seed) : m_state(seed ? seed : 1) {}
+
+    double uniform() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return (static_cast<double>(m_state >> 11) + 0.5) / 9007199254740992.0;
+    }
+
+    double gaussian() {
+        return std::sqrt(-2 * std::log(uniform())) * std::cos(2 * M_PI * uniform());
+    }
+
+private:
+    std::uint64_t m_state;
+};
+
+/**
+ *  Moves every fix by independent gaussian noise of `sigma` metres on each
+ *  axis and sets its horizontal accuracy to match
+ */
+inline void addPositionNoise(FixBuffer &fixes, double sigma, std::uint64_t seed) {
+    NoiseSource noise(seed);
+    for (Fix &fix : fixes) {
+        const LocalFrame frame(fix.latitude, fix.longitude);
+        frame.toGeodetic(noise.gaussian() * sigma, noise.gaussian() * sigma, fix.latitude, fix.longitude);
+        fix.horizontalAccuracy = sigma;
+    }
+}
+
+/**
+ *  Moves every `interval`th fix (starting at `first`) `metres` to the north
+ *  east, like a multipath jump in an urban canyon. The accuracy is left as
+ *  reported, as it usually is for such jumps.
+ */
+inline void addSpikes(FixBuffer &fixes, std::size_t first, std::size_t interval, double metres) {
+    for (std::size_t i = first; i < fixes.size(); i += interval) {
+        const LocalFrame frame(fixes[i].latitude, fixes[i].longitude);
+        frame.toGeodetic(metres * M_SQRT1_2, metres * M_SQRT1_2, fixes[i].latitude, fixes[i].longitude);
+    }
+}
+
+/**
+ *  A stop of `seconds` before the fix at `index`
+ */
+struct Pause {
+    std::size_t index;
+    double seconds;
+};
+
+/**
+ *  Retimes a track to one fix a second and inserts stops into it, the way a
+ *  lunch break shows up in a recording: a fix a second at the stopping
+ *  point, each moved by gaussian noise of `sigma` metres on each axis.
+ *  Pauses must be in order of index.
+ */
+inline FixBuffer insertPauses(const FixBuffer &track, std::initializer_list<Pause> pauses, double sigma, std::uint64_t seed) {
+    NoiseSource noise(seed);
+    FixBuffer fixes;
+    const Pause *pause = pauses.begin();
+    double timestamp = track.empty() ? 0 : track.front().timestamp;
+    auto append = [&](Fix fix) {
+        fix.timestamp = timestamp++;
+        fix.sourceIndex = static_cast<std::int32_t>(fixes.size());
+        fixes.push_back(fix);
+    };
+    for (std::size_t i = 0; i < track.size(); i++) {
+        for (; pause != pauses.end() && pause->index == i; pause++) {
+            const LocalFrame frame(track[i].latitude, track[i].longitude);
+            for (double elapsed = 0; elapsed < pause->seconds; elapsed++) {
+                Fix fix = track[i];
+                frame.toGeodetic(noise.gaussian() * sigma, noise.gaussian() * sigma, fix.latitude, fix.longitude);
+                append(fix);
+            }
+        }
+        append(track[i]);
+    }
+    return fixes;
+}
+
+/**
+ *  Distance between two fixes in metres, good for the short distances
+ *  compared in tests
+ */
+inline double distance(const Fix &a, const Fix &b) {
+    const LocalFrame frame(a.latitude, a.longitude);
+    double east, north;
+    frame.toLocal(b.latitude, b.longitude, east, north);
+    return std::hypot(east, north);
+}
+
+/**
+ *  A stretch of a synthetic journey at constant speed, 0 for a stop
+ */
+struct JourneyLeg {
+    double seconds;
+    double speed;
+};
+
+/**
+ *  Samples a journey once a second, starting near the Southampton fixture.
+ *  Legs alternate between heading east and north. Fixes carry a 5 m
+ *  accuracy and, with `reportSpeed`, the true speed as a receiver would
+ *  report it.
+ */
+inline FixBuffer makeJourney(std::initializer_list<JourneyLeg> legs, bool reportSpeed = false) {
+    const LocalFrame frame(50.9375, -1.47);
+    FixBuffer fixes;
+    double east = 0, north = 0, timestamp = 1000;
+    bool eastwards = true;
+    for (const JourneyLeg &leg : legs) {
+        for (double elapsed = 0; elapsed < leg.seconds; elapsed++) {
+            Fix fix = makeFix(timestamp++, 0, 0);
+            frame.toGeodetic(east, north, fix.latitude, fix.longitude);
+            fix.horizontalAccuracy = 5;
+            fix.speed = reportSpeed ? leg.speed : -1;
+            fix.sourceIndex = static_cast<std::int32_t>(fixes.size());
+            fixes.push_back(fix);
+            (eastwards ? east : north) += leg.speed;
+        }
+        eastwards = !eastwards;
+    }
+    return fixes;
+}
+
+} // namespace testing
+} // namespace oslocation
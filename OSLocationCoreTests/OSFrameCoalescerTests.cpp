@@ -0,0 +1,110 @@
+//
+//  OSFrameCoalescerTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSFrameCoalescer.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace oslocation;
+using oslocation::testing::makeJourney;
+
+namespace {
+
+Heading headingTowards(double degrees, double timestamp) {
+    return Heading{timestamp, degrees, degrees, -1, 5, 0, 0, 0};
+}
+
+} // namespace
+
+TEST(OSFrameCoalescerTests, testItKeepsTheLatestHeadingOfABurst) {
+    FrameCoalescer coalescer;
+    Frame frame;
+    coalescer.addHeading(headingTowards(10, 0), 0);
+    ASSERT_TRUE(coalescer.takeFrame(0, frame));
+
+    for (int i = 1; i <= 20; i++) {
+        coalescer.addHeading(headingTowards(10 + i, i * 0.001), i * 0.001);
+    }
+    EXPECT_FALSE(coalescer.takeFrame(0.01, frame));
+    EXPECT_DOUBLE_EQ(coalescer.nextFrameTime(), 1.0 / 60);
+    ASSERT_TRUE(coalescer.takeFrame(1.0 / 60, frame));
+    EXPECT_TRUE(frame.hasHeading);
+    EXPECT_EQ(frame.heading.magneticHeading, 30);
+    EXPECT_TRUE(frame.fixes.empty());
+    EXPECT_EQ(coalescer.statistics().headingsCoalesced, 19u);
+    EXPECT_EQ(coalescer.statistics().frames, 2u);
+}
+
+TEST(OSFrameCoalescerTests, testItKeepsEveryFix) {
+    const FixBuffer journey = makeJourney({{10, 1.5}});
+    FrameCoalescer coalescer;
+    for (const Fix &fix : journey) {
+        coalescer.addFixes(FixBuffer(1, fix), 0);
+    }
+    coalescer.addHeading(headingTowards(90, 0), 0);
+    Frame frame;
+    ASSERT_TRUE(coalescer.takeFrame(0, frame));
+    ASSERT_EQ(frame.fixes.size(), journey.size());
+    EXPECT_EQ(frame.fixes.back().timestamp, journey.back().timestamp);
+    EXPECT_FALSE(coalescer.hasPending());
+    EXPECT_TRUE(std::isinf(coalescer.nextFrameTime()));
+}
+
+TEST(OSFrameCoalescerTests, testItHoldsSmallChangesUntilTheMaximumDelay) {
+    FrameOptions options;
+    options.minimumHeadingChange = 2;
+    options.minimumDistance = 5;
+    options.maximumDelay = 0.5;
+    FrameCoalescer coalescer(options);
+    Frame frame;
+    coalescer.addHeading(headingTowards(359.5, 0), 0);
+    ASSERT_TRUE(coalescer.takeFrame(0, frame));
+
+    // Across north, so a small change
+    coalescer.addHeading(headingTowards(0.5, 0.1), 0.1);
+    EXPECT_DOUBLE_EQ(coalescer.nextFrameTime(), 0.6);
+    EXPECT_FALSE(coalescer.takeFrame(0.3, frame));
+
+    coalescer.addHeading(headingTowards(3, 0.35), 0.35);
+    EXPECT_TRUE(coalescer.takeFrame(0.35, frame));
+    EXPECT_EQ(frame.heading.magneticHeading, 3);
+}
+
+TEST(OSFrameCoalescerTests, testItHoldsFixesThatHaveNotMovedFarEnough) {
+    const FixBuffer journey = makeJourney({{5, 1}, {1, 10}});
+    FrameOptions options;
+    options.minimumDistance = 5;
+    options.maximumDelay = 10;
+    FrameCoalescer coalescer(options);
+    Frame frame;
+    coalescer.addFixes(FixBuffer(1, journey[0]), 0);
+    ASSERT_TRUE(coalescer.takeFrame(0, frame));
+
+    for (std::size_t i = 1; i < 5; i++) {
+        coalescer.addFixes(FixBuffer(1, journey[i]), i);
+        EXPECT_FALSE(coalescer.takeFrame(i, frame));
+    }
+    coalescer.addFixes(FixBuffer(1, journey[5]), 5);
+    ASSERT_TRUE(coalescer.takeFrame(5, frame));
+    EXPECT_EQ(frame.fixes.size(), 5u);
+    EXPECT_FALSE(frame.hasHeading);
+}
+
+TEST(OSFrameCoalescerTests, testItFlushesWhetherOrNotAFrameIsDue) {
+    FrameCoalescer coalescer;
+    Frame frame;
+    coalescer.addHeading(headingTowards(10, 0), 0);
+    ASSERT_TRUE(coalescer.takeFrame(0, frame));
+    coalescer.addHeading(headingTowards(50, 0), 0.001);
+    EXPECT_FALSE(coalescer.takeFrame(0.001, frame));
+    EXPECT_TRUE(coalescer.flush(frame));
+    EXPECT_EQ(frame.heading.magneticHeading, 50);
+    EXPECT_FALSE(coalescer.flush(frame));
+}
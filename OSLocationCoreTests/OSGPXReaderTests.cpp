@@ -0,0 +1,129 @@
+//
+//  OSGPXReaderTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGPXReader.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::fixturePath;
+
+namespace {
+
+std::vector<GPXPoint> readAll(std::string_view document, GPXResult &result) {
+    std::vector<GPXPoint> points;
+    result = GPXReader::read(document, [&points](const GPXPoint &point) { points.push_back(point); });
+    return points;
+}
+
+} // namespace
+
+TEST(OSGPXReaderTests, testItReadsEveryWaypointInTheSouthamptonFixture) {
+    std::vector<GPXPoint> points;
+    GPXResult result = GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&points](const GPXPoint &point) { points.push_back(point); });
+    EXPECT_EQ(result.status, GPXStatus::Ok);
+    ASSERT_EQ(result.points, 472u);
+    ASSERT_EQ(points.size(), 472u);
+    EXPECT_EQ(points[0].type, GPXPointType::Waypoint);
+    EXPECT_DOUBLE_EQ(points[0].latitude, 50.938461);
+    EXPECT_DOUBLE_EQ(points[0].longitude, -1.470514);
+    EXPECT_DOUBLE_EQ(points[0].elevation, 16.850437);
+    EXPECT_DOUBLE_EQ(points[0].time, 1407499611);
+    EXPECT_DOUBLE_EQ(points[2].time, 1407499612);
+}
+
+TEST(OSGPXReaderTests, testItParsesHighPrecisionCoordinatesExactly) {
+    std::vector<GPXPoint> points;
+    GPXReader::readFile(fixturePath("lake-district-trail.gpx"), [&points](const GPXPoint &point) { points.push_back(point); });
+    ASSERT_EQ(points.size(), 26u);
+    EXPECT_EQ(points[0].latitude, 54.36428955752);
+    EXPECT_EQ(points[0].longitude, -3.0964318637523);
+    EXPECT_EQ(points.back().latitude, 54.363984674412);
+}
+
+TEST(OSGPXReaderTests, testItReadsTrackAndRoutePoints) {
+    GPXResult result;
+    auto points = readAll(R"(<?xml version="1.0"?>
+<gpx><trk><name>walk</name><trkseg>
+  <trkpt lon='-1.5' lat='50.5'><ele>12.5</ele><time>2014-08-08T12:06:51.250Z</time><extensions><speed>1</speed></extensions></trkpt>
+  <!-- <trkpt lat="0" lon="0"></trkpt> -->
+  <trkpt lat="50.6" lon="-1.6"/>
+</trkseg></trk><rte><rtept lat="1e1" lon="-2.0E0"></rtept></rte></gpx>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Ok);
+    ASSERT_EQ(points.size(), 3u);
+    EXPECT_EQ(points[0].type, GPXPointType::TrackPoint);
+    EXPECT_DOUBLE_EQ(points[0].latitude, 50.5);
+    EXPECT_DOUBLE_EQ(points[0].longitude, -1.5);
+    EXPECT_DOUBLE_EQ(points[0].elevation, 12.5);
+    EXPECT_DOUBLE_EQ(points[0].time, 1407499611.25);
+    EXPECT_TRUE(std::isnan(points[1].elevation));
+    EXPECT_TRUE(std::isnan(points[1].time));
+    EXPECT_EQ(points[2].type, GPXPointType::RoutePoint);
+    EXPECT_DOUBLE_EQ(points[2].latitude, 10);
+    EXPECT_DOUBLE_EQ(points[2].longitude, -2);
+}
+
+TEST(OSGPXReaderTests, testItHandlesNamespacePrefixesAndCDATA) {
+    GPXResult result;
+    auto points = readAll(R"(<gpx:gpx><gpx:wpt lat="1" lon="2"><gpx:name><![CDATA[<wpt lat="9" lon="9">]]></gpx:name></gpx:wpt></gpx:gpx>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Ok);
+    ASSERT_EQ(points.size(), 1u);
+    EXPECT_DOUBLE_EQ(points[0].latitude, 1);
+}
+
+TEST(OSGPXReaderTests, testItReportsMalformedDocuments) {
+    GPXResult result;
+    readAll(R"(<gpx><wpt lat="1"></wpt></gpx>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Malformed);
+
+    auto points = readAll(R"(<gpx><wpt lat="1" lon="2"></wpt><wpt lat="x" lon="2"></wpt></gpx>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Malformed);
+    EXPECT_EQ(points.size(), 1u);
+    EXPECT_EQ(result.points, 1u);
+
+    readAll(R"(<gpx><wpt lat="1" lon="2"><time>yesterday</time></wpt></gpx>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Malformed);
+
+    readAll(R"(<gpx><wpt lat="1" lon="2"><ele>3</ele>)", result);
+    EXPECT_EQ(result.status, GPXStatus::Malformed);
+
+    result = GPXReader::readFile("/nonexistent.gpx", [](const GPXPoint &) {});
+    EXPECT_EQ(result.status, GPXStatus::FileError);
+}
+
+TEST(OSGPXReaderTests, testItParsesTimestampsWithOffsets) {
+    double seconds = 0;
+    ASSERT_TRUE(gpx::parseTimestamp("1970-01-01T00:00:00Z", seconds));
+    EXPECT_EQ(seconds, 0);
+    ASSERT_TRUE(gpx::parseTimestamp("2014-08-08T13:06:51+01:00", seconds));
+    EXPECT_EQ(seconds, 1407499611);
+    ASSERT_TRUE(gpx::parseTimestamp("2014-08-08T07:06:51-0500", seconds));
+    EXPECT_EQ(seconds, 1407499611);
+    ASSERT_TRUE(gpx::parseTimestamp("2000-02-29T00:00:00", seconds));
+    EXPECT_EQ(seconds, 951782400);
+    EXPECT_FALSE(gpx::parseTimestamp("2014-13-08T12:06:51Z", seconds));
+    EXPECT_FALSE(gpx::parseTimestamp("2014-08-08T12:06:51Zjunk", seconds));
+}
+
+TEST(OSGPXReaderTests, testItParsesDecimals) {
+    const char *inputs[] = {"0", "-0.5", "50.938461", "  -1.470514", "1.5e3", "0.000001234", "12345678901234567890123"};
+    const double expected[] = {0, -0.5, 50.938461, -1.470514, 1500, 0.000001234, 12345678901234567890123.0};
+    for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        const char *cursor = inputs[i];
+        double value;
+        ASSERT_TRUE(gpx::parseDecimal(cursor, inputs[i] + std::strlen(inputs[i]), value)) << inputs[i];
+        EXPECT_DOUBLE_EQ(value, expected[i]) << inputs[i];
+    }
+    const char *empty = "-.";
+    double value;
+    EXPECT_FALSE(gpx::parseDecimal(empty, empty + 2, value));
+}
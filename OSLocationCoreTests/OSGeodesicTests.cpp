@@ -0,0 +1,107 @@
+//
+//  OSGeodesicTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGeodesic.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+const simd::Level kLevels[] = {simd::Level::Scalar, simd::Level::NEON, simd::Level::AVX2};
+
+struct GeodesicCase {
+    double latitude1, longitude1, latitude2, longitude2;
+    double distance;
+    double tolerance;
+};
+
+} // namespace
+
+TEST(OSGeodesicTests, testItReproducesPublishedGeodesics) {
+    // From the GeographicLib documentation and its GeodSolve test cases,
+    // including nearly antipodal points where Newton's method needs the
+    // astroid starting guess
+    const GeodesicCase cases[] = {
+        {40.6, -73.8, 51.6, -0.5, 5551759.400319, 1e-6},
+        {40.6, -73.8, 49.01666667, 2.55, 5853226, 0.5},
+        {88.202499451857, 0, -88.202499451857, 179.981022032992859592, 20003898.214, 0.5e-3},
+        {89.262080389218, 0, -89.262080389218, 179.992207982775375662, 20003925.854, 0.5e-3},
+        {56.320923501171, 0, -56.320923501171, 179.664747671772880215, 19993558.287, 0.5e-3},
+        {52.784459512564, 0, -52.784459512563990912, 179.634407464943777557, 19991596.095, 0.5e-3},
+        {48.522876735459, 0, -48.52287673545898293, 179.599720456223079643, 19989144.774, 0.5e-3},
+        {0, 0, 0, 179, 19926189, 0.5},
+        {0, 0, 0, 179.5, 19980862, 0.5},
+        {0, 0, 0, 180, 20003931, 0.5},
+        {0, 0, 1, 180, 19893357, 0.5},
+    };
+    for (const GeodesicCase &c : cases) {
+        EXPECT_NEAR(geodesicDistance(c.latitude1, c.longitude1, c.latitude2, c.longitude2), c.distance, c.tolerance) << c.latitude1 << "," << c.longitude1 << " to " << c.latitude2 << "," << c.longitude2;
+        EXPECT_NEAR(geodesicDistance(c.latitude2, c.longitude2, c.latitude1, c.longitude1), c.distance, c.tolerance);
+    }
+}
+
+TEST(OSGeodesicTests, testItMeasuresMeridiansAndTheEquatorExactly) {
+    EXPECT_NEAR(geodesicDistance(0, 0, 90, 0), 10001965.729, 0.0005);
+    EXPECT_NEAR(geodesicDistance(0, -1.5, 0, 1.5), kWGS84.semiMajorAxis * 3 * kDegreesToRadians, 1e-6);
+    EXPECT_EQ(geodesicDistance(50.9, -1.4, 50.9, -1.4), 0);
+    EXPECT_TRUE(std::isnan(geodesicDistance(91, 0, 0, 0)));
+}
+
+TEST(OSGeodesicTests, testTheEquirectangularFormulaIsWithinHalfAMillimetreUpToTheLimit) {
+    for (double latitude = 49.5; latitude <= 61; latitude += 0.5) {
+        for (double bearing = 0; bearing < 360; bearing += 15) {
+            const double d = kEquirectangularLimit / 111000;
+            const double latitude2 = latitude + d * std::cos(bearing * kDegreesToRadians);
+            const double longitude2 = -1.4 + d * std::sin(bearing * kDegreesToRadians) / std::cos(latitude * kDegreesToRadians);
+            const double exact = geodesicDistance(latitude, -1.4, latitude2, longitude2);
+            ASSERT_NEAR(equirectangularDistance(latitude, -1.4, latitude2, longitude2), exact, 0.0005) << latitude << " " << bearing;
+        }
+    }
+}
+
+TEST(OSGeodesicTests, testTheBatchKernelsMatchTheScalarFormulas) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    std::vector<double> latitudes, longitudes;
+    for (const Fix &fix : fixes) {
+        latitudes.push_back(fix.latitude);
+        longitudes.push_back(fix.longitude);
+    }
+    // A long leg back to the start, and one across the antimeridian
+    latitudes.push_back(52);
+    longitudes.push_back(179.9999);
+    latitudes.push_back(52);
+    longitudes.push_back(-179.9999);
+    const std::size_t count = latitudes.size();
+
+    for (simd::Level level : kLevels) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        std::vector<double> consecutive(count - 1), from(count);
+        consecutiveDistances(latitudes.data(), longitudes.data(), count, consecutive.data(), level);
+        distancesFrom(latitudes[0], longitudes[0], latitudes.data(), longitudes.data(), count, from.data(), level);
+        for (std::size_t i = 0; i + 1 < count; i++) {
+            const double expected = equirectangularDistance(latitudes[i], longitudes[i], latitudes[i + 1], longitudes[i + 1]);
+            if (expected <= kEquirectangularLimit) {
+                ASSERT_NEAR(consecutive[i], expected, 1e-8) << simd::name(level) << " " << i;
+            } else {
+                ASSERT_EQ(consecutive[i], geodesicDistance(latitudes[i], longitudes[i], latitudes[i + 1], longitudes[i + 1])) << simd::name(level) << " " << i;
+            }
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            ASSERT_NEAR(from[i], geodesicDistance(latitudes[0], longitudes[0], latitudes[i], longitudes[i]), 0.001) << simd::name(level) << " " << i;
+        }
+        EXPECT_NEAR(consecutive[count - 2], 13.7, 0.1) << simd::name(level);
+    }
+}
@@ -0,0 +1,162 @@
+//
+//  OSGeofenceTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGeofence.h"
+#include "OSHelmertTransform.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+using oslocation::testing::NoiseSource;
+
+namespace {
+
+std::vector<GeofenceEvent> move(GeofenceEngine &engine, double timestamp, double easting, double northing) {
+    std::vector<GeofenceEvent> events;
+    engine.update(timestamp, easting, northing, events);
+    return events;
+}
+
+} // namespace
+
+TEST(OSGeofenceTests, testItEntersAndLeavesACircleWithHysteresis) {
+    GeofenceEngine engine;
+    ASSERT_TRUE(engine.addCircle(7, 442000, 114000, 100));
+    EXPECT_FALSE(engine.addCircle(7, 0, 0, 1));
+
+    EXPECT_TRUE(move(engine, 0, 442200, 114000).empty());
+    std::vector<GeofenceEvent> events = move(engine, 1, 442050, 114000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].fenceId, 7u);
+    EXPECT_EQ(events[0].transition, GeofenceTransition::Enter);
+    EXPECT_TRUE(engine.isInside(7));
+
+    // Just outside the boundary is within the exit margin
+    EXPECT_TRUE(move(engine, 2, 442105, 114000).empty());
+    EXPECT_TRUE(engine.isInside(7));
+    events = move(engine, 3, 442115, 114000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].transition, GeofenceTransition::Exit);
+    EXPECT_FALSE(engine.isInside(7));
+}
+
+TEST(OSGeofenceTests, testItHandlesConcavePolygons) {
+    // A U shape open to the north
+    const double eastings[] = {0, 300, 300, 200, 200, 100, 100, 0};
+    const double northings[] = {0, 0, 300, 300, 100, 100, 300, 300};
+    GeofenceEngine engine;
+    ASSERT_TRUE(engine.addPolygon(1, eastings, northings, 8));
+    EXPECT_GT(engine.signedDistance(1, 50, 200), 0);
+    EXPECT_GT(engine.signedDistance(1, 150, 50), 0);
+    EXPECT_LT(engine.signedDistance(1, 150, 200), 0);
+    EXPECT_NEAR(engine.signedDistance(1, 150, 200), -50, 1e-9);
+    EXPECT_NEAR(engine.signedDistance(1, 50, 200), 50, 1e-9);
+    EXPECT_LT(engine.signedDistance(1, 400, 150), 0);
+}
+
+TEST(OSGeofenceTests, testItReportsDwellOnce) {
+    GeofenceOptions options;
+    options.dwellTime = 60;
+    GeofenceEngine engine(options);
+    engine.addCircle(1, 1000, 1000, 50);
+    EXPECT_EQ(move(engine, 0, 1000, 1000).size(), 1u);
+    EXPECT_TRUE(move(engine, 59, 1000, 1000).empty());
+    std::vector<GeofenceEvent> events = move(engine, 60, 1000, 1000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].transition, GeofenceTransition::Dwell);
+    EXPECT_TRUE(move(engine, 600, 1000, 1000).empty());
+}
+
+TEST(OSGeofenceTests, testItLeavesFencesSpanningManyCells) {
+    GeofenceEngine engine;
+    engine.addCircle(1, 5000, 5000, 4000);
+    EXPECT_EQ(move(engine, 0, 5000, 5000).size(), 1u);
+    // A long jump straight out, to a cell the fence does not cover
+    std::vector<GeofenceEvent> events = move(engine, 1, 50000, 50000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].transition, GeofenceTransition::Exit);
+}
+
+TEST(OSGeofenceTests, testRemovedFencesAreForgotten) {
+    GeofenceEngine engine;
+    engine.addCircle(1, 1000, 1000, 50);
+    engine.addCircle(2, 1000, 1000, 80);
+    EXPECT_EQ(move(engine, 0, 1000, 1000).size(), 2u);
+    EXPECT_TRUE(engine.remove(1));
+    EXPECT_FALSE(engine.remove(1));
+    EXPECT_EQ(engine.fenceCount(), 1u);
+    std::vector<GeofenceEvent> events = move(engine, 1, 5000, 5000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].fenceId, 2u);
+
+    // The slot is reused without inheriting state
+    engine.addCircle(3, 5000, 5000, 10);
+    events = move(engine, 2, 5000, 5000);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].fenceId, 3u);
+}
+
+TEST(OSGeofenceTests, testTheIndexAgreesWithTestingEveryFence) {
+    // Random fences around the Southampton fixture, checked against the
+    // signed distance of every fence at every fix
+    NoiseSource random(3);
+    GeofenceOptions options;
+    options.exitMargin = 0;
+    options.cellSize = 250;
+    GeofenceEngine engine(options);
+    const GridPosition centre = approximateNationalGrid(50.938, -1.4705, 0);
+    for (std::uint32_t id = 0; id < 400; id++) {
+        const double e = centre.easting + (random.uniform() - 0.5) * 3000;
+        const double n = centre.northing + (random.uniform() - 0.5) * 3000;
+        if (id % 2) {
+            engine.addCircle(id, e, n, 10 + random.uniform() * 300);
+        } else {
+            const double size = 10 + random.uniform() * 300;
+            const double eastings[] = {e, e + size, e + size * 0.5};
+            const double northings[] = {n, n, n + size};
+            engine.addPolygon(id, eastings, northings, 3);
+        }
+    }
+
+    std::set<std::uint32_t> inside;
+    for (const Fix &fix : loadFixture("Southampton-OS-route.gpx")) {
+        const GridPosition position = approximateNationalGrid(fix.latitude, fix.longitude, fix.altitude);
+        std::vector<GeofenceEvent> events;
+        engine.update(fix.timestamp, position.easting, position.northing, events);
+        for (const GeofenceEvent &event : events) {
+            if (event.transition == GeofenceTransition::Enter) {
+                inside.insert(event.fenceId);
+            } else if (event.transition == GeofenceTransition::Exit) {
+                inside.erase(event.fenceId);
+            }
+        }
+        for (std::uint32_t id = 0; id < 400; id++) {
+            EXPECT_EQ(inside.count(id) == 1, engine.signedDistance(id, position.easting, position.northing) >= 0) << id;
+        }
+        EXPECT_LT(engine.lastCandidateCount(), 100u);
+    }
+    EXPECT_FALSE(inside.empty());
+}
+
+TEST(OSGeofenceTests, testTheStageCollectsEventsWithoutTouchingFixes) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    const GridPosition start = approximateNationalGrid(fixes.front().latitude, fixes.front().longitude, fixes.front().altitude);
+    GeofenceEngine engine;
+    engine.addCircle(1, start.easting, start.northing, 30);
+    GeofenceStage stage(engine);
+    stage.process(fixes);
+    ASSERT_GE(stage.events().size(), 1u);
+    EXPECT_EQ(stage.events().front().transition, GeofenceTransition::Enter);
+    EXPECT_EQ(fixes.size(), 472u);
+    for (const Fix &fix : fixes) {
+        EXPECT_EQ(fix.flags, FixFlagNone);
+    }
+}
@@ -0,0 +1,111 @@
+//
+//  OSGridReferenceTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGridReference.h"
+#include "OSHelmertTransform.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+std::string format(double easting, double northing, int figures, GridReferenceStyle style = GridReferenceStyle::Spaced) {
+    char buffer[kGridReferenceMaxLength];
+    const std::size_t length = formatGridReference(easting, northing, figures, buffer, sizeof(buffer), style);
+    return std::string(buffer, length);
+}
+
+} // namespace
+
+TEST(OSGridReferenceTests, testItFormatsEachPrecision) {
+    EXPECT_EQ(format(442004.7, 114000.2, 10), "SU 42004 14000");
+    EXPECT_EQ(format(442004.7, 114000.2, 8), "SU 4200 1400");
+    EXPECT_EQ(format(442004.7, 114000.2, 6), "SU 420 140");
+    EXPECT_EQ(format(442004.7, 114000.2, 4), "SU 42 14");
+    EXPECT_EQ(format(442004.7, 114000.2, 2), "SU 4 1");
+    EXPECT_EQ(format(442004.7, 114000.2, 0), "SU");
+    EXPECT_EQ(format(442004.7, 114000.2, 10, GridReferenceStyle::Compact), "SU4200414000");
+}
+
+TEST(OSGridReferenceTests, testItUsesTheRightSquareLetters) {
+    EXPECT_EQ(format(0, 0, 0), "SV");
+    EXPECT_EQ(format(651409, 313177, 0), "TG");
+    EXPECT_EQ(format(325000, 673000, 0), "NT");
+    EXPECT_EQ(format(465000, 1165000, 0), "HU");
+    EXPECT_EQ(format(699999, 1299999, 10), "JM 99999 99999");
+}
+
+TEST(OSGridReferenceTests, testItRejectsPositionsOutsideTheGridAndBadArguments) {
+    char buffer[kGridReferenceMaxLength];
+    EXPECT_EQ(formatGridReference(-1, 100, 6, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(700000, 100, 6, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(100, 1300000, 6, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(NAN, 100, 6, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(100, 100, 5, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(100, 100, 12, buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(formatGridReference(442004, 114000, 10, buffer, 14), 0u);
+    EXPECT_EQ(formatGridReference(442004, 114000, 10, buffer, 15), 14u);
+}
+
+TEST(OSGridReferenceTests, testItParsesEitherStyle) {
+    double easting, northing;
+    int figures;
+    ASSERT_TRUE(parseGridReference("SU 42004 14000", easting, northing, &figures));
+    EXPECT_EQ(easting, 442004);
+    EXPECT_EQ(northing, 114000);
+    EXPECT_EQ(figures, 10);
+
+    ASSERT_TRUE(parseGridReference("  su420140 ", easting, northing, &figures));
+    EXPECT_EQ(easting, 442000);
+    EXPECT_EQ(northing, 114000);
+    EXPECT_EQ(figures, 6);
+
+    ASSERT_TRUE(parseGridReference("TG", easting, northing, &figures));
+    EXPECT_EQ(easting, 600000);
+    EXPECT_EQ(northing, 300000);
+    EXPECT_EQ(figures, 0);
+}
+
+TEST(OSGridReferenceTests, testItRejectsMalformedReferences) {
+    double easting, northing;
+    const char *malformed[] = {"", "S", "SI 123 456", "S1 123 456", "SU 123 45", "SU 12345", "SU 1 2 3", "SU 123456789012", "SU 123x456", "ZZ 123 456", "AA"};
+    for (const char *reference : malformed) {
+        EXPECT_FALSE(parseGridReference(reference, easting, northing)) << reference;
+    }
+}
+
+TEST(OSGridReferenceTests, testEverySquareRoundTrips) {
+    for (int north = 0; north < 13; north++) {
+        for (int east = 0; east < 7; east++) {
+            const std::string reference = format(east * 100000 + 12345, north * 100000 + 67890, 10);
+            double easting, northing;
+            ASSERT_TRUE(parseGridReference(reference, easting, northing)) << reference;
+            EXPECT_EQ(easting, east * 100000 + 12345) << reference;
+            EXPECT_EQ(northing, north * 100000 + 67890) << reference;
+        }
+    }
+}
+
+TEST(OSGridReferenceTests, testItRoundTripsConvertedFixesToTheReferenceResolution) {
+    for (const Fix &fix : loadFixture("Southampton-OS-route.gpx")) {
+        const GridPosition position = approximateNationalGrid(fix.latitude, fix.longitude, fix.altitude);
+        for (int figures = 2; figures <= 10; figures += 2) {
+            double easting, northing;
+            ASSERT_TRUE(parseGridReference(format(position.easting, position.northing, figures), easting, northing));
+            EXPECT_LE(easting, position.easting);
+            EXPECT_GT(easting + gridReferenceResolution(figures), position.easting);
+            EXPECT_LE(northing, position.northing);
+            EXPECT_GT(northing + gridReferenceResolution(figures), position.northing);
+        }
+    }
+}
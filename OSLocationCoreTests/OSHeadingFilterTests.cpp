@@ -0,0 +1,117 @@
+//
+//  OSHeadingFilterTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSHeadingFilter.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+
+namespace {
+
+Heading headingTowards(double degrees, double timestamp) {
+    return Heading{timestamp, degrees, degrees, -1, 5, 0, 0, 0};
+}
+
+HeadingFilterOptions withoutDeadBand() {
+    HeadingFilterOptions options;
+    options.deadBand = 0;
+    return options;
+}
+
+} // namespace
+
+TEST(OSHeadingFilterTests, testItAveragesAcrossNorth) {
+    HeadingFilter filter(withoutDeadBand());
+    Heading smoothed;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(filter.update(headingTowards(i % 2 ? 359 : 1, i * 0.01), smoothed));
+        EXPECT_LT(angularDifference(smoothed.magneticHeading, 0), 1.01);
+    }
+    EXPECT_LT(angularDifference(smoothed.magneticHeading, 0), 0.1);
+}
+
+TEST(OSHeadingFilterTests, testItFollowsAStepWithTheTimeConstant) {
+    HeadingFilterOptions options = withoutDeadBand();
+    options.timeConstant = 0.5;
+    HeadingFilter filter(options);
+    Heading smoothed;
+    ASSERT_TRUE(filter.update(headingTowards(350, 0), smoothed));
+    EXPECT_DOUBLE_EQ(smoothed.magneticHeading, 350);
+
+    // A turn through north: the filter moves the short way round
+    for (int i = 1; i <= 50; i++) {
+        ASSERT_TRUE(filter.update(headingTowards(30, i * 0.01), smoothed));
+        EXPECT_TRUE(smoothed.magneticHeading > 349.99 || smoothed.magneticHeading < 30);
+    }
+    // After one time constant the unit vector has covered 63% of the chord
+    EXPECT_NEAR(smoothed.magneticHeading, 15.49, 0.01);
+    for (int i = 51; i <= 500; i++) {
+        filter.update(headingTowards(30, i * 0.01), smoothed);
+    }
+    EXPECT_NEAR(smoothed.magneticHeading, 30, 0.01);
+}
+
+TEST(OSHeadingFilterTests, testItKeepsTheDeclinationOfEachReading) {
+    HeadingFilter filter(withoutDeadBand());
+    Heading smoothed;
+    Heading reading = headingTowards(359, 0);
+    reading.trueHeading = 358;
+    ASSERT_TRUE(filter.update(reading, smoothed));
+    EXPECT_DOUBLE_EQ(smoothed.trueHeading, 358);
+
+    reading = headingTowards(1, 0.1);
+    reading.trueHeading = 0;
+    ASSERT_TRUE(filter.update(reading, smoothed));
+    EXPECT_NEAR(angularDifference(smoothed.trueHeading, smoothed.magneticHeading), 1, 1e-9);
+
+    reading.timestamp = 0.2;
+    reading.trueHeading = -1;
+    ASSERT_TRUE(filter.update(reading, smoothed));
+    EXPECT_EQ(smoothed.trueHeading, -1);
+}
+
+TEST(OSHeadingFilterTests, testItSuppressesChangesInsideTheDeadBand) {
+    HeadingFilterOptions options;
+    options.timeConstant = 0;
+    options.deadBand = 2;
+    HeadingFilter filter(options);
+    Heading smoothed;
+    ASSERT_TRUE(filter.update(headingTowards(359, 0), smoothed));
+    EXPECT_FALSE(filter.update(headingTowards(0.5, 1), smoothed));
+    EXPECT_FALSE(filter.update(headingTowards(357.5, 2), smoothed));
+    EXPECT_DOUBLE_EQ(filter.current().magneticHeading, 357.5);
+    // Measured from the last heading returned, not the last reading
+    ASSERT_TRUE(filter.update(headingTowards(1, 3), smoothed));
+    EXPECT_DOUBLE_EQ(smoothed.magneticHeading, 1);
+}
+
+TEST(OSHeadingFilterTests, testItIgnoresInvalidReadings) {
+    HeadingFilter filter(withoutDeadBand());
+    Heading smoothed;
+    Heading invalid = headingTowards(90, 0);
+    invalid.headingAccuracy = -1;
+    EXPECT_FALSE(filter.update(invalid, smoothed));
+    EXPECT_FALSE(filter.hasHeading());
+    ASSERT_TRUE(filter.update(headingTowards(180, 0.1), smoothed));
+    EXPECT_DOUBLE_EQ(smoothed.magneticHeading, 180);
+}
+
+TEST(OSHeadingFilterTests, testItRestartsWithoutASweepWhenReoriented) {
+    HeadingFilter filter(withoutDeadBand());
+    Heading smoothed;
+    for (int i = 0; i < 100; i++) {
+        filter.update(headingTowards(10, i * 0.02), smoothed);
+    }
+    // Turning the device to landscape moves the reference by 90 degrees
+    filter.reorient();
+    ASSERT_TRUE(filter.update(headingTowards(100, 2), smoothed));
+    EXPECT_DOUBLE_EQ(smoothed.magneticHeading, 100);
+    ASSERT_TRUE(filter.update(headingTowards(101, 2.02), smoothed));
+    EXPECT_GT(smoothed.magneticHeading, 100);
+    EXPECT_LT(smoothed.magneticHeading, 101);
+}
@@ -0,0 +1,112 @@
+//
+//  OSHelmertTransformTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSHelmertTransform.h"
+#include "OSNationalGridStage.h"
+#include "OSTransverseMercator.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+double degrees(double d, double m, double s) {
+    return d + m / 60 + s / 3600;
+}
+
+} // namespace
+
+TEST(OSHelmertTransformTests, testCartesianConversionRoundTrips) {
+    for (double latitude = 49.5; latitude <= 61; latitude += 0.5) {
+        const CartesianPosition position = toCartesian(kAiry1830, latitude, -3.25, 123.4);
+        double outLatitude, outLongitude, outHeight;
+        fromCartesian(kAiry1830, position, outLatitude, outLongitude, outHeight);
+        EXPECT_NEAR(outLatitude, latitude, 1e-10);
+        EXPECT_NEAR(outLongitude, -3.25, 1e-10);
+        EXPECT_NEAR(outHeight, 123.4, 1e-4);
+    }
+}
+
+TEST(OSHelmertTransformTests, testItIsWithinAFewMetresOfTheCaisterWaterTower) {
+    // ETRS89 position of the worked example in "A guide to coordinate
+    // systems in Great Britain", whose OSGB36 grid position is published
+    const GridPosition position = approximateNationalGrid(degrees(52, 39, 28.8282), degrees(1, 42, 57.8663), 108.05);
+    EXPECT_NEAR(position.easting, 651409.903, 5);
+    EXPECT_NEAR(position.northing, 313177.270, 5);
+}
+
+TEST(OSHelmertTransformTests, testTheStageFillsInGridPositions) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    ASSERT_FALSE(fixes.empty());
+    EXPECT_FALSE(hasGridPosition(fixes[0]));
+
+    NationalGridStage stage(GridConversion::Approximate);
+    stage.process(fixes);
+    for (const Fix &fix : fixes) {
+        ASSERT_TRUE(hasGridPosition(fix));
+        EXPECT_EQ(fix.flags & FixFlagModified, 0u);
+        // SU 3 1
+        EXPECT_GT(fix.easting, 430000);
+        EXPECT_LT(fix.easting, 440000);
+        EXPECT_GT(fix.northing, 110000);
+        EXPECT_LT(fix.northing, 120000);
+    }
+}
+
+TEST(OSHelmertTransformTests, testPreciseConversionUsesTheGridOnceLoaded) {
+    const FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    FixBuffer approximate = track;
+    NationalGridStage(GridConversion::Approximate).process(approximate);
+
+    OSTN15Grid grid;
+    NationalGridStage stage(GridConversion::Precise, &grid);
+    FixBuffer fixes = track;
+    stage.process(fixes);
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        EXPECT_EQ(fixes[i].easting, approximate[i].easting);
+        EXPECT_EQ(fixes[i].northing, approximate[i].northing);
+    }
+
+    // A constant shift covering the whole country
+    grid.assign(std::vector<OSTN15Node>(4, OSTN15Node{100, -80, 45, 1}), 2, 2, 1000000);
+    fixes = track;
+    stage.process(fixes);
+    for (const Fix &fix : fixes) {
+        double easting, northing;
+        projectTransverseMercator(nationalGridProjection(kGRS80), fix.latitude, fix.longitude, easting, northing);
+        EXPECT_NEAR(fix.easting, easting + 100, 1e-6);
+        EXPECT_NEAR(fix.northing, northing - 80, 1e-6);
+    }
+
+    grid.close();
+    fixes = track;
+    stage.process(fixes);
+    EXPECT_EQ(fixes[0].easting, approximate[0].easting);
+}
+
+TEST(OSHelmertTransformTests, testTheBatchConversionMatchesPointByPoint) {
+    const FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    std::vector<double> latitudes, longitudes, heights;
+    for (const Fix &fix : fixes) {
+        latitudes.push_back(fix.latitude);
+        longitudes.push_back(fix.longitude);
+        heights.push_back(fix.altitude);
+    }
+    std::vector<double> eastings(fixes.size()), northings(fixes.size());
+    approximateNationalGrid(latitudes.data(), longitudes.data(), heights.data(), fixes.size(), eastings.data(), northings.data());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const GridPosition position = approximateNationalGrid(latitudes[i], longitudes[i], heights[i]);
+        EXPECT_NEAR(eastings[i], position.easting, 1e-6);
+        EXPECT_NEAR(northings[i], position.northing, 1e-6);
+    }
+}
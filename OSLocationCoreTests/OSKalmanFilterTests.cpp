@@ -0,0 +1,109 @@
+//
+//  OSKalmanFilterTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSKalmanFilter.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace oslocation;
+using oslocation::testing::addPositionNoise;
+using oslocation::testing::distance;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+double rmsError(const FixBuffer &fixes, const FixBuffer &truth) {
+    double sum = 0;
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const double d = distance(fixes[i], truth[i]);
+        sum += d * d;
+    }
+    return std::sqrt(sum / fixes.size());
+}
+
+} // namespace
+
+TEST(OSKalmanFilterTests, testItReducesTheErrorOfNoisyFixes) {
+    const FixBuffer truth = loadFixture("Southampton-OS-route.gpx");
+    for (double sigma : {3.0, 5.0, 10.0}) {
+        FixBuffer fixes = truth;
+        addPositionNoise(fixes, sigma, 42);
+        const double rawError = rmsError(fixes, truth);
+
+        KalmanFilter filter;
+        filter.process(fixes);
+        const double filteredError = rmsError(fixes, truth);
+        EXPECT_LT(filteredError, rawError * 0.8) << sigma;
+    }
+}
+
+TEST(OSKalmanFilterTests, testItConvergesOnAStationaryPosition) {
+    FixBuffer fixes;
+    for (int i = 0; i < 120; i++) {
+        fixes.push_back(makeFix(i, 50.9, -1.4));
+        fixes.back().horizontalAccuracy = 10;
+    }
+    const FixBuffer truth = fixes;
+    addPositionNoise(fixes, 10, 7);
+
+    KalmanFilter filter;
+    filter.process(fixes);
+    EXPECT_LT(distance(fixes.back(), truth.back()), 5);
+    EXPECT_LT(fixes.back().horizontalAccuracy, 10);
+    EXPECT_LT(fixes.back().speed, 1);
+    EXPECT_NE(fixes.back().flags & FixFlagModified, 0u);
+}
+
+TEST(OSKalmanFilterTests, testItPassesInvalidFixesThrough) {
+    FixBuffer fixes = {makeFix(0, 50.9, -1.4), makeFix(1, 50.9, -1.4)};
+    fixes[0].horizontalAccuracy = 5;
+    // Negative accuracy marks an invalid coordinate
+    fixes[1].latitude = 51;
+
+    KalmanFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(fixes[1].latitude, 51);
+    EXPECT_EQ(fixes[1].flags, FixFlagNone);
+}
+
+TEST(OSKalmanFilterTests, testItRestartsAfterALongGap) {
+    FixBuffer fixes = {makeFix(0, 50.9, -1.4), makeFix(1, 50.9, -1.4), makeFix(100, 51.5, -0.1)};
+    for (Fix &fix : fixes) {
+        fix.horizontalAccuracy = 5;
+    }
+
+    KalmanFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(fixes[2].latitude, 51.5);
+    EXPECT_EQ(fixes[2].longitude, -0.1);
+    EXPECT_EQ(fixes[2].flags, FixFlagNone);
+}
+
+TEST(OSKalmanFilterTests, testItFollowsALongStraightJourney) {
+    // 100 km due north at 30 m/s, far beyond the frame re-anchoring distance
+    FixBuffer fixes;
+    for (int i = 0; i < 3334; i++) {
+        fixes.push_back(makeFix(i, 50 + i * 30 / 111200.0, -1.4));
+        fixes.back().horizontalAccuracy = 5;
+    }
+    const FixBuffer truth = fixes;
+    addPositionNoise(fixes, 5, 11);
+
+    KalmanFilter filter;
+    filter.process(fixes);
+    EXPECT_LT(rmsError(fixes, truth), 5);
+    double speed = 0, drift = 0;
+    for (std::size_t i = fixes.size() - 100; i < fixes.size(); i++) {
+        speed += fixes[i].speed / 100;
+        drift += std::sin(fixes[i].course * M_PI / 180) / 100;
+    }
+    EXPECT_NEAR(speed, 30, 1);
+    EXPECT_NEAR(drift, 0, 0.05);
+}
@@ -0,0 +1,127 @@
+//
+//  OSLastFixCacheTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSLastFixCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace oslocation;
+
+namespace {
+
+std::string temporaryPath(const char *name) {
+    return ::testing::TempDir() + name;
+}
+
+Fix liveFix(double timestamp, double latitude = 50.9) {
+    Fix fix = makeFix(timestamp, latitude, -1.4, 20);
+    fix.horizontalAccuracy = 5;
+    fix.verticalAccuracy = 3;
+    fix.speed = 1.2;
+    fix.course = 90;
+    return fix;
+}
+
+} // namespace
+
+TEST(OSLastFixCacheTests, testItHandsTheLastFixToTheNextSession) {
+    const std::string path = temporaryPath("last-fix.cache");
+    std::remove(path.c_str());
+    {
+        LastFixCache cache;
+        EXPECT_FALSE(cache.open(path));
+        Fix fix;
+        EXPECT_FALSE(cache.provisionalFix(1000, fix));
+        cache.update(liveFix(1000));
+        cache.update(liveFix(1001, 51));
+    }
+
+    LastFixCache cache;
+    ASSERT_TRUE(cache.open(path));
+    Fix fix;
+    ASSERT_TRUE(cache.provisionalFix(1061, fix));
+    EXPECT_EQ(fix.latitude, 51);
+    EXPECT_EQ(fix.timestamp, 1001);
+    EXPECT_EQ(fix.flags, FixFlagProvisional);
+    EXPECT_DOUBLE_EQ(fix.horizontalAccuracy, 5 + 60 * cache.options().driftSpeed);
+    EXPECT_EQ(fix.speed, -1);
+    EXPECT_EQ(fix.course, -1);
+    EXPECT_EQ(fix.verticalAccuracy, 3);
+
+    // Provisional fixes are never cached in place of live ones
+    cache.update(fix);
+    EXPECT_EQ(cache.fix().flags, FixFlagNone);
+    std::remove(path.c_str());
+}
+
+TEST(OSLastFixCacheTests, testItDropsStaleAndVagueFixes) {
+    LastFixCacheOptions options;
+    options.maximumAge = 600;
+    options.driftSpeed = 2;
+    options.maximumAccuracy = 1000;
+    LastFixCache cache(options);
+    cache.update(liveFix(1000));
+    Fix fix;
+    EXPECT_TRUE(cache.provisionalFix(1000 + 490, fix));
+    EXPECT_FALSE(cache.provisionalFix(1000 + 500, fix));
+
+    // A clock set back counts as no time passed
+    EXPECT_TRUE(cache.provisionalFix(900, fix));
+    EXPECT_EQ(fix.horizontalAccuracy, 5);
+
+    options.driftSpeed = 0;
+    LastFixCache still(options);
+    still.update(liveFix(1000));
+    EXPECT_TRUE(still.provisionalFix(1600, fix));
+    EXPECT_FALSE(still.provisionalFix(1601, fix));
+
+    // Fixes too vague to be worth caching
+    Fix vague = liveFix(2000, 52);
+    vague.horizontalAccuracy = 1500;
+    still.update(vague);
+    Fix invalid = liveFix(2000, 52);
+    invalid.horizontalAccuracy = -1;
+    still.update(invalid);
+    EXPECT_EQ(still.fix().latitude, 50.9);
+}
+
+TEST(OSLastFixCacheTests, testItWritesAtMostOncePerInterval) {
+    const std::string path = temporaryPath("interval.cache");
+    std::remove(path.c_str());
+    LastFixCache cache;
+    cache.open(path);
+    cache.update(liveFix(1000));
+    cache.update(liveFix(1005, 51));
+
+    LastFixCache reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.fix().timestamp, 1000);
+    cache.update(liveFix(1010, 52));
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.fix().timestamp, 1010);
+    cache.update(liveFix(1012, 53));
+    EXPECT_TRUE(cache.flush());
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.fix().latitude, 53);
+
+    // A damaged file is ignored
+    std::string contents;
+    {
+        std::ifstream in(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    contents[20] ^= 1;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+    EXPECT_FALSE(reader.open(path));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << contents.substr(0, 30);
+    EXPECT_FALSE(reader.open(path));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,71 @@
+//
+//  OSMagneticModelTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSMagneticModel.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace oslocation;
+
+namespace {
+
+struct TestValue {
+    double decimalYear;
+    double height;
+    double latitude;
+    double longitude;
+    double north;
+    double east;
+    double down;
+    double declination;
+};
+
+// From the test values published with WMM2025
+const TestValue kTestValues[] = {
+    {2025.0, 0, 80, 0, 6521.6, 145.9, 54791.5, 1.28},
+    {2025.0, 0, 0, 120, 39677.8, -109.6, -10580.2, -0.16},
+    {2025.0, 0, -80, 240, 6117.5, 15751.9, -52022.5, 68.78},
+    {2025.0, 100000, 80, 0, 6216.0, 92.4, 52598.8, 0.85},
+    {2027.5, 0, 80, 0, 6500.8, 294.5, 54869.4, 2.59},
+};
+
+} // namespace
+
+TEST(OSMagneticModelTests, testItMatchesThePublishedTestValues) {
+    for (const TestValue &value : kTestValues) {
+        const MagneticField field = MagneticModel(value.decimalYear).evaluate(value.latitude, value.longitude, value.height);
+        EXPECT_NEAR(field.north, value.north, 0.1);
+        EXPECT_NEAR(field.east, value.east, 0.1);
+        EXPECT_NEAR(field.down, value.down, 0.1);
+        EXPECT_NEAR(field.declination, value.declination, 0.01);
+    }
+}
+
+TEST(OSMagneticModelTests, testItGivesASmallDeclinationOverEngland) {
+    const MagneticModel model(2026.0);
+    const double southampton = model.declination(50.9, -1.4);
+    EXPECT_GT(southampton, 0);
+    EXPECT_LT(southampton, 1.5);
+    // Declination increases eastwards across Great Britain
+    EXPECT_LT(model.declination(54.5, -3.1), model.declination(52.6, 1.3));
+}
+
+TEST(OSMagneticModelTests, testItStaysFiniteAtThePoles) {
+    const MagneticModel model(2025.0);
+    EXPECT_TRUE(std::isfinite(model.declination(90, 0)));
+    EXPECT_TRUE(std::isfinite(model.declination(-90, 0)));
+}
+
+TEST(OSMagneticModelTests, testItCountsDecimalYearsByDays) {
+    EXPECT_DOUBLE_EQ(MagneticModel::decimalYearForTime(1577836800), 2020.0);
+    // 1 July 2020, 182 days into a leap year
+    EXPECT_NEAR(MagneticModel::decimalYearForTime(1593561600), 2020 + 182.0 / 366, 1e-12);
+    EXPECT_NEAR(MagneticModel::decimalYearForTime(1609459199), 2021, 1e-7);
+    EXPECT_DOUBLE_EQ(MagneticModel::decimalYearForTime(0), 1970.0);
+}
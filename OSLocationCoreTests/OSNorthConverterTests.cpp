@@ -0,0 +1,82 @@
+//
+//  OSNorthConverterTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSNorthConverter.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace oslocation;
+
+TEST(OSNorthConverterTests, testItMatchesTheConvergenceOfTheProjection) {
+    const TransverseMercator projection = nationalGridProjection(kGRS80);
+    for (double longitude : {-6.0, -2.0, 0.5, 1.7}) {
+        const double latitude = 52.5;
+        double e0, n0, e1, n1;
+        projectTransverseMercator(projection, latitude, longitude, e0, n0);
+        projectTransverseMercator(projection, latitude + 1e-5, longitude, e1, n1);
+        // Grid bearing of a short step due north
+        const double bearing = std::atan2(e1 - e0, n1 - n0) * kRadiansToDegrees;
+        EXPECT_NEAR(gridConvergence(projection, latitude, longitude), -bearing, 1e-5);
+    }
+    EXPECT_EQ(gridConvergence(projection, 55, -2), 0);
+    EXPECT_GT(gridConvergence(projection, 51.5, -0.1), 0);
+    EXPECT_LT(gridConvergence(projection, 54.5, -3.1), 0);
+}
+
+TEST(OSNorthConverterTests, testItConvertsBetweenReferences) {
+    NorthConverter converter(MagneticModel(2026.0));
+    const double latitude = 54.45, longitude = -3.21;
+    const NorthCorrection corrections = converter.correction(latitude, longitude);
+    EXPECT_NEAR(converter.convert(90, NorthReference::True, NorthReference::Grid, latitude, longitude), 90 - corrections.convergence, 1e-9);
+    EXPECT_NEAR(converter.convert(90, NorthReference::Magnetic, NorthReference::True, latitude, longitude), 90 + corrections.declination, 1e-9);
+    // West of the central meridian, so true north is west of grid north
+    EXPECT_NEAR(converter.convert(0.2, NorthReference::Grid, NorthReference::True, latitude, longitude), 360.2 + corrections.convergence, 1e-9);
+    for (NorthReference from : {NorthReference::True, NorthReference::Magnetic, NorthReference::Grid}) {
+        for (NorthReference to : {NorthReference::True, NorthReference::Magnetic, NorthReference::Grid}) {
+            const double there = converter.convert(359.9, from, to, latitude, longitude);
+            EXPECT_GE(there, 0);
+            EXPECT_LT(there, 360);
+            EXPECT_NEAR(angularDifference(converter.convert(there, to, from, latitude, longitude), 359.9), 0, 1e-9);
+        }
+    }
+}
+
+TEST(OSNorthConverterTests, testItEvaluatesEachCellOnce) {
+    const MagneticModel model(2026.0);
+    NorthConverter converter(model);
+    const NorthCorrection first = converter.correction(50.9377, -1.4701);
+    const NorthCorrection second = converter.correction(50.9379, -1.4699);
+    EXPECT_EQ(converter.statistics().misses, 1u);
+    EXPECT_EQ(converter.statistics().hits, 1u);
+    EXPECT_EQ(first.declination, second.declination);
+
+    // The cell centre is within a hundredth of a degree of the exact values
+    EXPECT_NEAR(first.declination, model.declination(50.9377, -1.4701), 0.01);
+    EXPECT_NEAR(first.convergence, gridConvergence(nationalGridProjection(kGRS80), 50.9377, -1.4701), 0.01);
+
+    converter.correction(50.96, -1.47);
+    EXPECT_EQ(converter.statistics().misses, 2u);
+}
+
+TEST(OSNorthConverterTests, testItFillsInTrueAndGridHeadings) {
+    NorthConverter converter(MagneticModel(2026.0));
+    const double latitude = 51.5, longitude = -0.1;
+    const NorthCorrection corrections = converter.correction(latitude, longitude);
+
+    const Heading magneticOnly = converter.apply(Heading{0, 10, -1, -1, 5, 0, 0, 0}, latitude, longitude);
+    EXPECT_NEAR(magneticOnly.trueHeading, 10 + corrections.declination, 1e-9);
+    EXPECT_NEAR(magneticOnly.gridHeading, 10 + corrections.declination - corrections.convergence, 1e-9);
+
+    const Heading withTrue = converter.apply(Heading{0, 10, 12, -1, 5, 0, 0, 0}, latitude, longitude);
+    EXPECT_EQ(withTrue.trueHeading, 12);
+    EXPECT_NEAR(withTrue.gridHeading, 12 - corrections.convergence, 1e-9);
+
+    const Heading invalid = converter.apply(Heading{0, 10, 12, -1, -1, 0, 0, 0}, latitude, longitude);
+    EXPECT_FALSE(hasValidGridHeading(invalid));
+}
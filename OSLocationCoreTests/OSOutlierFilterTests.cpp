@@ -0,0 +1,134 @@
+//
+//  OSOutlierFilterTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSOutlierFilter.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+using oslocation::testing::addSpikes;
+using oslocation::testing::loadFixture;
+
+TEST(OSOutlierFilterTests, testItKeepsAnHonestTrack) {
+    for (const char *name : {"Southampton-OS-route.gpx", "lake-district-trail.gpx"}) {
+        FixBuffer fixes = loadFixture(name);
+        const std::size_t count = fixes.size();
+        OutlierFilter filter;
+        filter.process(fixes);
+        EXPECT_EQ(fixes.size(), count) << name;
+        EXPECT_EQ(filter.statistics().rejected(), 0u) << name;
+        EXPECT_EQ(filter.statistics().accepted, count) << name;
+    }
+}
+
+TEST(OSOutlierFilterTests, testItDropsInjectedSpikes) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    addSpikes(fixes, 10, 37, 300);
+
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(filter.statistics().rejected(), 13u);
+    EXPECT_EQ(filter.statistics().rejectedSpeed, 13u);
+    for (const Fix &fix : fixes) {
+        EXPECT_NE((fix.sourceIndex - 10) % 37, 0) << fix.sourceIndex;
+    }
+    EXPECT_EQ(fixes.size(), 472u - 13u);
+}
+
+TEST(OSOutlierFilterTests, testItDropsSpikesAcrossBatches) {
+    FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    addSpikes(track, 5, 20, 150);
+
+    OutlierFilter filter;
+    std::size_t delivered = 0;
+    for (std::size_t i = 0; i < track.size(); i += 3) {
+        FixBuffer batch(track.begin() + i, track.begin() + std::min(i + 3, track.size()));
+        filter.process(batch);
+        delivered += batch.size();
+    }
+    EXPECT_EQ(filter.statistics().rejected(), 24u);
+    EXPECT_EQ(delivered, 472u - 24u);
+}
+
+TEST(OSOutlierFilterTests, testItDropsFixesWithDegradedAccuracy) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    fixes[50].horizontalAccuracy = 80;
+    fixes[51].horizontalAccuracy = 12;
+
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(filter.statistics().rejectedAccuracy, 1u);
+    EXPECT_EQ(fixes.size(), 471u);
+}
+
+TEST(OSOutlierFilterTests, testItKeepsATrackWithPoorButSteadyAccuracy) {
+    // Walking pace at 65 m, as under tree cover or between tall buildings,
+    // with a gap half way that restarts the window over old samples
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    fixes.resize(120);
+    for (Fix &fix : fixes) {
+        fix.horizontalAccuracy = 65;
+        if (fix.sourceIndex >= 60) {
+            fix.timestamp += 600;
+        }
+    }
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(filter.statistics().rejected(), 0u);
+    EXPECT_EQ(fixes.size(), 120u);
+
+    // The window still catches a fix far worse than the rest
+    FixBuffer degraded = loadFixture("Southampton-OS-route.gpx");
+    degraded.resize(20);
+    for (Fix &fix : degraded) {
+        fix.horizontalAccuracy = fix.sourceIndex == 2 ? 300 : 65;
+    }
+    OutlierFilter fresh;
+    fresh.process(degraded);
+    EXPECT_EQ(fresh.statistics().rejectedAccuracy, 1u);
+}
+
+TEST(OSOutlierFilterTests, testItDropsInvalidFixes) {
+    FixBuffer fixes = {makeFix(0, 50.9, -1.4), makeFix(1, 50.9, -1.4)};
+    fixes[0].horizontalAccuracy = 5;
+
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(fixes.size(), 1u);
+    EXPECT_EQ(filter.statistics().rejectedInvalid, 1u);
+}
+
+TEST(OSOutlierFilterTests, testItAcceptsAGenuineJumpAfterARun) {
+    // 20 km away and staying there, like leaving a long tunnel
+    FixBuffer fixes;
+    for (int i = 0; i < 5; i++) {
+        fixes.push_back(makeFix(i, 50.9, -1.4));
+    }
+    for (int i = 5; i < 15; i++) {
+        fixes.push_back(makeFix(i, 51.08, -1.4));
+    }
+    for (Fix &fix : fixes) {
+        fix.horizontalAccuracy = 5;
+    }
+
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(filter.statistics().rejectedSpeed, 5u);
+    ASSERT_EQ(fixes.size(), 10u);
+    EXPECT_EQ(fixes.back().latitude, 51.08);
+}
+
+TEST(OSOutlierFilterTests, testItRestartsAfterAGap) {
+    FixBuffer fixes = {makeFix(0, 50.9, -1.4), makeFix(600, 51.5, -0.1)};
+    for (Fix &fix : fixes) {
+        fix.horizontalAccuracy = 5;
+    }
+    OutlierFilter filter;
+    filter.process(fixes);
+    EXPECT_EQ(fixes.size(), 2u);
+}
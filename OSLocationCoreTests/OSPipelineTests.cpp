@@ -0,0 +1,178 @@
+//
+//  OSPipelineTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSPipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+class CountingStage : public Stage {
+public:
+    void process(FixBuffer &fixes) override { count += fixes.size(); }
+    void reset() override { count = 0; }
+    std::size_t count = 0;
+};
+
+class DropEverySecondFixStage : public Stage {
+public:
+    void process(FixBuffer &fixes) override {
+        fixes.erase(std::remove_if(fixes.begin(), fixes.end(), [](const Fix &fix) { return fix.sourceIndex % 2 == 1; }), fixes.end());
+    }
+};
+
+class DropEverythingStage : public Stage {
+public:
+    void process(FixBuffer &fixes) override { fixes.clear(); }
+};
+
+} // namespace
+
+TEST(OSPipelineTests, testItLoadsTheGPXFixtures) {
+    FixBuffer southampton = loadFixture("Southampton-OS-route.gpx");
+    ASSERT_EQ(southampton.size(), 472u);
+    EXPECT_DOUBLE_EQ(southampton.front().latitude, 50.938461);
+    EXPECT_DOUBLE_EQ(southampton.front().longitude, -1.470514);
+    EXPECT_DOUBLE_EQ(southampton.front().timestamp, 1407499611);
+
+    FixBuffer lakeDistrict = loadFixture("lake-district-trail.gpx");
+    ASSERT_EQ(lakeDistrict.size(), 26u);
+    EXPECT_DOUBLE_EQ(lakeDistrict.back().timestamp - lakeDistrict.front().timestamp, 250);
+}
+
+TEST(OSPipelineTests, testAnEmptyPipelinePassesFixesThroughUntouched) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    FixBuffer original = fixes;
+    Pipeline pipeline;
+    pipeline.process(fixes);
+    ASSERT_EQ(fixes.size(), original.size());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        EXPECT_EQ(fixes[i].sourceIndex, original[i].sourceIndex);
+        EXPECT_EQ(fixes[i].flags, FixFlagNone);
+    }
+    EXPECT_EQ(pipeline.statistics().fixesIn, 472u);
+    EXPECT_EQ(pipeline.statistics().fixesOut, 472u);
+}
+
+TEST(OSPipelineTests, testItRunsStagesInOrder) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    Pipeline pipeline;
+    CountingStage *before = pipeline.addStage(std::make_unique<CountingStage>());
+    pipeline.addStage(std::make_unique<DropEverySecondFixStage>());
+    CountingStage *after = pipeline.addStage(std::make_unique<CountingStage>());
+
+    pipeline.process(fixes);
+    EXPECT_EQ(before->count, 472u);
+    EXPECT_EQ(after->count, 236u);
+    EXPECT_EQ(fixes.size(), 236u);
+    EXPECT_EQ(pipeline.statistics().fixesOut, 236u);
+}
+
+TEST(OSPipelineTests, testItFeedsFixesOneBatchAtATime) {
+    FixBuffer track = loadFixture("lake-district-trail.gpx");
+    Pipeline pipeline;
+    CountingStage *counter = pipeline.addStage(std::make_unique<CountingStage>());
+
+    FixBuffer batch;
+    for (const Fix &fix : track) {
+        batch.assign(1, fix);
+        pipeline.process(batch);
+    }
+    EXPECT_EQ(counter->count, 26u);
+    EXPECT_EQ(pipeline.statistics().batches, 26u);
+
+    pipeline.reset();
+    EXPECT_EQ(counter->count, 0u);
+    EXPECT_EQ(pipeline.statistics().batches, 0u);
+}
+
+TEST(OSPipelineTests, testItStopsWhenAStageEmptiesTheBatch) {
+    FixBuffer fixes = loadFixture("lake-district-trail.gpx");
+    Pipeline pipeline;
+    pipeline.addStage(std::make_unique<DropEverythingStage>());
+    CountingStage *counter = pipeline.addStage(std::make_unique<CountingStage>());
+    pipeline.process(fixes);
+    EXPECT_TRUE(fixes.empty());
+    EXPECT_EQ(counter->count, 0u);
+    EXPECT_EQ(pipeline.statistics().fixesOut, 0u);
+}
+
+TEST(OSPipelineTests, testItValidatesFixesLikeCoreLocation) {
+    Fix fix = makeFix(0, 50.9, -1.4);
+    EXPECT_FALSE(hasValidCoordinate(fix));
+    fix.horizontalAccuracy = 5;
+    EXPECT_TRUE(hasValidCoordinate(fix));
+    fix.latitude = 91;
+    EXPECT_FALSE(hasValidCoordinate(fix));
+    EXPECT_FALSE(hasValidSpeed(fix));
+    EXPECT_FALSE(hasValidCourse(fix));
+}
+
+namespace {
+
+class HoldLastFixStage : public Stage {
+public:
+    void process(FixBuffer &fixes) override {
+        if (m_held) {
+            fixes.insert(fixes.begin(), *m_held);
+        }
+        m_held = std::make_unique<Fix>(fixes.back());
+        fixes.pop_back();
+    }
+    void flush(FixBuffer &fixes) override {
+        if (m_held) {
+            fixes.push_back(*m_held);
+            m_held.reset();
+        }
+    }
+
+private:
+    std::unique_ptr<Fix> m_held;
+};
+
+} // namespace
+
+TEST(OSPipelineTests, testFlushPassesHeldFixesThroughLaterStages) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    Pipeline pipeline;
+    pipeline.addStage(std::make_unique<HoldLastFixStage>());
+    CountingStage *after = pipeline.addStage(std::make_unique<CountingStage>());
+
+    pipeline.process(fixes);
+    EXPECT_EQ(after->count, 471u);
+    pipeline.flush(fixes);
+    ASSERT_EQ(fixes.size(), 1u);
+    EXPECT_EQ(fixes[0].sourceIndex, 471);
+    EXPECT_EQ(after->count, 472u);
+    EXPECT_EQ(pipeline.statistics().fixesOut, 472u);
+}
+
+TEST(OSPipelineTests, testARemovedStageKeepsItsState) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    Pipeline pipeline;
+    CountingStage *counter = pipeline.addStage(std::make_unique<CountingStage>());
+    pipeline.addStage(std::make_unique<DropEverythingStage>());
+    pipeline.process(fixes);
+
+    std::unique_ptr<Stage> removed = pipeline.removeStage(counter);
+    ASSERT_EQ(removed.get(), counter);
+    EXPECT_EQ(pipeline.stageCount(), 1u);
+    EXPECT_EQ(pipeline.removeStage(counter), nullptr);
+    pipeline.removeAllStages();
+    pipeline.addStage(std::move(removed));
+    EXPECT_EQ(counter->count, 472u);
+
+    fixes = loadFixture("lake-district-trail.gpx");
+    pipeline.process(fixes);
+    EXPECT_EQ(counter->count, 498u);
+}
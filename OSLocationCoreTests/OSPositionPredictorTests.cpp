@@ -0,0 +1,162 @@
+//
+//  OSPositionPredictorTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSPositionPredictor.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+using oslocation::testing::NoiseSource;
+
+namespace {
+
+const LocalFrame kFrame(50.9, -1.4);
+
+Fix fixAt(double timestamp, double east, double north, double speed = -1, double course = -1) {
+    double latitude, longitude;
+    kFrame.toGeodetic(east, north, latitude, longitude);
+    Fix fix = makeFix(timestamp, latitude, longitude);
+    fix.horizontalAccuracy = 5;
+    fix.speed = speed;
+    fix.course = course;
+    return fix;
+}
+
+Heading headingAt(double timestamp, double magneticHeading) {
+    Heading heading{};
+    heading.timestamp = timestamp;
+    heading.magneticHeading = magneticHeading;
+    heading.trueHeading = -1;
+    heading.gridHeading = -1;
+    heading.headingAccuracy = 5;
+    return heading;
+}
+
+/**
+ *  The predicted position in metres east and north of the frame origin
+ */
+void predictAt(const PositionPredictor &predictor, double timestamp, double &east, double &north) {
+    double latitude, longitude;
+    ASSERT_TRUE(predictor.predict(timestamp, latitude, longitude));
+    kFrame.toLocal(latitude, longitude, east, north);
+}
+
+} // namespace
+
+TEST(OSPositionPredictorTests, testItExtrapolatesAlongTheReportedCourseAndSpeed) {
+    PositionPredictor predictor;
+    double latitude, longitude;
+    EXPECT_FALSE(predictor.predict(0, latitude, longitude));
+
+    predictor.update(fixAt(100, 0, 0, 10, 90));
+    double east, north;
+    predictAt(predictor, 101, east, north);
+    EXPECT_NEAR(east, 10, 0.01);
+    EXPECT_NEAR(north, 0, 0.01);
+
+    // Held at the fix before it, and where it had got to after the horizon
+    predictAt(predictor, 99, east, north);
+    EXPECT_NEAR(east, 0, 1e-6);
+    predictAt(predictor, 200, east, north);
+    EXPECT_NEAR(east, 10 * predictor.options().maximumHorizon, 0.05);
+}
+
+TEST(OSPositionPredictorTests, testItDerivesAVelocityWhenFixesCarryNone) {
+    PositionPredictor predictor;
+    for (int i = 0; i <= 10; i++) {
+        predictor.update(fixAt(i, 3 * i, 4 * i));
+    }
+    EXPECT_NEAR(predictor.velocityEast(), 3, 0.01);
+    EXPECT_NEAR(predictor.velocityNorth(), 4, 0.01);
+    double east, north;
+    predictAt(predictor, 13, east, north);
+    EXPECT_NEAR(east, 39, 0.05);
+    EXPECT_NEAR(north, 52, 0.05);
+}
+
+TEST(OSPositionPredictorTests, testItHoldsStillWhenFixesOnlyJitter) {
+    PositionPredictor predictor;
+    NoiseSource noise(3);
+    // Once the derived velocity has settled
+    for (int i = 0; i < 60; i++) {
+        predictor.update(fixAt(i, noise.gaussian() * 0.3, noise.gaussian() * 0.3));
+        if (i >= 5) {
+            EXPECT_EQ(predictor.velocityEast(), 0) << i;
+            EXPECT_EQ(predictor.velocityNorth(), 0) << i;
+        }
+    }
+
+    // No velocity is derived across a gap
+    predictor.update(fixAt(100, 100, 0));
+    EXPECT_EQ(predictor.velocityEast(), 0);
+}
+
+TEST(OSPositionPredictorTests, testItDerivesNoVelocityFromAProvisionalFix) {
+    PositionPredictor predictor;
+    // Cached 200 m back along the road a few seconds before a quick relaunch
+    Fix cached = fixAt(100, -200, 0);
+    cached.flags = FixFlagProvisional;
+    predictor.update(cached);
+    predictor.update(fixAt(104, 0, 0));
+    EXPECT_EQ(predictor.velocityEast(), 0);
+    EXPECT_EQ(predictor.velocityNorth(), 0);
+
+    // Live fixes after it derive one as usual
+    predictor.update(fixAt(105, 3, 4));
+    EXPECT_NEAR(predictor.velocityEast(), 3, 0.01);
+    EXPECT_NEAR(predictor.velocityNorth(), 4, 0.01);
+}
+
+TEST(OSPositionPredictorTests, testItEasesOntoEachNewFix) {
+    PositionPredictor predictor;
+    predictor.update(fixAt(0, 0, 0, 10, 0));
+    // The new fix is 4 m short of where the predictor expected it
+    predictor.update(fixAt(1, 0, 6, 10, 0));
+    double east, north;
+    predictAt(predictor, 1, east, north);
+    EXPECT_NEAR(north, 10, 0.01);
+    predictAt(predictor, 1.25, east, north);
+    EXPECT_NEAR(north, 6 + 2.5 + 2, 0.01);
+    predictAt(predictor, 1.5, east, north);
+    EXPECT_NEAR(north, 11, 0.01);
+
+    PositionPredictorOptions options;
+    options.blendTime = 0;
+    PositionPredictor immediate(options);
+    immediate.update(fixAt(0, 0, 0, 10, 0));
+    immediate.update(fixAt(1, 0, 6, 10, 0));
+    predictAt(immediate, 1, east, north);
+    EXPECT_NEAR(north, 6, 0.01);
+}
+
+TEST(OSPositionPredictorTests, testItTurnsWithTheCompass) {
+    PositionPredictor predictor;
+    predictor.updateHeading(headingAt(0, 350));
+    predictor.update(fixAt(0, 0, 0, 10, 0));
+    // A right angle to the right half a second later, across north
+    predictor.updateHeading(headingAt(0.5, 80));
+    double east, north;
+    predictAt(predictor, 1.5, east, north);
+    EXPECT_NEAR(north, 5, 0.01);
+    EXPECT_NEAR(east, 10, 0.01);
+
+    // Headings from before the fix do not turn it
+    predictor.update(fixAt(2, 0, 0, 10, 0));
+    predictor.updateHeading(headingAt(1.5, 170));
+    predictAt(predictor, 3, east, north);
+    EXPECT_NEAR(north, 10, 0.01);
+
+    PositionPredictorOptions options;
+    options.turnsWithHeading = false;
+    PositionPredictor straight(options);
+    straight.updateHeading(headingAt(0, 0));
+    straight.update(fixAt(0, 0, 0, 10, 0));
+    straight.updateHeading(headingAt(0.5, 90));
+    predictAt(straight, 1, east, north);
+    EXPECT_NEAR(north, 10, 0.01);
+}
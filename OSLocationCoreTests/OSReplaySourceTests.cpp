@@ -0,0 +1,123 @@
+//
+//  OSReplaySourceTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSReplaySource.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+/**
+ *  Records the clock time at which each batch reached the pipeline
+ */
+class ClockRecordingStage : public Stage {
+public:
+    explicit ClockRecordingStage(const Clock &clock) : m_clock(clock) {}
+    void process(FixBuffer &fixes) override {
+        for (const Fix &fix : fixes) {
+            releaseTimes.push_back(m_clock.now());
+            timestamps.push_back(fix.timestamp);
+        }
+    }
+    std::vector<double> releaseTimes;
+    std::vector<double> timestamps;
+
+private:
+    const Clock &m_clock;
+};
+
+} // namespace
+
+TEST(OSReplaySourceTests, testItReleasesFixesAtTheirRecordedCadence) {
+    FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    VirtualClock clock(1000);
+    ReplaySource replay(track, clock);
+    Pipeline pipeline;
+    auto recorder = pipeline.addStage(std::make_unique<ClockRecordingStage>(clock));
+
+    std::size_t delivered = 0;
+    ReplayStatistics statistics = replay.run(pipeline, [&delivered](const FixBuffer &batch) { delivered += batch.size(); });
+
+    EXPECT_EQ(delivered, 472u);
+    EXPECT_EQ(statistics.fixesEmitted, 472u);
+    EXPECT_EQ(statistics.batches, 469u);
+    EXPECT_DOUBLE_EQ(statistics.trackSeconds, 469);
+    ASSERT_EQ(recorder->releaseTimes.size(), track.size());
+    for (std::size_t i = 0; i < track.size(); i++) {
+        EXPECT_DOUBLE_EQ(recorder->releaseTimes[i] - 1000, track[i].timestamp - track.front().timestamp);
+        EXPECT_DOUBLE_EQ(recorder->timestamps[i], track[i].timestamp);
+    }
+    EXPECT_DOUBLE_EQ(clock.now(), 1469);
+}
+
+TEST(OSReplaySourceTests, testItWarpsTime) {
+    VirtualClock clock;
+    ReplayOptions options;
+    options.speed = 10;
+    ReplaySource replay(loadFixture("lake-district-trail.gpx"), clock, options);
+    Pipeline pipeline;
+    replay.run(pipeline, [](const FixBuffer &) {});
+    EXPECT_DOUBLE_EQ(clock.now(), 25);
+}
+
+TEST(OSReplaySourceTests, testItDoesNotWaitWhenReplayingAsFastAsPossible) {
+    VirtualClock clock;
+    ReplayOptions options;
+    options.mode = ReplayMode::AsFastAsPossible;
+    ReplaySource replay(loadFixture("lake-district-trail.gpx"), clock, options);
+    Pipeline pipeline;
+    ReplayStatistics statistics = replay.run(pipeline, [](const FixBuffer &) {});
+    EXPECT_EQ(statistics.fixesEmitted, 26u);
+    EXPECT_DOUBLE_EQ(clock.now(), 0);
+}
+
+TEST(OSReplaySourceTests, testItSoaksAnHourLongRecordingUsingAVirtualClock) {
+    VirtualClock clock;
+    ReplayOptions options;
+    options.loops = 8;
+    ReplaySource replay(loadFixture("Southampton-OS-route.gpx"), clock, options);
+    Pipeline pipeline;
+    auto recorder = pipeline.addStage(std::make_unique<ClockRecordingStage>(clock));
+    ReplayStatistics statistics = replay.run(pipeline, [](const FixBuffer &) {});
+
+    EXPECT_EQ(statistics.fixesEmitted, 472u * 8);
+    EXPECT_GT(statistics.trackSeconds, 3600);
+    for (std::size_t i = 1; i < recorder->timestamps.size(); i++) {
+        ASSERT_GE(recorder->timestamps[i], recorder->timestamps[i - 1]);
+    }
+}
+
+TEST(OSReplaySourceTests, testItRebasesTimestampsOntoTheClock) {
+    VirtualClock clock(500);
+    ReplayOptions options;
+    options.rebaseTimestamps = true;
+    options.speed = 2;
+    ReplaySource replay(loadFixture("lake-district-trail.gpx"), clock, options);
+    FixBuffer batch;
+    ASSERT_TRUE(replay.nextBatch(batch));
+    EXPECT_DOUBLE_EQ(batch.front().timestamp, 500);
+    ASSERT_TRUE(replay.nextBatch(batch));
+    EXPECT_DOUBLE_EQ(batch.front().timestamp, 505);
+    EXPECT_EQ(batch.front().sourceIndex, 0);
+}
+
+TEST(OSReplaySourceTests, testItFollowsTheWallClock) {
+    SystemClock clock;
+    ReplayOptions options;
+    options.speed = 1000;
+    ReplaySource replay(loadFixture("lake-district-trail.gpx"), clock, options);
+    Pipeline pipeline;
+    double start = clock.now();
+    replay.run(pipeline, [](const FixBuffer &) {});
+    EXPECT_GE(clock.now() - start, 0.25);
+}
@@ -0,0 +1,255 @@
+//
+//  OSRouteMatcherTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGeodesic.h"
+#include "OSRouteMatcher.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::NoiseSource;
+using oslocation::testing::fixturePath;
+
+namespace {
+
+struct Polyline {
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+};
+
+/**
+ *  A polyline through points given in metres east and north of Southampton
+ */
+Polyline polyline(std::initializer_list<std::pair<double, double>> points) {
+    const LocalFrame frame(50.9, -1.4);
+    Polyline line;
+    for (const auto &point : points) {
+        double latitude, longitude;
+        frame.toGeodetic(point.first, point.second, latitude, longitude);
+        line.latitudes.push_back(latitude);
+        line.longitudes.push_back(longitude);
+    }
+    return line;
+}
+
+/**
+ *  Fixes every second along a polyline at a steady speed, with noise
+ */
+FixBuffer walk(const Polyline &line, double speed, double sigma, std::uint64_t seed) {
+    NoiseSource noise(seed);
+    FixBuffer fixes;
+    double timestamp = 0, carried = 0;
+    for (std::size_t i = 0; i + 1 < line.latitudes.size(); i++) {
+        const double length = distanceBetween(line.latitudes[i], line.longitudes[i], line.latitudes[i + 1], line.longitudes[i + 1]);
+        double along = carried;
+        for (; along < length; along += speed) {
+            const double t = along / length;
+            Fix fix = makeFix(timestamp++,
+                              line.latitudes[i] + t * (line.latitudes[i + 1] - line.latitudes[i]),
+                              line.longitudes[i] + t * (line.longitudes[i + 1] - line.longitudes[i]));
+            LocalFrame(fix.latitude, fix.longitude).toGeodetic(noise.gaussian() * sigma, noise.gaussian() * sigma, fix.latitude, fix.longitude);
+            fix.horizontalAccuracy = 5;
+            fixes.push_back(fix);
+        }
+        carried = along - length;
+    }
+    return fixes;
+}
+
+} // namespace
+
+TEST(OSRouteMatcherTests, testItLoadsARouteFromGPX) {
+    Route route;
+    const GPXResult result = route.loadGPX(fixturePath("Southampton-OS-route.gpx"));
+    ASSERT_EQ(result.status, GPXStatus::Ok);
+    EXPECT_GT(route.vertexCount(), 400u);
+    EXPECT_EQ(route.segmentCount(), route.vertexCount() - 1);
+    EXPECT_GT(route.length(), 0);
+
+    Route missing;
+    EXPECT_EQ(missing.loadGPX(fixturePath("missing.gpx")).status, GPXStatus::FileError);
+    EXPECT_EQ(missing.segmentCount(), 0u);
+}
+
+TEST(OSRouteMatcherTests, testItMeasuresDistanceAlongAndAcrossTheRoute) {
+    const Polyline line = polyline({{0, 0}, {0, 1000}, {1000, 1000}});
+    Route route;
+    ASSERT_TRUE(route.assign(line.latitudes.data(), line.longitudes.data(), line.latitudes.size()));
+    EXPECT_NEAR(route.length(), 2000, 0.5);
+
+    const LocalFrame frame(50.9, -1.4);
+    double latitude, longitude;
+    // Right of the northbound leg, then left of the eastbound one
+    frame.toGeodetic(10, 400, latitude, longitude);
+    RouteMatch match = route.project(0, latitude, longitude);
+    EXPECT_NEAR(match.distanceAlongRoute, 400, 0.5);
+    EXPECT_NEAR(match.crossTrackError, 10, 0.01);
+    frame.toGeodetic(300, 1020, latitude, longitude);
+    match = route.project(1, latitude, longitude);
+    EXPECT_NEAR(match.distanceAlongRoute, 1300, 0.5);
+    EXPECT_NEAR(match.crossTrackError, -20, 0.01);
+
+    RouteMatcher matcher(route);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    ASSERT_TRUE(matcher.update(0, latitude, longitude, progress, events));
+    EXPECT_EQ(progress.segment, 1u);
+    EXPECT_NEAR(progress.remainingDistance, 700, 0.5);
+    EXPECT_TRUE(progress.onRoute);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].transition, RouteTransition::OnRoute);
+}
+
+TEST(OSRouteMatcherTests, testItFollowsTheSouthamptonRouteWithoutLeavingIt) {
+    Route route;
+    route.loadGPX(fixturePath("Southampton-OS-route.gpx"));
+    Polyline line;
+    GPXReader::readFile(fixturePath("Southampton-OS-route.gpx"), [&line](const GPXPoint &point) {
+        line.latitudes.push_back(point.latitude);
+        line.longitudes.push_back(point.longitude);
+    });
+    // The fixture is itself a recorded track that wanders back and forth
+    // by a few metres, and starts with a hundred metres of it tangled in a
+    // knot where any match is as good as another
+    const FixBuffer fixes = walk(line, 1.4, 3, 7);
+
+    RouteMatcher matcher(route);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    double previous = 0;
+    for (const Fix &fix : fixes) {
+        ASSERT_TRUE(matcher.update(fix.timestamp, fix.latitude, fix.longitude, progress, events));
+        EXPECT_LT(std::fabs(progress.crossTrackError), 25);
+        EXPECT_GT(progress.distanceAlongRoute, previous - 10);
+        EXPECT_NEAR(progress.distanceAlongRoute + progress.remainingDistance, route.length(), 1e-6);
+        previous = progress.distanceAlongRoute;
+    }
+    EXPECT_NEAR(progress.remainingDistance, 0, 10);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].transition, RouteTransition::OnRoute);
+}
+
+TEST(OSRouteMatcherTests, testTheWorkPerFixDoesNotGrowWithTheRoute) {
+    // A 20 km zigzag with a vertex every 10 metres
+    Polyline line;
+    const LocalFrame frame(50.9, -1.4);
+    for (int i = 0; i <= 2000; i++) {
+        double latitude, longitude;
+        frame.toGeodetic((i % 20 < 10 ? i % 20 : 20 - i % 20) * 10.0, i * 10.0, latitude, longitude);
+        line.latitudes.push_back(latitude);
+        line.longitudes.push_back(longitude);
+    }
+    Route route;
+    route.assign(line.latitudes.data(), line.longitudes.data(), line.latitudes.size());
+    const FixBuffer fixes = walk(line, 10, 3, 5);
+
+    RouteMatcher matcher(route);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    std::size_t tested = 0, most = 0;
+    for (const Fix &fix : fixes) {
+        ASSERT_TRUE(matcher.update(fix.timestamp, fix.latitude, fix.longitude, progress, events));
+        ASSERT_NEAR(progress.distanceAlongRoute, fix.timestamp * 10, 20);
+        tested += matcher.lastSegmentsTested();
+        most = std::max(most, matcher.lastSegmentsTested());
+    }
+    EXPECT_EQ(events.size(), 1u);
+    EXPECT_LT(tested / fixes.size(), 30u);
+    EXPECT_LT(most, 40u);
+}
+
+TEST(OSRouteMatcherTests, testItReportsLeavingAndRejoiningTheRoute) {
+    const Polyline line = polyline({{0, 0}, {0, 2000}});
+    Route route;
+    route.assign(line.latitudes.data(), line.longitudes.data(), line.latitudes.size());
+    RouteMatcher matcher(route);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    const LocalFrame frame(50.9, -1.4);
+    auto at = [&](double timestamp, double east, double north) {
+        double latitude, longitude;
+        frame.toGeodetic(east, north, latitude, longitude);
+        return matcher.update(timestamp, latitude, longitude, progress, events);
+    };
+
+    // Nothing until the route is found
+    EXPECT_FALSE(at(0, 200, 0));
+    EXPECT_TRUE(at(1, 5, 10));
+    ASSERT_EQ(events.size(), 1u);
+
+    // A single stray fix is not enough to leave
+    EXPECT_TRUE(at(2, 80, 20));
+    EXPECT_TRUE(progress.onRoute);
+    EXPECT_NEAR(progress.crossTrackError, 80, 0.1);
+    EXPECT_TRUE(at(3, 2, 30));
+    EXPECT_EQ(events.size(), 1u);
+
+    // Walking away from the route for the off route time
+    for (int i = 0; i <= 5; i++) {
+        at(4 + i, 40 + 10 * i, 35);
+    }
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[1].transition, RouteTransition::OffRoute);
+    EXPECT_EQ(events[1].timestamp, 9);
+    EXPECT_FALSE(progress.onRoute);
+
+    // Coming back within the off route distance is not enough to rejoin
+    at(10, 25, 40);
+    EXPECT_FALSE(progress.onRoute);
+    at(11, 10, 45);
+    EXPECT_TRUE(progress.onRoute);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[2].transition, RouteTransition::OnRoute);
+    EXPECT_NEAR(events[2].distanceAlongRoute, 45, 0.5);
+}
+
+TEST(OSRouteMatcherTests, testItFollowsARouteThatDoublesBackInOrder) {
+    // Out along a street and back the same way, then on to the east
+    const Polyline line = polyline({{0, 0}, {0, 300}, {0.5, 0}, {300, 0}});
+    Route route;
+    route.assign(line.latitudes.data(), line.longitudes.data(), line.latitudes.size());
+    const FixBuffer fixes = walk(line, 1.4, 2, 11);
+
+    RouteMatcher matcher(route);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    double previous = 0;
+    for (const Fix &fix : fixes) {
+        ASSERT_TRUE(matcher.update(fix.timestamp, fix.latitude, fix.longitude, progress, events));
+        const double expected = fix.timestamp * 1.4;
+        EXPECT_NEAR(progress.distanceAlongRoute, expected, 15) << fix.timestamp;
+        EXPECT_GT(progress.distanceAlongRoute, previous - 10);
+        previous = progress.distanceAlongRoute;
+    }
+    EXPECT_EQ(events.size(), 1u);
+}
+
+TEST(OSRouteMatcherTests, testItFindsTheRouteAgainAfterAShortcut) {
+    // A loop out to the north east; the walker cuts across its neck
+    const Polyline line = polyline({{0, 0}, {0, 1000}, {1000, 1000}, {1000, 0}, {40, 0}, {40, -1000}});
+    Route route;
+    route.assign(line.latitudes.data(), line.longitudes.data(), line.latitudes.size());
+    RouteMatcherOptions options;
+    options.maximumSpeed = 5;
+    RouteMatcher matcher(route, options);
+    RouteProgress progress;
+    std::vector<RouteEvent> events;
+    const LocalFrame frame(50.9, -1.4);
+    double latitude, longitude;
+    frame.toGeodetic(0, 50, latitude, longitude);
+    ASSERT_TRUE(matcher.update(0, latitude, longitude, progress, events));
+    frame.toGeodetic(40, -50, latitude, longitude);
+    ASSERT_TRUE(matcher.update(30, latitude, longitude, progress, events));
+    EXPECT_NEAR(progress.distanceAlongRoute, 4010, 1);
+    EXPECT_TRUE(progress.onRoute);
+    EXPECT_EQ(events.size(), 1u);
+}
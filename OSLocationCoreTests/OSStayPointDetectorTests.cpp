@@ -0,0 +1,141 @@
+//
+//  OSStayPointDetectorTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSStayPointDetector.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+using oslocation::testing::distance;
+using oslocation::testing::insertPauses;
+using oslocation::testing::loadFixture;
+using oslocation::testing::makeJourney;
+
+TEST(OSStayPointDetectorTests, testItKeepsAWalk) {
+    FixBuffer fixes = insertPauses(loadFixture("Southampton-OS-route.gpx"), {}, 0, 1);
+    StayPointDetector detector;
+    detector.process(fixes);
+    EXPECT_EQ(fixes.size(), 472u);
+    EXPECT_TRUE(detector.events().empty());
+    EXPECT_EQ(detector.suppressedCount(), 0u);
+}
+
+TEST(OSStayPointDetectorTests, testItCollapsesPausesIntoStays) {
+    const FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    FixBuffer fixes = insertPauses(track, {{100, 600}, {300, 900}}, 3, 11);
+    ASSERT_EQ(fixes.size(), 472u + 1500u);
+    const double firstPause = fixes[100].timestamp;
+    const double secondPause = fixes[300 + 600].timestamp;
+
+    StayPointDetector detector;
+    detector.process(fixes);
+
+    // Only the first two minutes of each stop are delivered
+    EXPECT_LT(fixes.size(), 472u + 2 * 130u);
+    EXPECT_GT(detector.suppressedCount(), 1500u - 2 * 130u);
+    EXPECT_EQ(fixes.size() + detector.suppressedCount(), 472u + 1500u);
+
+    const std::vector<StayEvent> &events = detector.events();
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0].type, StayEventType::Began);
+    EXPECT_EQ(events[1].type, StayEventType::Ended);
+    EXPECT_EQ(events[2].type, StayEventType::Began);
+    EXPECT_EQ(events[3].type, StayEventType::Ended);
+
+    EXPECT_NEAR(events[0].stay.arrival, firstPause, 30);
+    EXPECT_NEAR(events[0].stay.departure, events[0].stay.arrival + 120, 1);
+    EXPECT_NEAR(events[1].stay.departure, firstPause + 600, 30);
+    EXPECT_NEAR(events[3].stay.departure, secondPause + 900, 30);
+    EXPECT_GT(events[3].stay.fixCount, 880u);
+
+    Fix centre = track[100];
+    centre.latitude = events[1].stay.latitude;
+    centre.longitude = events[1].stay.longitude;
+    EXPECT_LT(distance(centre, track[100]), 3);
+    // The noise, widened by the approach and departure inside the radius
+    EXPECT_GT(events[1].stay.spread, 3 * M_SQRT2);
+    EXPECT_LT(events[1].stay.spread, 10);
+}
+
+TEST(OSStayPointDetectorTests, testItKeepsTheStartOfTheNextLeg) {
+    FixBuffer fixes = makeJourney({{300, 0}, {60, 1.4}});
+    StayPointDetector detector;
+    detector.process(fixes);
+    ASSERT_EQ(detector.events().size(), 2u);
+
+    // Fixes are only dropped until the user is about 30 m from the stay
+    std::size_t walking = 0;
+    for (const Fix &fix : fixes) {
+        walking += fix.sourceIndex >= 300;
+    }
+    EXPECT_GE(walking, 60u - 25u);
+}
+
+TEST(OSStayPointDetectorTests, testItDetectsStaysAcrossBatches) {
+    const FixBuffer track = insertPauses(loadFixture("Southampton-OS-route.gpx"), {{200, 300}}, 3, 5);
+    StayPointDetector detector;
+    std::size_t delivered = 0;
+    for (std::size_t i = 0; i < track.size(); i += 7) {
+        FixBuffer batch(track.begin() + i, track.begin() + std::min(i + 7, track.size()));
+        detector.process(batch);
+        delivered += batch.size();
+    }
+    EXPECT_EQ(detector.events().size(), 2u);
+    EXPECT_EQ(delivered + detector.suppressedCount(), track.size());
+    EXPECT_LT(delivered, 472u + 130u);
+}
+
+TEST(OSStayPointDetectorTests, testItEndsAStayWhenFlushed) {
+    FixBuffer fixes = makeJourney({{60, 1.4}, {300, 0}});
+    StayPointDetector detector;
+    detector.process(fixes);
+    ASSERT_TRUE(detector.isInStay());
+    ASSERT_EQ(detector.events().size(), 1u);
+
+    FixBuffer held;
+    detector.flush(held);
+    EXPECT_TRUE(held.empty());
+    EXPECT_FALSE(detector.isInStay());
+    ASSERT_EQ(detector.events().size(), 2u);
+    EXPECT_EQ(detector.events()[1].type, StayEventType::Ended);
+    EXPECT_EQ(detector.events()[1].stay.departure, 1359);
+
+    // Walking off but still short of the departure radius when flushed
+    FixBuffer leaving = makeJourney({{300, 0}, {30, 1.4}});
+    const std::size_t total = leaving.size();
+    StayPointDetector edge;
+    edge.process(leaving);
+    ASSERT_TRUE(edge.isInStay());
+    edge.flush(held);
+    EXPECT_FALSE(edge.isInStay());
+    ASSERT_FALSE(held.empty());
+    for (std::size_t i = 0; i < held.size(); i++) {
+        EXPECT_GE(held[i].sourceIndex, 300);
+        if (i > 0) {
+            EXPECT_EQ(held[i].sourceIndex, held[i - 1].sourceIndex + 1);
+        }
+    }
+    EXPECT_EQ(held.back().sourceIndex, static_cast<std::int32_t>(total - 1));
+    EXPECT_EQ(leaving.size() + held.size() + edge.suppressedCount(), total);
+}
+
+TEST(OSStayPointDetectorTests, testItIgnoresAFixWithinItsAccuracy) {
+    FixBuffer fixes = makeJourney({{300, 0}});
+    StayPointDetector detector;
+    detector.process(fixes);
+    ASSERT_TRUE(detector.isInStay());
+
+    // 80 m away but claiming 100 m accuracy, as a cell tower fix would
+    FixBuffer jump = makeJourney({{1, 80}, {1, 0}});
+    jump[1].timestamp = 1300;
+    jump[1].horizontalAccuracy = 100;
+    FixBuffer batch(1, jump[1]);
+    detector.process(batch);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(detector.isInStay());
+}
@@ -0,0 +1,127 @@
+//
+//  OSSubscriptionHubTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSSubscriptionHub.h"
+
+#include <gtest/gtest.h>
+
+using namespace oslocation;
+using oslocation::testing::distance;
+using oslocation::testing::makeJourney;
+
+TEST(OSSubscriptionHubTests, testItMergesSettings) {
+    SubscriptionHub hub;
+    LocationSettings merged;
+    EXPECT_FALSE(hub.mergedSettings(merged));
+
+    SubscriptionOptions map;
+    map.settings = {LocationAccuracy::Best, 10, false};
+    SubscriptionOptions compass;
+    compass.settings = {LocationAccuracy::Kilometre, 500, true};
+    SubscriptionOptions recorder;
+    recorder.settings = {LocationAccuracy::BestForNavigation, 5, false};
+
+    hub.subscribe(map, [](const FixBuffer &) {});
+    const SubscriptionId compassId = hub.subscribe(compass, [](const FixBuffer &) {});
+    ASSERT_TRUE(hub.mergedSettings(merged));
+    EXPECT_EQ(merged.accuracy, LocationAccuracy::Best);
+    EXPECT_EQ(merged.distanceFilter, 10);
+    EXPECT_TRUE(merged.headingUpdates);
+
+    const SubscriptionId recorderId = hub.subscribe(recorder, [](const FixBuffer &) {});
+    EXPECT_TRUE(hub.unsubscribe(compassId));
+    EXPECT_FALSE(hub.unsubscribe(compassId));
+    ASSERT_TRUE(hub.mergedSettings(merged));
+    EXPECT_EQ(merged.accuracy, LocationAccuracy::BestForNavigation);
+    EXPECT_EQ(merged.distanceFilter, 5);
+    EXPECT_FALSE(merged.headingUpdates);
+    EXPECT_EQ(hub.subscriberCount(), 2u);
+
+    hub.unsubscribe(recorderId);
+    ASSERT_TRUE(hub.mergedSettings(merged));
+    EXPECT_EQ(merged.accuracy, LocationAccuracy::Best);
+}
+
+TEST(OSSubscriptionHubTests, testItFiltersEachSubscriberIndependently) {
+    const FixBuffer journey = makeJourney({{600, 1.5}});
+    SubscriptionHub hub;
+
+    FixBuffer everything, everyTenMetres, everyMinute;
+    hub.subscribe(SubscriptionOptions(), [&](const FixBuffer &fixes) { everything.insert(everything.end(), fixes.begin(), fixes.end()); });
+    SubscriptionOptions distanceOptions;
+    distanceOptions.minimumDistance = 10;
+    hub.subscribe(distanceOptions, [&](const FixBuffer &fixes) { everyTenMetres.insert(everyTenMetres.end(), fixes.begin(), fixes.end()); });
+    SubscriptionOptions intervalOptions;
+    intervalOptions.minimumInterval = 60;
+    hub.subscribe(intervalOptions, [&](const FixBuffer &fixes) { everyMinute.insert(everyMinute.end(), fixes.begin(), fixes.end()); });
+
+    for (std::size_t i = 0; i < journey.size(); i += 4) {
+        hub.publish(FixBuffer(journey.begin() + i, journey.begin() + std::min(i + 4, journey.size())));
+    }
+
+    EXPECT_EQ(everything.size(), 600u);
+    EXPECT_EQ(everyMinute.size(), 10u);
+    EXPECT_EQ(everyTenMetres.size(), 86u);
+    for (std::size_t i = 1; i < everyTenMetres.size(); i++) {
+        EXPECT_GE(distance(everyTenMetres[i - 1], everyTenMetres[i]), 10 - 1e-6);
+    }
+    // Source indices survive so subscribers can map back to the originals
+    EXPECT_EQ(everyMinute[1].sourceIndex, 60);
+}
+
+TEST(OSSubscriptionHubTests, testItDropsInaccurateFixesForStrictSubscribers) {
+    FixBuffer fixes = makeJourney({{10, 1}});
+    fixes[3].horizontalAccuracy = 65;
+    SubscriptionHub hub;
+    SubscriptionOptions strict;
+    strict.maximumAccuracy = 20;
+    std::size_t strictCount = 0, relaxedCount = 0;
+    hub.subscribe(strict, [&](const FixBuffer &batch) { strictCount += batch.size(); });
+    hub.subscribe(SubscriptionOptions(), [&](const FixBuffer &batch) { relaxedCount += batch.size(); });
+    hub.publish(fixes);
+    EXPECT_EQ(strictCount, 9u);
+    EXPECT_EQ(relaxedCount, 10u);
+}
+
+TEST(OSSubscriptionHubTests, testItAllowsSubscribingAndUnsubscribingFromCallbacks) {
+    const FixBuffer journey = makeJourney({{3, 1}});
+    SubscriptionHub hub;
+    std::size_t firstCalls = 0, secondCalls = 0, lateCalls = 0;
+    SubscriptionId first = 0;
+    first = hub.subscribe(SubscriptionOptions(), [&](const FixBuffer &) {
+        firstCalls++;
+        hub.unsubscribe(first);
+        hub.subscribe(SubscriptionOptions(), [&](const FixBuffer &) { lateCalls++; });
+    });
+    hub.subscribe(SubscriptionOptions(), [&](const FixBuffer &) { secondCalls++; });
+
+    hub.publish(FixBuffer(1, journey[0]));
+    EXPECT_EQ(firstCalls, 1u);
+    EXPECT_EQ(secondCalls, 1u);
+    EXPECT_EQ(lateCalls, 0u);
+    EXPECT_EQ(hub.subscriberCount(), 2u);
+
+    hub.publish(FixBuffer(1, journey[1]));
+    EXPECT_EQ(firstCalls, 1u);
+    EXPECT_EQ(secondCalls, 2u);
+    EXPECT_EQ(lateCalls, 1u);
+}
+
+TEST(OSSubscriptionHubTests, testItForgetsTheLastFixOnReset) {
+    const FixBuffer journey = makeJourney({{10, 0}});
+    SubscriptionHub hub;
+    SubscriptionOptions options;
+    options.minimumDistance = 100;
+    std::size_t delivered = 0;
+    hub.subscribe(options, [&](const FixBuffer &fixes) { delivered += fixes.size(); });
+    hub.publish(journey);
+    EXPECT_EQ(delivered, 1u);
+    hub.reset();
+    hub.publish(journey);
+    EXPECT_EQ(delivered, 2u);
+}
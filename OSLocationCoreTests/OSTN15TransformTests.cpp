@@ -0,0 +1,202 @@
+//
+//  OSTN15TransformTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTN15Transform.h"
+#include "OSTransverseMercator.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace oslocation;
+
+namespace {
+
+/**
+ *  Shift fields that vary bilinearly within each cell, so interpolation is
+ *  exact and expected values can be computed directly
+ */
+double eastShiftAt(double easting, double northing) {
+    return 95 + easting * 2e-5 - northing * 1e-5;
+}
+
+double northShiftAt(double easting, double northing) {
+    return -80 + easting * 1e-5 + northing * 3e-5;
+}
+
+double geoidHeightAt(double easting, double northing) {
+    return 45 + (easting - northing) * 1e-5;
+}
+
+std::vector<OSTN15Node> syntheticNodes(std::uint32_t columns, std::uint32_t rows) {
+    std::vector<OSTN15Node> nodes;
+    for (std::uint32_t row = 0; row < rows; row++) {
+        for (std::uint32_t column = 0; column < columns; column++) {
+            const double e = column * 1000.0, n = row * 1000.0;
+            nodes.push_back(OSTN15Node{static_cast<float>(eastShiftAt(e, n)), static_cast<float>(northShiftAt(e, n)), static_cast<float>(geoidHeightAt(e, n)), row < rows / 2 ? 1u : 0u});
+        }
+    }
+    return nodes;
+}
+
+std::string temporaryPath(const char *name) {
+    return "/tmp/oslocation-" + std::to_string(getpid()) + "-" + name;
+}
+
+} // namespace
+
+TEST(OSTN15TransformTests, testItInterpolatesTheGridBilinearly) {
+    OSTN15Grid grid;
+    grid.assign(syntheticNodes(701, 1251), 701, 1251);
+    OSTN15Shift shift;
+    ASSERT_TRUE(grid.shift(445123.4, 115678.9, shift));
+    EXPECT_NEAR(shift.eastShift, eastShiftAt(445123.4, 115678.9), 1e-4);
+    EXPECT_NEAR(shift.northShift, northShiftAt(445123.4, 115678.9), 1e-4);
+    EXPECT_NEAR(shift.geoidHeight, geoidHeightAt(445123.4, 115678.9), 1e-4);
+    EXPECT_TRUE(shift.hasGeoidHeight);
+
+    ASSERT_TRUE(grid.shift(445123.4, 1000000, shift));
+    EXPECT_FALSE(shift.hasGeoidHeight);
+    EXPECT_FALSE(grid.shift(-1, 100, shift));
+    EXPECT_FALSE(grid.shift(700000, 100, shift));
+}
+
+TEST(OSTN15TransformTests, testItShiftsProjectedPointsInEveryKernel) {
+    OSTN15Grid grid;
+    grid.assign(syntheticNodes(701, 1251), 701, 1251);
+    OSTN15Transform transform(grid);
+
+    std::vector<double> latitudes = {50.938461, 54.36428955752, 57.5, 51.5, 0};
+    std::vector<double> longitudes = {-1.470514, -3.0964318637523, -4.2, 0.1, 0};
+    std::vector<double> heights = {16.85, 100, 200, 30, 0};
+    for (simd::Level level : {simd::Level::Scalar, simd::Level::NEON, simd::Level::AVX2}) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        std::vector<double> eastings(5), northings(5), orthometric(5);
+        transform.transform(latitudes.data(), longitudes.data(), heights.data(), 5, eastings.data(), northings.data(), orthometric.data(), level);
+        for (std::size_t i = 0; i < 4; i++) {
+            double e, n;
+            projectTransverseMercator(nationalGridProjection(kGRS80), latitudes[i], longitudes[i], e, n);
+            EXPECT_NEAR(eastings[i], e + eastShiftAt(e, n), 1e-4);
+            EXPECT_NEAR(northings[i], n + northShiftAt(e, n), 1e-4);
+            if (n < 625000) {
+                EXPECT_NEAR(orthometric[i], heights[i] - geoidHeightAt(e, n), 1e-4);
+            } else {
+                EXPECT_TRUE(std::isnan(orthometric[i]));
+            }
+        }
+        EXPECT_TRUE(std::isnan(eastings[4]));
+        EXPECT_TRUE(std::isnan(northings[4]));
+    }
+
+    GridPosition position = transform.transform(50.938461, -1.470514, 16.85);
+    EXPECT_NEAR(position.easting, 0, 500000);
+    EXPECT_FALSE(std::isnan(position.height));
+}
+
+TEST(OSTN15TransformTests, testItShiftsNothingWithoutAGrid) {
+    const OSTN15Grid grid;
+    OSTN15Shift shift;
+    EXPECT_FALSE(grid.shift(445123.4, 115678.9, shift));
+
+    OSTN15Transform transform(grid);
+    const GridPosition position = transform.transform(50.938461, -1.470514, 16.85);
+    EXPECT_TRUE(std::isnan(position.easting));
+    EXPECT_TRUE(std::isnan(position.northing));
+    EXPECT_TRUE(std::isnan(position.height));
+}
+
+TEST(OSTN15TransformTests, testItRoundTripsGridFiles) {
+    std::string path = temporaryPath("grid.bin");
+    ASSERT_TRUE(OSTN15Grid::write(path, syntheticNodes(4, 3), 4, 3));
+    OSTN15Grid grid;
+    ASSERT_TRUE(grid.open(path));
+    EXPECT_EQ(grid.columns(), 4u);
+    EXPECT_EQ(grid.rows(), 3u);
+    EXPECT_FLOAT_EQ(grid.node(3, 2).eastShift, static_cast<float>(eastShiftAt(3000, 2000)));
+    std::remove(path.c_str());
+
+    std::ofstream(path) << "not a grid";
+    EXPECT_FALSE(grid.open(path));
+    std::remove(path.c_str());
+}
+
+TEST(OSTN15TransformTests, testItRejectsIncompleteDataFiles) {
+    std::string dataFile = temporaryPath("OSTN15_OSGM15_DataFile.txt");
+    std::string gridFile = temporaryPath("grid-from-data.bin");
+    std::ofstream(dataFile) << "Point_ID,ETRS89_Easting,ETRS89_Northing,ETRS89_OSGB36_EShift,ETRS89_OSGB36_NShift,ETRS89_OSGM15_GeoidHeight,OSGM15_Datum_Flag\n"
+                            << "1,0,0,91.526,-81.795,44.775,0\n";
+    EXPECT_FALSE(OSTN15Grid::convertDataFile(dataFile, gridFile));
+    std::remove(dataFile.c_str());
+    std::remove(gridFile.c_str());
+}
+
+/**
+ *  Runs the published OSTN15 test points when the OS data is available.
+ *  Point OSTN15_DATA_DIR at a directory holding OSTN15_OSGM15_DataFile.txt,
+ *  OSTN15_OSGM15_TestInput_ETRStoOSGB.txt and
+ *  OSTN15_OSGM15_TestOutput_ETRStoOSGB.txt.
+ */
+TEST(OSTN15TransformTests, testItMatchesThePublishedTestPoints) {
+    const char *directory = std::getenv("OSTN15_DATA_DIR");
+    if (!directory) {
+        GTEST_SKIP() << "OSTN15_DATA_DIR not set";
+    }
+    std::string base(directory);
+    std::string gridFile = temporaryPath("ostn15.bin");
+    ASSERT_TRUE(OSTN15Grid::convertDataFile(base + "/OSTN15_OSGM15_DataFile.txt", gridFile));
+    OSTN15Grid grid;
+    ASSERT_TRUE(grid.open(gridFile));
+    OSTN15Transform transform(grid);
+
+    auto readRows = [](const std::string &path) {
+        std::vector<std::vector<double>> rows;
+        std::ifstream stream(path);
+        std::string line;
+        while (std::getline(stream, line)) {
+            std::stringstream fields(line);
+            std::string field;
+            std::vector<double> row;
+            std::getline(fields, field, ',');
+            while (std::getline(fields, field, ',')) {
+                char *end;
+                double value = std::strtod(field.c_str(), &end);
+                if (end != field.c_str()) {
+                    row.push_back(value);
+                }
+            }
+            if (row.size() >= 3) {
+                rows.push_back(row);
+            }
+        }
+        return rows;
+    };
+    auto inputs = readRows(base + "/OSTN15_OSGM15_TestInput_ETRStoOSGB.txt");
+    auto outputs = readRows(base + "/OSTN15_OSGM15_TestOutput_ETRStoOSGB.txt");
+    ASSERT_FALSE(inputs.empty());
+    ASSERT_EQ(inputs.size(), outputs.size());
+    for (std::size_t i = 0; i < inputs.size(); i++) {
+        GridPosition position = transform.transform(inputs[i][0], inputs[i][1], inputs[i][2]);
+        if (outputs[i][0] == 0 && outputs[i][1] == 0) {
+            continue;
+        }
+        EXPECT_NEAR(position.easting, outputs[i][0], 0.001) << "point " << i + 1;
+        EXPECT_NEAR(position.northing, outputs[i][1], 0.001) << "point " << i + 1;
+        if (!std::isnan(position.height) && outputs[i][2] != 0) {
+            EXPECT_NEAR(position.height, outputs[i][2], 0.001) << "point " << i + 1;
+        }
+    }
+    std::remove(gridFile.c_str());
+}
@@ -0,0 +1,199 @@
+//
+//  OSTrackFileTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSTrackFile.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+using namespace oslocation;
+using oslocation::testing::fixturePath;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+std::string temporaryPath(const char *name) {
+    return ::testing::TempDir() + name;
+}
+
+void writeTrack(const std::string &path, const FixBuffer &fixes, std::uint32_t pointsPerBlock) {
+    TrackFileWriter writer;
+    ASSERT_TRUE(writer.open(path, pointsPerBlock));
+    for (const Fix &fix : fixes) {
+        ASSERT_TRUE(writer.append(fix));
+    }
+    ASSERT_TRUE(writer.close());
+}
+
+} // namespace
+
+TEST(OSTrackFileTests, testItRoundTripsFixesToTheStoredPrecision) {
+    const FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    const std::string path = temporaryPath("roundtrip.ostrack");
+    writeTrack(path, fixes, 100);
+
+    TrackFile file;
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.pointCount(), fixes.size());
+    EXPECT_EQ(file.blockCount(), 5u);
+    FixBuffer read;
+    ASSERT_TRUE(file.readAll(read));
+    ASSERT_EQ(read.size(), fixes.size());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        EXPECT_NEAR(read[i].latitude, fixes[i].latitude, 0.6e-7);
+        EXPECT_NEAR(read[i].longitude, fixes[i].longitude, 0.6e-7);
+        EXPECT_NEAR(read[i].timestamp, fixes[i].timestamp, 0.0005);
+        EXPECT_NEAR(read[i].altitude, fixes[i].altitude, 0.005);
+        EXPECT_EQ(read[i].horizontalAccuracy, fixes[i].horizontalAccuracy);
+        EXPECT_EQ(read[i].verticalAccuracy, fixes[i].verticalAccuracy);
+        EXPECT_EQ(read[i].sourceIndex, static_cast<std::int32_t>(i));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackFileTests, testItKeepsMissingValues) {
+    FixBuffer fixes = {makeFix(NAN, 54.45, -3.02), makeFix(1000, 54.46, -3.03, 312.5)};
+    fixes[0].horizontalAccuracy = 5;
+    fixes[1].horizontalAccuracy = 7.5;
+    fixes[1].verticalAccuracy = 10;
+    const std::string path = temporaryPath("missing.ostrack");
+    writeTrack(path, fixes, 1024);
+
+    TrackFile file;
+    ASSERT_TRUE(file.open(path));
+    FixBuffer read;
+    ASSERT_TRUE(file.readAll(read));
+    ASSERT_EQ(read.size(), 2u);
+    EXPECT_TRUE(std::isnan(read[0].timestamp));
+    EXPECT_EQ(read[0].verticalAccuracy, -1);
+    EXPECT_EQ(read[1].timestamp, 1000);
+    EXPECT_EQ(read[1].altitude, 312.5);
+    EXPECT_EQ(read[1].horizontalAccuracy, 7.5);
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackFileTests, testItReadsTimeRangesAndBoxes) {
+    const FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    const std::string path = temporaryPath("lookup.ostrack");
+    writeTrack(path, fixes, 32);
+    TrackFile file;
+    ASSERT_TRUE(file.open(path));
+
+    const double start = fixes[100].timestamp, end = fixes[140].timestamp;
+    FixBuffer read;
+    ASSERT_TRUE(file.readTimeRange(start, end, read));
+    std::size_t expected = 0;
+    for (const Fix &fix : fixes) {
+        expected += fix.timestamp >= start && fix.timestamp <= end;
+    }
+    EXPECT_EQ(read.size(), expected);
+    for (const Fix &fix : read) {
+        EXPECT_GE(fix.timestamp, start);
+        EXPECT_LE(fix.timestamp, end);
+    }
+
+    read.clear();
+    const double south = 50.9375, north = 50.938, west = -1.471, east = -1.4703;
+    ASSERT_TRUE(file.readBoundingBox(south, west, north, east, read));
+    expected = 0;
+    for (const Fix &fix : fixes) {
+        expected += fix.latitude >= south && fix.latitude <= north && fix.longitude >= west && fix.longitude <= east;
+    }
+    EXPECT_GT(expected, 0u);
+    EXPECT_EQ(read.size(), expected);
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackFileTests, testItReadsTimeRangesAcrossBlockEdges) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    const std::string path = temporaryPath("edges.ostrack");
+    const auto countInRange = [&fixes](double start, double end) {
+        return static_cast<std::size_t>(std::count_if(fixes.begin(), fixes.end(), [=](const Fix &fix) { return fix.timestamp >= start && fix.timestamp <= end; }));
+    };
+    const auto checkRanges = [&](const TrackFile &file) {
+        for (std::size_t i = 0; i < fixes.size(); i += 7) {
+            for (std::size_t length : {std::size_t(0), std::size_t(1), std::size_t(15), std::size_t(16), std::size_t(100)}) {
+                const double start = fixes[i].timestamp, end = fixes[std::min(i + length, fixes.size() - 1)].timestamp;
+                FixBuffer read;
+                ASSERT_TRUE(file.readTimeRange(start, end, read));
+                EXPECT_EQ(read.size(), countInRange(start, end)) << i << " " << length;
+            }
+        }
+        FixBuffer read;
+        ASSERT_TRUE(file.readTimeRange(fixes.front().timestamp - 100, fixes.front().timestamp - 1, read));
+        ASSERT_TRUE(file.readTimeRange(fixes.back().timestamp + 1, fixes.back().timestamp + 100, read));
+        EXPECT_TRUE(read.empty());
+    };
+
+    writeTrack(path, fixes, 16);
+    TrackFile file;
+    ASSERT_TRUE(file.open(path));
+    checkRanges(file);
+
+    // Out of order blocks are scanned
+    std::swap(fixes[20], fixes[200]);
+    writeTrack(path, fixes, 16);
+    ASSERT_TRUE(file.open(path));
+    checkRanges(file);
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackFileTests, testItIsMuchSmallerThanGPX) {
+    const std::string path = temporaryPath("southampton.ostrack");
+    ASSERT_TRUE(convertGPXToTrackFile(fixturePath("Southampton-OS-route.gpx"), path));
+    TrackFile file;
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.pointCount(), 472u);
+    std::ifstream gpx(fixturePath("Southampton-OS-route.gpx"), std::ios::binary | std::ios::ate);
+    EXPECT_LT(file.fileSize() * 10, static_cast<std::size_t>(gpx.tellg()));
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackFileTests, testItRejectsBrokenFiles) {
+    const FixBuffer fixes = loadFixture("lake-district-trail.gpx");
+    const std::string path = temporaryPath("broken.ostrack");
+    writeTrack(path, fixes, 8);
+
+    std::string contents;
+    {
+        std::ifstream in(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    TrackFile file;
+    for (std::size_t length : {std::size_t(0), std::size_t(16), contents.size() - 1}) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), static_cast<std::streamsize>(length));
+        EXPECT_FALSE(file.open(path)) << length;
+    }
+    std::string badMagic = contents;
+    badMagic[0] = 'X';
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << badMagic;
+    EXPECT_FALSE(file.open(path));
+
+    // A block claiming more points than its bytes can hold, with the total
+    // in the header to match
+    std::string inflated = contents;
+    std::uint64_t pointCount, indexOffset;
+    std::uint32_t blockPoints;
+    std::memcpy(&pointCount, &inflated[16], sizeof(pointCount));
+    std::memcpy(&indexOffset, &inflated[24], sizeof(indexOffset));
+    std::memcpy(&blockPoints, &inflated[indexOffset + 12], sizeof(blockPoints));
+    pointCount += 100000000 - blockPoints;
+    blockPoints = 100000000;
+    std::memcpy(&inflated[16], &pointCount, sizeof(pointCount));
+    std::memcpy(&inflated[indexOffset + 12], &blockPoints, sizeof(blockPoints));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << inflated;
+    EXPECT_FALSE(file.open(path));
+    EXPECT_FALSE(file.open(temporaryPath("missing-file.ostrack")));
+    std::remove(path.c_str());
+}
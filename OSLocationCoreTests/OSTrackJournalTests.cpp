@@ -0,0 +1,301 @@
+//
+//  OSTrackJournalTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSTrackJournal.h"
+
+#include <gtest/gtest.h>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace oslocation;
+using oslocation::testing::NoiseSource;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+std::string temporaryPath(const char *name) {
+    return ::testing::TempDir() + name;
+}
+
+std::string readContents(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeContents(const std::string &path, const std::string &contents) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+/**
+ *  Fix number `i` of a made up track, so recovered fixes can be checked
+ *  against their position in the journal
+ */
+Fix numberedFix(std::uint64_t i) {
+    Fix fix = makeFix(static_cast<double>(i), 50 + static_cast<double>(i) * 1e-6, -1.4, 10);
+    fix.horizontalAccuracy = 5;
+    fix.verticalAccuracy = 3;
+    return fix;
+}
+
+void writeNumberedJournal(const std::string &path, std::uint64_t count) {
+    std::remove(path.c_str());
+    VirtualClock clock;
+    TrackJournalWriter writer(clock);
+    ASSERT_TRUE(writer.open(path));
+    for (std::uint64_t i = 0; i < count; i++) {
+        ASSERT_TRUE(writer.append(numberedFix(i)));
+    }
+    ASSERT_TRUE(writer.close());
+}
+
+} // namespace
+
+TEST(OSTrackJournalTests, testItChecksumsWithCRC32C) {
+    EXPECT_EQ(journal::crc32c("123456789", 9), 0xe3069283u);
+    EXPECT_EQ(journal::crc32c("56789", 5, journal::crc32c("1234", 4)), 0xe3069283u);
+
+    JournalRecord record = journal::encode(numberedFix(7));
+    Fix fix;
+    ASSERT_TRUE(journal::decode(record, fix));
+    EXPECT_EQ(fix.timestamp, 7);
+    record.latitude += 1e-9;
+    EXPECT_FALSE(journal::decode(record, fix));
+    const JournalRecord zeroes = {};
+    EXPECT_FALSE(journal::decode(zeroes, fix));
+}
+
+TEST(OSTrackJournalTests, testItRoundTripsAndCarriesOnAppending) {
+    const FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    const std::string path = temporaryPath("round-trip.osjournal");
+    std::remove(path.c_str());
+
+    VirtualClock clock;
+    {
+        TrackJournalWriter writer(clock);
+        ASSERT_TRUE(writer.open(path));
+        for (std::size_t i = 0; i < 100; i++) {
+            ASSERT_TRUE(writer.append(fixes[i]));
+        }
+    }
+    FixBuffer recovered;
+    TrackJournalWriter writer(clock);
+    ASSERT_TRUE(writer.open(path, &recovered));
+    EXPECT_EQ(writer.recovery().recordCount, 100u);
+    EXPECT_EQ(writer.recordCount(), 100u);
+    for (std::size_t i = 100; i < fixes.size(); i++) {
+        ASSERT_TRUE(writer.append(fixes[i]));
+    }
+    ASSERT_TRUE(writer.close());
+
+    recovered.clear();
+    JournalRecovery recovery;
+    ASSERT_TRUE(recoverTrackJournal(path, &recovered, recovery));
+    EXPECT_EQ(recovery.truncatedBytes, 0u);
+    ASSERT_EQ(recovered.size(), fixes.size());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        EXPECT_EQ(recovered[i].timestamp, fixes[i].timestamp);
+        EXPECT_EQ(recovered[i].latitude, fixes[i].latitude);
+        EXPECT_EQ(recovered[i].longitude, fixes[i].longitude);
+        EXPECT_NEAR(recovered[i].altitude, fixes[i].altitude, 1e-4);
+        EXPECT_EQ(recovered[i].horizontalAccuracy, fixes[i].horizontalAccuracy);
+        EXPECT_EQ(recovered[i].sourceIndex, static_cast<std::int32_t>(i));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackJournalTests, testItGroupsWritesAndSyncsOnItsInterval) {
+    const std::string path = temporaryPath("group-commit.osjournal");
+    std::remove(path.c_str());
+    VirtualClock clock;
+    TrackJournalOptions options;
+    options.maximumBatch = 4;
+    options.commitInterval = 1;
+    options.syncInterval = 5;
+    TrackJournalWriter writer(clock, options);
+    ASSERT_TRUE(writer.open(path));
+
+    // Held until the batch is full
+    for (std::uint64_t i = 0; i < 3; i++) {
+        writer.append(numberedFix(i));
+    }
+    EXPECT_EQ(writer.pendingCount(), 3u);
+    EXPECT_EQ(readContents(path).size(), journal::kHeaderSize);
+    writer.append(numberedFix(3));
+    EXPECT_EQ(writer.writeCount(), 1u);
+    EXPECT_EQ(readContents(path).size(), journal::kHeaderSize + 4 * sizeof(JournalRecord));
+    EXPECT_EQ(writer.syncCount(), 0u);
+
+    // Or until the oldest has waited the commit interval
+    clock.advance(2);
+    writer.append(numberedFix(4));
+    clock.advance(1.5);
+    writer.append(numberedFix(5));
+    EXPECT_EQ(writer.writeCount(), 2u);
+    EXPECT_EQ(writer.pendingCount(), 0u);
+    EXPECT_EQ(writer.syncCount(), 0u);
+
+    // Synced at the first commit after the sync interval
+    clock.advance(2);
+    writer.append(numberedFix(6));
+    EXPECT_TRUE(writer.commit());
+    EXPECT_EQ(writer.syncCount(), 1u);
+    EXPECT_TRUE(writer.commit());
+    EXPECT_EQ(writer.writeCount(), 3u);
+    EXPECT_EQ(writer.syncCount(), 1u);
+    EXPECT_EQ(writer.recordCount(), 7u);
+    EXPECT_TRUE(writer.close());
+    EXPECT_FALSE(writer.append(numberedFix(7)));
+
+    options.syncInterval = 0;
+    TrackJournalWriter eager(clock, options);
+    ASSERT_TRUE(eager.open(path));
+    for (std::uint64_t i = 7; i < 15; i++) {
+        eager.append(numberedFix(i));
+    }
+    EXPECT_EQ(eager.writeCount(), 2u);
+    EXPECT_EQ(eager.syncCount(), 2u);
+    EXPECT_TRUE(eager.close());
+    std::remove(path.c_str());
+}
+
+TEST(OSTrackJournalTests, testItTruncatesATornTail) {
+    const std::string path = temporaryPath("torn.osjournal");
+    writeNumberedJournal(path, 10);
+    const std::string contents = readContents(path);
+    ASSERT_EQ(contents.size(), journal::kHeaderSize + 10 * sizeof(JournalRecord));
+
+    // Cut anywhere in the last two records
+    for (std::size_t cut = 1; cut <= 2 * sizeof(JournalRecord); cut++) {
+        const std::size_t length = contents.size() - cut;
+        writeContents(path, contents.substr(0, length));
+        const std::uint64_t intact = (length - journal::kHeaderSize) / sizeof(JournalRecord);
+        FixBuffer fixes;
+        JournalRecovery recovery;
+        ASSERT_TRUE(recoverTrackJournal(path, &fixes, recovery)) << cut;
+        EXPECT_EQ(recovery.recordCount, intact) << cut;
+        EXPECT_EQ(fixes.size(), intact) << cut;
+        EXPECT_EQ(recovery.truncatedBytes, length - journal::kHeaderSize - intact * sizeof(JournalRecord)) << cut;
+        EXPECT_EQ(readContents(path).size(), journal::kHeaderSize + intact * sizeof(JournalRecord)) << cut;
+    }
+
+    // A corrupt record ends the journal, as does space the file system
+    // filled with zeroes
+    std::string corrupt = contents;
+    corrupt[journal::kHeaderSize + 6 * sizeof(JournalRecord) + 9] ^= 0x10;
+    writeContents(path, corrupt);
+    JournalRecovery recovery;
+    ASSERT_TRUE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(recovery.recordCount, 6u);
+    EXPECT_EQ(recovery.truncatedBytes, 4 * sizeof(JournalRecord));
+    writeContents(path, contents + std::string(3 * sizeof(JournalRecord), '\0'));
+    ASSERT_TRUE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(recovery.recordCount, 10u);
+    EXPECT_EQ(recovery.truncatedBytes, 3 * sizeof(JournalRecord));
+
+    // Killed while writing the header
+    writeContents(path, contents.substr(0, 5));
+    ASSERT_TRUE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(recovery.recordCount, 0u);
+    EXPECT_EQ(readContents(path), contents.substr(0, journal::kHeaderSize));
+    writeContents(path, "");
+    ASSERT_TRUE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(readContents(path), contents.substr(0, journal::kHeaderSize));
+
+    // A short file that is not the start of a journal is left alone
+    writeContents(path, "OSJRX");
+    EXPECT_FALSE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(readContents(path), "OSJRX");
+    std::string wrongVersion = contents.substr(0, journal::kHeaderSize - 2);
+    wrongVersion[8] ^= 1;
+    writeContents(path, wrongVersion);
+    EXPECT_FALSE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(readContents(path), wrongVersion);
+
+    // Anything else is left alone
+    std::string other = contents;
+    other[0] = 'X';
+    writeContents(path, other);
+    EXPECT_FALSE(recoverTrackJournal(path, nullptr, recovery));
+    EXPECT_EQ(readContents(path), other);
+    std::remove(path.c_str());
+}
+
+/**
+ *  Kills a process appending to the journal at random moments, then checks
+ *  every committed record survived intact and the journal carries on
+ */
+TEST(OSTrackJournalTests, testItSurvivesBeingKilled) {
+    const std::string path = temporaryPath("killed.osjournal");
+    std::remove(path.c_str());
+    NoiseSource noise(24);
+    std::uint64_t expected = 0;
+    for (int round = 0; round < 20; round++) {
+        int committed[2];
+        ASSERT_EQ(pipe(committed), 0);
+        const pid_t child = fork();
+        ASSERT_GE(child, 0);
+        if (child == 0) {
+            ::close(committed[0]);
+            SystemClock clock;
+            TrackJournalOptions options;
+            options.maximumBatch = 1 + round % 16;
+            options.commitInterval = 0.001;
+            options.syncInterval = -1;
+            TrackJournalWriter writer(clock, options);
+            FixBuffer recovered;
+            if (!writer.open(path, &recovered)) {
+                _exit(1);
+            }
+            for (std::uint64_t i = recovered.size(); i < recovered.size() + 10000000; i++) {
+                const std::uint64_t writes = writer.writeCount();
+                if (!writer.append(numberedFix(i))) {
+                    _exit(1);
+                }
+                if (writer.writeCount() != writes) {
+                    const std::uint64_t written = writer.recordCount() - writer.pendingCount();
+                    if (write(committed[1], &written, sizeof(written)) != sizeof(written)) {
+                        _exit(1);
+                    }
+                }
+            }
+            _exit(0);
+        }
+        ::close(committed[1]);
+        usleep(static_cast<useconds_t>(1000 + noise.uniform() * 20000));
+        kill(child, SIGKILL);
+        int status = 0;
+        ASSERT_EQ(waitpid(child, &status, 0), child);
+        ASSERT_TRUE(WIFSIGNALED(status)) << "the writer stopped early in round " << round;
+
+        std::uint64_t written = 0, reported = expected;
+        while (read(committed[0], &written, sizeof(written)) == sizeof(written)) {
+            reported = written;
+        }
+        ::close(committed[0]);
+
+        FixBuffer fixes;
+        JournalRecovery recovery;
+        ASSERT_TRUE(recoverTrackJournal(path, &fixes, recovery)) << round;
+        ASSERT_GE(fixes.size(), reported) << round;
+        ASSERT_GE(fixes.size(), expected) << round;
+        for (std::size_t i = 0; i < fixes.size(); i++) {
+            const Fix fix = numberedFix(i);
+            ASSERT_EQ(fixes[i].timestamp, fix.timestamp) << round;
+            ASSERT_EQ(fixes[i].latitude, fix.latitude) << round;
+        }
+        expected = fixes.size();
+    }
+    EXPECT_GT(expected, 0u);
+    std::remove(path.c_str());
+}
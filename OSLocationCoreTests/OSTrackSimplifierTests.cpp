@@ -0,0 +1,166 @@
+//
+//  OSTrackSimplifierTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSTrackSimplifier.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+const char *const kFixtures[] = {"Southampton-OS-route.gpx", "lake-district-trail.gpx"};
+
+/**
+ *  Finds the kept fixes in the original track by walking both in order
+ */
+std::vector<std::size_t> matchIndices(const FixBuffer &track, const FixBuffer &kept) {
+    std::vector<std::size_t> indices;
+    std::size_t i = 0;
+    for (const Fix &fix : kept) {
+        while (i < track.size() && !(track[i].timestamp == fix.timestamp && track[i].latitude == fix.latitude && track[i].longitude == fix.longitude)) {
+            i++;
+        }
+        EXPECT_LT(i, track.size());
+        indices.push_back(i++);
+    }
+    return indices;
+}
+
+/**
+ *  Largest distance of any original fix from the simplified segment that
+ *  replaces it
+ */
+double maximumDeviation(const FixBuffer &track, const std::vector<std::size_t> &kept) {
+    double worst = 0;
+    for (std::size_t k = 0; k + 1 < kept.size(); k++) {
+        const Fix &a = track[kept[k]];
+        const LocalFrame frame(a.latitude, a.longitude);
+        double bx, by;
+        frame.toLocal(track[kept[k + 1]].latitude, track[kept[k + 1]].longitude, bx, by);
+        for (std::size_t i = kept[k] + 1; i < kept[k + 1]; i++) {
+            double x, y;
+            frame.toLocal(track[i].latitude, track[i].longitude, x, y);
+            const double lengthSquared = bx * bx + by * by;
+            const double t = lengthSquared > 0 ? std::min(1.0, std::max(0.0, (x * bx + y * by) / lengthSquared)) : 0;
+            worst = std::max(worst, std::hypot(x - t * bx, y - t * by));
+        }
+    }
+    return worst;
+}
+
+FixBuffer simplifyOnline(const FixBuffer &track, double tolerance, std::size_t batchSize) {
+    TrackSimplifier simplifier(tolerance);
+    FixBuffer output;
+    for (std::size_t i = 0; i < track.size(); i += batchSize) {
+        FixBuffer batch(track.begin() + i, track.begin() + std::min(i + batchSize, track.size()));
+        simplifier.process(batch);
+        output.insert(output.end(), batch.begin(), batch.end());
+    }
+    simplifier.flush(output);
+    return output;
+}
+
+} // namespace
+
+TEST(OSTrackSimplifierTests, testAStraightLineKeepsOnlyItsEnds) {
+    FixBuffer line;
+    for (int i = 0; i < 100; i++) {
+        line.push_back(makeFix(i, 50.9 + i * 1e-5, -1.4 + i * 1e-5));
+    }
+    const FixBuffer online = simplifyOnline(line, 1, 7);
+    ASSERT_EQ(online.size(), 2u);
+    EXPECT_EQ(online.front().timestamp, 0);
+    EXPECT_EQ(online.back().timestamp, 99);
+    EXPECT_EQ(simplifyTrack(line, 1), (std::vector<std::size_t>{0, 99}));
+}
+
+TEST(OSTrackSimplifierTests, testOnlineSimplificationStaysWithinTheTolerance) {
+    for (const char *name : kFixtures) {
+        const FixBuffer track = loadFixture(name);
+        for (double tolerance : {2.0, 5.0, 10.0}) {
+            const FixBuffer kept = simplifyOnline(track, tolerance, 1);
+            const std::vector<std::size_t> indices = matchIndices(track, kept);
+            EXPECT_EQ(indices.front(), 0u);
+            EXPECT_EQ(indices.back(), track.size() - 1);
+            EXPECT_LE(maximumDeviation(track, indices), tolerance + 1e-6) << name;
+            EXPECT_LE(kept.size(), track.size()) << name;
+        }
+    }
+    // The lake district trail is already sparse; the Southampton recording
+    // is dense
+    const FixBuffer southampton = loadFixture("Southampton-OS-route.gpx");
+    EXPECT_LT(simplifyOnline(southampton, 5, 1).size(), southampton.size() / 2);
+}
+
+TEST(OSTrackSimplifierTests, testOnlineSimplificationDoesNotDependOnBatching) {
+    const FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    const FixBuffer single = simplifyOnline(track, 5, track.size());
+    for (std::size_t batchSize : {1u, 3u, 50u}) {
+        const FixBuffer batched = simplifyOnline(track, 5, batchSize);
+        ASSERT_EQ(batched.size(), single.size());
+        for (std::size_t i = 0; i < single.size(); i++) {
+            EXPECT_EQ(batched[i].timestamp, single[i].timestamp);
+            EXPECT_EQ(batched[i].latitude, single[i].latitude);
+        }
+    }
+}
+
+TEST(OSTrackSimplifierTests, testHeldFixesLoseTheirSourceIndex) {
+    const FixBuffer track = loadFixture("Southampton-OS-route.gpx");
+    TrackSimplifier simplifier(5);
+    for (std::size_t i = 0; i < track.size(); i += 10) {
+        FixBuffer batch(track.begin() + i, track.begin() + std::min(i + 10, track.size()));
+        for (Fix &fix : batch) {
+            fix.sourceIndex -= static_cast<std::int32_t>(i);
+        }
+        const FixBuffer input = batch;
+        simplifier.process(batch);
+        for (const Fix &fix : batch) {
+            if (fix.sourceIndex >= 0) {
+                EXPECT_EQ(input[fix.sourceIndex].timestamp, fix.timestamp);
+            }
+        }
+    }
+}
+
+TEST(OSTrackSimplifierTests, testBatchSimplificationStaysWithinTheTolerance) {
+    for (const char *name : kFixtures) {
+        const FixBuffer track = loadFixture(name);
+        for (double tolerance : {2.0, 5.0, 10.0}) {
+            const std::vector<std::size_t> kept = simplifyTrack(track, tolerance);
+            EXPECT_EQ(kept.front(), 0u);
+            EXPECT_EQ(kept.back(), track.size() - 1);
+            EXPECT_TRUE(std::is_sorted(kept.begin(), kept.end()));
+            EXPECT_LE(maximumDeviation(track, kept), tolerance) << name;
+            EXPECT_LE(kept.size(), track.size()) << name;
+        }
+    }
+    const FixBuffer southampton = loadFixture("Southampton-OS-route.gpx");
+    EXPECT_LT(simplifyTrack(southampton, 5).size(), southampton.size() / 2);
+}
+
+TEST(OSTrackSimplifierTests, testParallelBatchSimplificationMatchesSerial) {
+    // Long enough to be cut into several runs
+    const FixBuffer fixture = loadFixture("Southampton-OS-route.gpx");
+    FixBuffer track;
+    for (int repeat = 0; repeat < 60; repeat++) {
+        for (Fix fix : fixture) {
+            fix.latitude += repeat * 0.01;
+            track.push_back(fix);
+        }
+    }
+    const std::vector<std::size_t> serial = simplifyTrack(track, 5, 1);
+    EXPECT_LE(maximumDeviation(track, serial), 5);
+    EXPECT_EQ(simplifyTrack(track, 5, 4), serial);
+    EXPECT_EQ(simplifyTrack(track, 5, 0), serial);
+}
@@ -0,0 +1,222 @@
+//
+//  OSTrackStatisticsTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSTrackStatistics.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace oslocation;
+using oslocation::testing::distance;
+using oslocation::testing::loadFixture;
+using oslocation::testing::makeJourney;
+
+namespace {
+
+struct BatchResult {
+    TrackSummary summary;
+    std::vector<TrackSplit> splits;
+};
+
+/**
+ *  Recomputes everything from the whole track in one pass, the way a
+ *  consumer walking the recorded array would
+ */
+BatchResult recompute(const FixBuffer &track, const TrackStatisticsOptions &options) {
+    BatchResult result;
+    std::vector<double> cumulative(track.size(), 0);
+    std::vector<double> cumulativeMoving(track.size(), 0);
+    for (std::size_t i = 1; i < track.size(); i++) {
+        const double leg = distance(track[i - 1], track[i]);
+        const double dt = std::max(0.0, track[i].timestamp - track[i - 1].timestamp);
+        const bool moving = dt > 0 && dt <= options.maximumGap && leg / dt >= options.movingSpeed;
+        cumulative[i] = cumulative[i - 1] + leg;
+        cumulativeMoving[i] = cumulativeMoving[i - 1] + (moving ? dt : 0);
+        result.summary.elapsedTime += dt;
+    }
+    result.summary.distance = cumulative.back();
+    result.summary.movingTime = cumulativeMoving.back();
+    result.summary.fixCount = track.size();
+
+    double anchor = track.front().altitude;
+    for (const Fix &fix : track) {
+        if (std::fabs(fix.altitude - anchor) >= options.climbThreshold) {
+            (fix.altitude > anchor ? result.summary.ascent : result.summary.descent) += std::fabs(fix.altitude - anchor);
+            anchor = fix.altitude;
+        }
+    }
+
+    for (std::uint32_t number = 1; number * options.splitDistance <= result.summary.distance; number++) {
+        const double boundary = number * options.splitDistance;
+        const std::size_t i = std::lower_bound(cumulative.begin(), cumulative.end(), boundary) - cumulative.begin();
+        const double fraction = (boundary - cumulative[i - 1]) / (cumulative[i] - cumulative[i - 1]);
+        TrackSplit split{};
+        split.number = number;
+        split.distance = boundary;
+        split.timestamp = track[i - 1].timestamp + fraction * (track[i].timestamp - track[i - 1].timestamp);
+        split.movingTime = cumulativeMoving[i - 1] + fraction * (cumulativeMoving[i] - cumulativeMoving[i - 1]);
+        result.splits.push_back(split);
+    }
+    for (std::size_t i = result.splits.size(); i-- > 1;) {
+        result.splits[i].movingTime -= result.splits[i - 1].movingTime;
+    }
+    return result;
+}
+
+Fix fixAtAltitude(double timestamp, double north, double altitude) {
+    const LocalFrame frame(50.9375, -1.47);
+    Fix fix = makeFix(timestamp, 0, 0, altitude);
+    frame.toGeodetic(0, north, fix.latitude, fix.longitude);
+    fix.horizontalAccuracy = 5;
+    fix.verticalAccuracy = 10;
+    return fix;
+}
+
+} // namespace
+
+TEST(OSTrackStatisticsTests, testItMatchesABatchRecomputationOfTheFixtures) {
+    for (const char *name : {"Southampton-OS-route.gpx", "lake-district-trail.gpx"}) {
+        SCOPED_TRACE(name);
+        const FixBuffer track = loadFixture(name);
+        TrackStatisticsOptions options;
+        options.splitDistance = 250;
+        const BatchResult expected = recompute(track, options);
+
+        TrackStatistics statistics(options);
+        TrackStatisticsStage stage(statistics);
+        // Uneven batches, as core location delivers them
+        for (std::size_t i = 0, batch = 1; i < track.size(); i += batch, batch = batch % 7 + 1) {
+            FixBuffer fixes(track.begin() + i, track.begin() + std::min(track.size(), i + batch));
+            stage.process(fixes);
+            EXPECT_EQ(fixes.size(), std::min(batch, track.size() - i));
+        }
+
+        const TrackSummary &summary = statistics.summary();
+        // The batch takes each leg in a frame at its first fix rather than at
+        // the mean latitude, which differs by about a part in a million
+        EXPECT_NEAR(summary.distance, expected.summary.distance, expected.summary.distance * 1e-5);
+        EXPECT_DOUBLE_EQ(summary.ascent, expected.summary.ascent);
+        EXPECT_DOUBLE_EQ(summary.descent, expected.summary.descent);
+        EXPECT_DOUBLE_EQ(summary.elapsedTime, expected.summary.elapsedTime);
+        EXPECT_DOUBLE_EQ(summary.movingTime, expected.summary.movingTime);
+        EXPECT_EQ(summary.fixCount, expected.summary.fixCount);
+
+        ASSERT_EQ(stage.splits().size(), expected.splits.size());
+        ASSERT_FALSE(expected.splits.empty());
+        for (std::size_t i = 0; i < expected.splits.size(); i++) {
+            EXPECT_EQ(stage.splits()[i].number, expected.splits[i].number);
+            EXPECT_NEAR(stage.splits()[i].timestamp, expected.splits[i].timestamp, 0.01);
+            EXPECT_NEAR(stage.splits()[i].movingTime, expected.splits[i].movingTime, 0.01);
+        }
+    }
+}
+
+TEST(OSTrackStatisticsTests, testItReportsSplitsWithTheirPace) {
+    // 2 m/s for 1200 s, then 4 m/s
+    const FixBuffer journey = makeJourney({{1200, 2}, {600, 4}});
+    TrackStatisticsOptions options;
+    options.splitDistance = kMetresPerKilometre;
+    TrackStatistics statistics(options);
+    std::vector<TrackSplit> splits;
+    for (const Fix &fix : journey) {
+        statistics.add(fix, splits);
+    }
+    ASSERT_EQ(splits.size(), 4u);
+    EXPECT_NEAR(splits[0].timestamp, 1500, 0.01);
+    EXPECT_NEAR(splits[0].elapsedTime, 500, 0.01);
+    EXPECT_NEAR(splits[1].elapsedTime, 500, 0.01);
+    // The third split straddles the change of pace: 400 m at 2 m/s, 600 m at 4 m/s
+    EXPECT_NEAR(splits[2].elapsedTime, 200 + 150, 0.5);
+    EXPECT_NEAR(splits[3].elapsedTime, 250, 0.5);
+    EXPECT_NEAR(statistics.summary().pace(), statistics.summary().movingTime / statistics.summary().distance * 1000, 1e-9);
+
+    options.splitDistance = kMetresPerMile;
+    TrackStatistics miles(options);
+    splits.clear();
+    for (const Fix &fix : journey) {
+        miles.add(fix, splits);
+    }
+    ASSERT_EQ(splits.size(), 2u);
+    EXPECT_DOUBLE_EQ(splits[1].distance, 2 * kMetresPerMile);
+}
+
+TEST(OSTrackStatisticsTests, testItCompletesEverySplitALongLegCrosses) {
+    TrackStatistics statistics;
+    std::vector<TrackSplit> splits;
+    statistics.add(fixAtAltitude(0, 0, 0), splits);
+    statistics.add(fixAtAltitude(1000, 3500, 0), splits);
+    ASSERT_EQ(splits.size(), 3u);
+    EXPECT_NEAR(splits[2].timestamp, 3000.0 / 3.5, 0.01);
+    EXPECT_NEAR(splits[1].elapsedTime, 1000 / 3.5, 0.01);
+}
+
+TEST(OSTrackStatisticsTests, testItIgnoresAltitudeNoiseInsideTheThreshold) {
+    TrackStatistics statistics;
+    std::vector<TrackSplit> splits;
+    double timestamp = 0;
+    for (int i = 0; i < 100; i++) {
+        statistics.add(fixAtAltitude(timestamp++, i, i % 2 ? 102 : 98), splits);
+    }
+    EXPECT_EQ(statistics.summary().ascent, 0);
+    EXPECT_EQ(statistics.summary().descent, 0);
+
+    // A 20 m climb in 1 m steps, then 12 m down
+    for (int i = 0; i <= 20; i++) {
+        statistics.add(fixAtAltitude(timestamp++, 100 + i, 98 + i), splits);
+    }
+    for (int i = 1; i <= 12; i++) {
+        statistics.add(fixAtAltitude(timestamp++, 130 + i, 118 - i), splits);
+    }
+    EXPECT_DOUBLE_EQ(statistics.summary().ascent, 20);
+    EXPECT_DOUBLE_EQ(statistics.summary().descent, 10);
+
+    Fix unknown = fixAtAltitude(timestamp++, 150, 0);
+    unknown.verticalAccuracy = -1;
+    statistics.add(unknown, splits);
+    EXPECT_DOUBLE_EQ(statistics.summary().descent, 10);
+}
+
+TEST(OSTrackStatisticsTests, testItSeparatesMovingFromElapsedTime) {
+    // 100 s walking, 100 s stood still, 100 s walking
+    const FixBuffer journey = makeJourney({{100, 1.5}, {100, 0}, {100, 1.5}});
+    TrackStatistics statistics;
+    std::vector<TrackSplit> splits;
+    for (const Fix &fix : journey) {
+        statistics.add(fix, splits);
+    }
+    EXPECT_DOUBLE_EQ(statistics.summary().elapsedTime, 299);
+    EXPECT_DOUBLE_EQ(statistics.summary().movingTime, 199);
+    EXPECT_NEAR(statistics.summary().movingSpeed(), 1.5, 0.01);
+
+    // A long gap adds distance but not moving time
+    Fix later = journey.back();
+    later.timestamp += 600;
+    later.latitude += 0.01;
+    statistics.add(later, splits);
+    EXPECT_DOUBLE_EQ(statistics.summary().movingTime, 199);
+    EXPECT_GT(statistics.summary().distance, 1000);
+}
+
+TEST(OSTrackStatisticsTests, testItStartsANewSegmentWithoutALeg) {
+    TrackStatistics statistics;
+    TrackStatisticsStage stage(statistics);
+    FixBuffer first = {fixAtAltitude(0, 0, 0), fixAtAltitude(10, 20, 0)};
+    stage.process(first);
+    stage.reset();
+    FixBuffer second = {fixAtAltitude(100, 520, 0), fixAtAltitude(110, 540, 0)};
+    stage.process(second);
+    EXPECT_NEAR(statistics.summary().distance, 40, 1e-3);
+    EXPECT_DOUBLE_EQ(statistics.summary().elapsedTime, 20);
+    EXPECT_EQ(statistics.summary().fixCount, 4u);
+
+    statistics.reset();
+    EXPECT_EQ(statistics.summary().distance, 0);
+    EXPECT_EQ(statistics.summary().fixCount, 0u);
+}
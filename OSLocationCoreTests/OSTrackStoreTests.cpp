@@ -0,0 +1,111 @@
+//
+//  OSTrackStoreTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSGeodesic.h"
+#include "OSTrackStore.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+/**
+ *  The fixture repeated until it has `count` points, with timestamps
+ *  carried on
+ */
+FixBuffer longTrack(std::size_t count) {
+    const FixBuffer fixture = loadFixture("Southampton-OS-route.gpx");
+    FixBuffer fixes(count);
+    for (std::size_t i = 0; i < count; i++) {
+        fixes[i] = fixture[i % fixture.size()];
+        fixes[i].timestamp += static_cast<double>(i / fixture.size()) * 1000;
+        fixes[i].speed = static_cast<double>(i % 20);
+        fixes[i].course = i % 3 ? static_cast<double>(i % 360) : -1;
+    }
+    return fixes;
+}
+
+} // namespace
+
+TEST(OSTrackStoreTests, testItRoundTripsFixesToFloatPrecision) {
+    const FixBuffer fixes = longTrack(1000);
+    TrackStore store;
+    store.append(fixes);
+    ASSERT_EQ(store.size(), fixes.size());
+    for (std::size_t i = 0; i < fixes.size(); i++) {
+        const Fix fix = store[i];
+        EXPECT_EQ(fix.timestamp, fixes[i].timestamp);
+        EXPECT_EQ(fix.latitude, fixes[i].latitude);
+        EXPECT_EQ(fix.longitude, fixes[i].longitude);
+        EXPECT_NEAR(fix.altitude, fixes[i].altitude, 1e-4);
+        EXPECT_EQ(fix.horizontalAccuracy, fixes[i].horizontalAccuracy);
+        EXPECT_EQ(fix.verticalAccuracy, fixes[i].verticalAccuracy);
+        EXPECT_EQ(fix.speed, fixes[i].speed);
+        EXPECT_EQ(fix.course, fixes[i].course);
+        EXPECT_EQ(fix.sourceIndex, static_cast<std::int32_t>(i));
+        EXPECT_FALSE(hasGridPosition(fix));
+    }
+}
+
+TEST(OSTrackStoreTests, testItGrowsWithoutMovingPoints) {
+    const FixBuffer fixes = longTrack(3 * kTrackChunkSize + 100);
+    TrackStore store;
+    store.append(fixes[0]);
+    const TrackView first = store.view();
+    const double *latitudes = first.chunk(0).latitudes;
+    for (std::size_t i = 1; i < fixes.size(); i++) {
+        store.append(fixes[i]);
+    }
+    EXPECT_EQ(store.view().chunk(0).latitudes, latitudes);
+    EXPECT_EQ(store.capacityBytes(), 4 * kTrackChunkSize * 44);
+
+    // Views keep the size they were taken at
+    EXPECT_EQ(first.size(), 1u);
+    EXPECT_EQ(first.chunkCount(), 1u);
+    EXPECT_EQ(first.chunk(0).count, 1u);
+    EXPECT_EQ(first[0].latitude, fixes[0].latitude);
+
+    const TrackView all = store.view();
+    ASSERT_EQ(all.chunkCount(), 4u);
+    EXPECT_EQ(all.chunk(3).count, 100u);
+    EXPECT_EQ(all.chunk(3).latitudes[99], fixes.back().latitude);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.capacityBytes(), 0u);
+}
+
+TEST(OSTrackStoreTests, testItsChunksCanBeScannedAsArrays) {
+    const FixBuffer fixes = longTrack(2 * kTrackChunkSize + 10);
+    TrackStore store;
+    store.append(fixes);
+
+    // Distance along the track, chunk by chunk plus the step between chunks
+    double expected = 0, distance = 0;
+    for (std::size_t i = 1; i < fixes.size(); i++) {
+        expected += distanceBetween(fixes[i - 1].latitude, fixes[i - 1].longitude, fixes[i].latitude, fixes[i].longitude);
+    }
+    const TrackView view = store.view();
+    std::vector<double> distances(kTrackChunkSize);
+    for (std::size_t c = 0; c < view.chunkCount(); c++) {
+        const TrackColumns columns = view.chunk(c);
+        if (c > 0) {
+            const TrackColumns previous = view.chunk(c - 1);
+            distance += distanceBetween(previous.latitudes[previous.count - 1], previous.longitudes[previous.count - 1], columns.latitudes[0], columns.longitudes[0]);
+        }
+        consecutiveDistances(columns.latitudes, columns.longitudes, columns.count, distances.data());
+        for (std::size_t i = 0; i + 1 < columns.count; i++) {
+            distance += distances[i];
+        }
+    }
+    EXPECT_NEAR(distance, expected, 1e-6 * expected);
+}
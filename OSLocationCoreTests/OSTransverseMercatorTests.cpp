@@ -0,0 +1,93 @@
+//
+//  OSTransverseMercatorTests.cpp
+//  OSLocationCoreTests
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSFixtures.h"
+#include "OSTransverseMercator.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace oslocation;
+using oslocation::testing::loadFixture;
+
+namespace {
+
+const simd::Level kLevels[] = {simd::Level::Scalar, simd::Level::NEON, simd::Level::AVX2};
+
+double degrees(double d, double m, double s) {
+    return d + m / 60 + s / 3600;
+}
+
+} // namespace
+
+TEST(OSTransverseMercatorTests, testItReproducesTheWorkedExampleFromTheGuide) {
+    // "A guide to coordinate systems in Great Britain", annex C.1
+    const double latitude = degrees(52, 39, 27.2531);
+    const double longitude = degrees(1, 43, 4.5177);
+    double easting, northing;
+    projectTransverseMercator(nationalGridProjection(kAiry1830), latitude, longitude, easting, northing);
+    EXPECT_NEAR(easting, 651409.903, 0.0005);
+    EXPECT_NEAR(northing, 313177.270, 0.0005);
+
+    for (simd::Level level : kLevels) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        std::vector<double> latitudes(9, latitude), longitudes(9, longitude), eastings(9), northings(9);
+        projectTransverseMercator(nationalGridProjection(kAiry1830), latitudes.data(), longitudes.data(), 9, eastings.data(), northings.data(), level);
+        for (std::size_t i = 0; i < 9; i++) {
+            EXPECT_NEAR(eastings[i], 651409.903, 0.0005) << simd::name(level);
+            EXPECT_NEAR(northings[i], 313177.270, 0.0005) << simd::name(level);
+        }
+    }
+}
+
+TEST(OSTransverseMercatorTests, testTheBatchKernelsMatchTheReferenceAcrossGreatBritain) {
+    std::vector<double> latitudes, longitudes;
+    for (double latitude = 49.5; latitude <= 61; latitude += 0.25) {
+        for (double longitude = -8.5; longitude <= 2; longitude += 0.25) {
+            latitudes.push_back(latitude);
+            longitudes.push_back(longitude);
+        }
+    }
+    const TransverseMercator projection = nationalGridProjection(kGRS80);
+    for (simd::Level level : kLevels) {
+        if (!simd::isSupported(level)) {
+            continue;
+        }
+        std::vector<double> eastings(latitudes.size()), northings(latitudes.size());
+        projectTransverseMercator(projection, latitudes.data(), longitudes.data(), latitudes.size(), eastings.data(), northings.data(), level);
+        for (std::size_t i = 0; i < latitudes.size(); i++) {
+            double easting, northing;
+            projectTransverseMercator(projection, latitudes[i], longitudes[i], easting, northing);
+            ASSERT_NEAR(eastings[i], easting, 1e-6) << simd::name(level) << " " << latitudes[i] << "," << longitudes[i];
+            ASSERT_NEAR(northings[i], northing, 1e-6) << simd::name(level) << " " << latitudes[i] << "," << longitudes[i];
+        }
+    }
+}
+
+TEST(OSTransverseMercatorTests, testTheBatchSineAndCosineAreAccurate) {
+    for (double x = -20; x <= 20; x += 0.001) {
+        simd::Scalar s, c;
+        simd::sincos(simd::Scalar::broadcast(x), s, c);
+        ASSERT_NEAR(s.v, std::sin(x), 4e-16) << x;
+        ASSERT_NEAR(c.v, std::cos(x), 4e-16) << x;
+    }
+}
+
+TEST(OSTransverseMercatorTests, testItProjectsTheSouthamptonFixtureIntoTheRightSquare) {
+    FixBuffer fixes = loadFixture("Southampton-OS-route.gpx");
+    double easting, northing;
+    projectTransverseMercator(nationalGridProjection(kGRS80), fixes.front().latitude, fixes.front().longitude, easting, northing);
+    // SU 3 1, a few kilometres north of Southampton
+    EXPECT_GT(easting, 430000);
+    EXPECT_LT(easting, 440000);
+    EXPECT_GT(northing, 110000);
+    EXPECT_LT(northing, 120000);
+}
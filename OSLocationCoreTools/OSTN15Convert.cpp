@@ -0,0 +1,25 @@
+//
+//  OSTN15Convert.cpp
+//  OSLocationCoreTools
+//
+//  Converts the published OSTN15_OSGM15_DataFile.txt into the memory
+//  mappable grid file read by OSTN15Grid.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTN15Grid.h"
+
+#include <cstdio>
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s OSTN15_OSGM15_DataFile.txt ostn15.grid\n", argv[0]);
+        return 2;
+    }
+    if (!oslocation::OSTN15Grid::convertDataFile(argv[1], argv[2])) {
+        std::fprintf(stderr, "Could not convert %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+//
+//  OSTrackConvert.cpp
+//  OSLocationCoreTools
+//
+//  Converts GPX files to binary track files and back, choosing the
+//  direction from the input's extension.
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#include "OSTrackFile.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+using namespace oslocation;
+
+namespace {
+
+bool hasSuffix(const std::string &string, const char *suffix) {
+    const std::size_t length = std::strlen(suffix);
+    return string.size() >= length && string.compare(string.size() - length, length, suffix) == 0;
+}
+
+bool writeGPX(const TrackFile &track, const char *path) {
+    FixBuffer fixes;
+    if (!track.readAll(fixes)) {
+        return false;
+    }
+    std::FILE *file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<gpx xmlns=\"http://www.topografix.com/GPX/1/1\" version=\"1.1\" creator=\"OSTrackConvert\">\n<trk><trkseg>\n");
+    for (const Fix &fix : fixes) {
+        std::fprintf(file, "<trkpt lat=\"%.7f\" lon=\"%.7f\">", fix.latitude, fix.longitude);
+        if (fix.verticalAccuracy >= 0) {
+            std::fprintf(file, "<ele>%.2f</ele>", fix.altitude);
+        }
+        if (!std::isnan(fix.timestamp)) {
+            const auto seconds = static_cast<std::time_t>(std::floor(fix.timestamp));
+            const int milliseconds = static_cast<int>(std::lround((fix.timestamp - seconds) * 1000));
+            std::tm utc;
+            gmtime_r(&seconds, &utc);
+            char time[32];
+            std::strftime(time, sizeof(time), "%Y-%m-%dT%H:%M:%S", &utc);
+            if (milliseconds) {
+                std::fprintf(file, "<time>%s.%03dZ</time>", time, milliseconds);
+            } else {
+                std::fprintf(file, "<time>%sZ</time>", time);
+            }
+        }
+        std::fprintf(file, "</trkpt>\n");
+    }
+    std::fprintf(file, "</trkseg></trk>\n</gpx>\n");
+    return std::fclose(file) == 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s track.gpx track.ostrack\n       %s track.ostrack track.gpx\n", argv[0], argv[0]);
+        return 2;
+    }
+    const std::string input = argv[1];
+    if (hasSuffix(input, ".gpx")) {
+        if (!convertGPXToTrackFile(input, argv[2])) {
+            std::fprintf(stderr, "Could not convert %s\n", argv[1]);
+            return 1;
+        }
+        return 0;
+    }
+    TrackFile track;
+    if (!track.open(input)) {
+        std::fprintf(stderr, "%s is not a track file\n", argv[1]);
+        return 1;
+    }
+    if (!writeGPX(track, argv[2])) {
+        std::fprintf(stderr, "Could not write %s\n", argv[2]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+//
+//  OSCoreLocationBridge.h
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "OSHeading.h"
+#import "OSLocation.h"
+#include "OSCompass.h"
+#include "OSFix.h"
+#include "OSLocationSettings.h"
+
+@import CoreLocation;
+
+/**
+ *  Conversions between CoreLocation types and their OSLocationCore
+ *  equivalents, shared by the classes that feed the native core
+ */
+
+static inline oslocation::Fix OSFixFromLocation(CLLocation *location, NSUInteger index) {
+    const BOOL hasGridPosition = [location isKindOfClass:[OSLocation class]];
+    return oslocation::Fix{
+        location.timestamp.timeIntervalSince1970,
+        location.coordinate.latitude,
+        location.coordinate.longitude,
+        location.altitude,
+        location.horizontalAccuracy,
+        location.verticalAccuracy,
+        location.speed,
+        location.course,
+        hasGridPosition ? ((OSLocation *)location).easting : NAN,
+        hasGridPosition ? ((OSLocation *)location).northing : NAN,
+        oslocation::FixFlagNone,
+        static_cast<int32_t>(index)};
+}
+
+static inline CLLocation *OSLocationFromFix(const oslocation::Fix &fix) {
+    if (oslocation::hasGridPosition(fix)) {
+        return [[OSLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(fix.latitude, fix.longitude)
+                                             altitude:fix.altitude
+                                   horizontalAccuracy:fix.horizontalAccuracy
+                                     verticalAccuracy:fix.verticalAccuracy
+                                               course:fix.course
+                                                speed:fix.speed
+                                            timestamp:[NSDate dateWithTimeIntervalSince1970:fix.timestamp]
+                                              easting:fix.easting
+                                             northing:fix.northing];
+    }
+    return [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(fix.latitude, fix.longitude)
+                                         altitude:fix.altitude
+                               horizontalAccuracy:fix.horizontalAccuracy
+                                 verticalAccuracy:fix.verticalAccuracy
+                                           course:fix.course
+                                            speed:fix.speed
+                                        timestamp:[NSDate dateWithTimeIntervalSince1970:fix.timestamp]];
+}
+
+static inline oslocation::Heading OSCoreHeadingFromHeading(CLHeading *heading) {
+    return oslocation::Heading{
+        heading.timestamp.timeIntervalSince1970,
+        heading.magneticHeading,
+        heading.trueHeading,
+        [heading isKindOfClass:[OSHeading class]] ? ((OSHeading *)heading).gridHeading : -1,
+        heading.headingAccuracy,
+        heading.x,
+        heading.y,
+        heading.z};
+}
+
+static inline CLHeading *OSHeadingFromCoreHeading(const oslocation::Heading &heading) {
+    return [[OSHeading alloc] initWithMagneticHeading:heading.magneticHeading
+                                          trueHeading:heading.trueHeading
+                                          gridHeading:heading.gridHeading
+                                      headingAccuracy:heading.headingAccuracy
+                                                    x:heading.x
+                                                    y:heading.y
+                                                    z:heading.z
+                                            timestamp:[NSDate dateWithTimeIntervalSince1970:heading.timestamp]];
+}
+
+static inline CLLocationAccuracy OSAccuracyFromLocationAccuracy(oslocation::LocationAccuracy accuracy) {
+    switch (accuracy) {
+        case oslocation::LocationAccuracy::BestForNavigation:
+            return kCLLocationAccuracyBestForNavigation;
+        case oslocation::LocationAccuracy::Best:
+            return kCLLocationAccuracyBest;
+        case oslocation::LocationAccuracy::NearestTenMetres:
+            return kCLLocationAccuracyNearestTenMeters;
+        case oslocation::LocationAccuracy::HundredMetres:
+            return kCLLocationAccuracyHundredMeters;
+        case oslocation::LocationAccuracy::Kilometre:
+            return kCLLocationAccuracyKilometer;
+    }
+    return kCLLocationAccuracyBest;
+}
+
+/**
+ *  The least demanding level that still meets `accuracy`
+ */
+static inline oslocation::LocationAccuracy OSLocationAccuracyFromAccuracy(CLLocationAccuracy accuracy) {
+    if (accuracy <= kCLLocationAccuracyBestForNavigation) {
+        return oslocation::LocationAccuracy::BestForNavigation;
+    }
+    if (accuracy <= kCLLocationAccuracyBest) {
+        return oslocation::LocationAccuracy::Best;
+    }
+    if (accuracy <= kCLLocationAccuracyNearestTenMeters) {
+        return oslocation::LocationAccuracy::NearestTenMetres;
+    }
+    if (accuracy <= kCLLocationAccuracyHundredMeters) {
+        return oslocation::LocationAccuracy::HundredMetres;
+    }
+    return oslocation::LocationAccuracy::Kilometre;
+}
@@ -0,0 +1,61 @@
+//
+//  OSHeading.h
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+@import CoreLocation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Heading delivered by `OSLocationProvider` when it could not pass on the
+ *  `CLHeading` received from core location, such as when delivering on a
+ *  `deliveryQueue`
+ */
+@interface OSHeading : CLHeading
+
+/**
+ *  Degrees clockwise from National Grid north, or negative if unknown. Set
+ *  when `OSLocationProvider.providesGridHeadings` is on.
+ */
+@property (readonly, nonatomic) CLLocationDirection gridHeading;
+
+/**
+ *  Initialiser
+ *
+ *  @param magneticHeading degrees clockwise from magnetic north
+ *  @param trueHeading     degrees clockwise from true north, negative if
+ *                         unknown
+ *  @param gridHeading     degrees clockwise from grid north, negative if
+ *                         unknown
+ *  @param headingAccuracy largest error in degrees, negative if invalid
+ *  @param x               raw geomagnetic field on the x axis in microteslas
+ *  @param y               raw geomagnetic field on the y axis in microteslas
+ *  @param z               raw geomagnetic field on the z axis in microteslas
+ *  @param timestamp       time of the reading
+ *
+ *  @return instance of `OSHeading`
+ */
+- (instancetype)initWithMagneticHeading:(CLLocationDirection)magneticHeading trueHeading:(CLLocationDirection)trueHeading gridHeading:(CLLocationDirection)gridHeading headingAccuracy:(CLLocationDirection)headingAccuracy x:(CLHeadingComponentValue)x y:(CLHeadingComponentValue)y z:(CLHeadingComponentValue)z timestamp:(NSDate *)timestamp;
+
+/**
+ *  Initialiser for a heading with no grid heading
+ *
+ *  @param magneticHeading degrees clockwise from magnetic north
+ *  @param trueHeading     degrees clockwise from true north, negative if
+ *                         unknown
+ *  @param headingAccuracy largest error in degrees, negative if invalid
+ *  @param x               raw geomagnetic field on the x axis in microteslas
+ *  @param y               raw geomagnetic field on the y axis in microteslas
+ *  @param z               raw geomagnetic field on the z axis in microteslas
+ *  @param timestamp       time of the reading
+ *
+ *  @return instance of `OSHeading`
+ */
+- (instancetype)initWithMagneticHeading:(CLLocationDirection)magneticHeading trueHeading:(CLLocationDirection)trueHeading headingAccuracy:(CLLocationDirection)headingAccuracy x:(CLHeadingComponentValue)x y:(CLHeadingComponentValue)y z:(CLHeadingComponentValue)z timestamp:(NSDate *)timestamp;
+
+@end
+
+NS_ASSUME_NONNULL_END
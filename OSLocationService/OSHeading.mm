@@ -0,0 +1,82 @@
+//
+//  OSHeading.mm
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#import "OSHeading.h"
+
+@implementation OSHeading {
+    CLLocationDirection _magneticHeading;
+    CLLocationDirection _trueHeading;
+    CLLocationDirection _gridHeading;
+    CLLocationDirection _headingAccuracy;
+    CLHeadingComponentValue _x;
+    CLHeadingComponentValue _y;
+    CLHeadingComponentValue _z;
+    NSDate *_timestamp;
+}
+
+- (instancetype)initWithMagneticHeading:(CLLocationDirection)magneticHeading trueHeading:(CLLocationDirection)trueHeading headingAccuracy:(CLLocationDirection)headingAccuracy x:(CLHeadingComponentValue)x y:(CLHeadingComponentValue)y z:(CLHeadingComponentValue)z timestamp:(NSDate *)timestamp {
+    return [self initWithMagneticHeading:magneticHeading trueHeading:trueHeading gridHeading:-1 headingAccuracy:headingAccuracy x:x y:y z:z timestamp:timestamp];
+}
+
+- (instancetype)initWithMagneticHeading:(CLLocationDirection)magneticHeading trueHeading:(CLLocationDirection)trueHeading gridHeading:(CLLocationDirection)gridHeading headingAccuracy:(CLLocationDirection)headingAccuracy x:(CLHeadingComponentValue)x y:(CLHeadingComponentValue)y z:(CLHeadingComponentValue)z timestamp:(NSDate *)timestamp {
+    self = [super init];
+    if (self) {
+        _magneticHeading = magneticHeading;
+        _trueHeading = trueHeading;
+        _gridHeading = gridHeading;
+        _headingAccuracy = headingAccuracy;
+        _x = x;
+        _y = y;
+        _z = z;
+        _timestamp = [timestamp copy];
+    }
+    return self;
+}
+
+// CLHeading has no public initialiser, so every property is overridden
+
+- (CLLocationDirection)magneticHeading {
+    return _magneticHeading;
+}
+
+- (CLLocationDirection)trueHeading {
+    return _trueHeading;
+}
+
+- (CLLocationDirection)gridHeading {
+    return _gridHeading;
+}
+
+- (CLLocationDirection)headingAccuracy {
+    return _headingAccuracy;
+}
+
+- (CLHeadingComponentValue)x {
+    return _x;
+}
+
+- (CLHeadingComponentValue)y {
+    return _y;
+}
+
+- (CLHeadingComponentValue)z {
+    return _z;
+}
+
+- (NSDate *)timestamp {
+    return _timestamp;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"magneticHeading %.2f trueHeading %.2f gridHeading %.2f accuracy %.2f x %.3f y %.3f z %.3f @ %@", _magneticHeading, _trueHeading, _gridHeading, _headingAccuracy, _x, _y, _z, _timestamp];
+}
+
+@end
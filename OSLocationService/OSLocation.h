@@ -0,0 +1,64 @@
+//
+//  OSLocation.h
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+@import CoreLocation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Location delivered by `OSLocationProvider` when a grid conversion mode is
+ *  set, carrying its British National Grid position alongside the WGS84
+ *  coordinate
+ */
+@interface OSLocation : CLLocation
+
+/**
+ *  Easting in metres, NaN when the location is outside the National Grid
+ */
+@property (assign, nonatomic, readonly) double easting;
+
+/**
+ *  Northing in metres, NaN when the location is outside the National Grid
+ */
+@property (assign, nonatomic, readonly) double northing;
+
+/**
+ *  Indicates whether `easting` and `northing` are valid
+ */
+@property (assign, nonatomic, readonly) BOOL hasGridPosition;
+
+/**
+ *  Formats the grid position as an OS grid reference such as
+ *  "SU 42004 14000"
+ *
+ *  @param figures number of digits, 0, 2, 4, 6, 8 or 10
+ *
+ *  @return the grid reference, or nil without a grid position or for an
+ *  invalid number of figures
+ */
+- (nullable NSString *)gridReferenceWithFigures:(NSInteger)figures;
+
+/**
+ *  Initialiser
+ *
+ *  @param coordinate         WGS84 coordinate
+ *  @param altitude           altitude in metres
+ *  @param horizontalAccuracy horizontal accuracy in metres
+ *  @param verticalAccuracy   vertical accuracy in metres
+ *  @param course             course in degrees
+ *  @param speed              speed in metres per second
+ *  @param timestamp          time of the fix
+ *  @param easting            National Grid easting in metres
+ *  @param northing           National Grid northing in metres
+ *
+ *  @return instance of `OSLocation`
+ */
+- (instancetype)initWithCoordinate:(CLLocationCoordinate2D)coordinate altitude:(CLLocationDistance)altitude horizontalAccuracy:(CLLocationAccuracy)horizontalAccuracy verticalAccuracy:(CLLocationAccuracy)verticalAccuracy course:(CLLocationDirection)course speed:(CLLocationSpeed)speed timestamp:(NSDate *)timestamp easting:(double)easting northing:(double)northing;
+
+@end
+
+NS_ASSUME_NONNULL_END
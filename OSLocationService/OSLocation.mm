@@ -0,0 +1,62 @@
+//
+//  OSLocation.mm
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#import "OSLocation.h"
+#include "OSGridReference.h"
+
+static NSString *const kEastingKey = @"OSLocationEasting";
+static NSString *const kNorthingKey = @"OSLocationNorthing";
+
+@implementation OSLocation
+
+- (instancetype)initWithCoordinate:(CLLocationCoordinate2D)coordinate altitude:(CLLocationDistance)altitude horizontalAccuracy:(CLLocationAccuracy)horizontalAccuracy verticalAccuracy:(CLLocationAccuracy)verticalAccuracy course:(CLLocationDirection)course speed:(CLLocationSpeed)speed timestamp:(NSDate *)timestamp easting:(double)easting northing:(double)northing {
+    self = [super initWithCoordinate:coordinate altitude:altitude horizontalAccuracy:horizontalAccuracy verticalAccuracy:verticalAccuracy course:course speed:speed timestamp:timestamp];
+    if (self) {
+        _easting = easting;
+        _northing = northing;
+    }
+    return self;
+}
+
+- (BOOL)hasGridPosition {
+    return !isnan(self.easting) && !isnan(self.northing);
+}
+
+- (NSString *)gridReferenceWithFigures:(NSInteger)figures {
+    char buffer[oslocation::kGridReferenceMaxLength];
+    const std::size_t length = oslocation::formatGridReference(self.easting, self.northing, static_cast<int>(figures), buffer, sizeof(buffer));
+    if (length == 0) {
+        return nil;
+    }
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
+#pragma mark - NSSecureCoding
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (instancetype)initWithCoder:(NSCoder *)coder {
+    self = [super initWithCoder:coder];
+    if (self) {
+        _easting = [coder containsValueForKey:kEastingKey] ? [coder decodeDoubleForKey:kEastingKey] : NAN;
+        _northing = [coder containsValueForKey:kNorthingKey] ? [coder decodeDoubleForKey:kNorthingKey] : NAN;
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder {
+    [super encodeWithCoder:coder];
+    [coder encodeDouble:self.easting forKey:kEastingKey];
+    [coder encodeDouble:self.northing forKey:kNorthingKey];
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"%@ E %.1f N %.1f", [super description], self.easting, self.northing];
+}
+
+@end
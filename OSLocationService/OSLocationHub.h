@@ -0,0 +1,96 @@
+//
+//  OSLocationHub.h
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+@import CoreLocation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^OSLocationSubscriptionHandler)(NSArray<CLLocation *> *locations);
+typedef void (^OSHeadingSubscriptionHandler)(CLHeading *heading);
+
+/**
+ *  A subscription to an `OSLocationHub`. Updates continue until it is
+ *  cancelled or deallocated.
+ */
+@interface OSLocationSubscription : NSObject
+
+/**
+ *  Indicates whether the subscription is still receiving updates
+ */
+@property (assign, nonatomic, readonly, getter=isActive) BOOL active;
+
+/**
+ *  Stops updates to this subscription. The hub stops core location once
+ *  no subscriptions remain.
+ */
+- (void)cancel;
+
+@end
+
+/**
+ *  Shares one `CLLocationManager` between any number of subscriptions. The
+ *  manager is configured with the most demanding accuracy and the shortest
+ *  distance filter any subscription asks for, and each subscription is
+ *  delivered only the locations that meet its own filters. Use from the
+ *  main thread; handlers are called on it.
+ */
+@interface OSLocationHub : NSObject
+
+/**
+ *  Hub shared across the application
+ */
++ (instancetype)sharedHub;
+
+/**
+ *  Authorisation requested when the first subscription is made without
+ *  one. Either `kCLAuthorizationStatusAuthorizedWhenInUse`, the default, or
+ *  `kCLAuthorizationStatusAuthorizedAlways`.
+ */
+@property (assign, nonatomic) CLAuthorizationStatus requestedAuthorisationStatus;
+
+/**
+ *  If updates are needed in background, then this flag should be set to YES. By default updates stop while the app is in background and resume once it is in foreground.
+ */
+@property (assign, nonatomic) BOOL continueUpdatesInBackground;
+
+/**
+ *  Number of active location and heading subscriptions
+ */
+@property (assign, nonatomic, readonly) NSUInteger subscriptionCount;
+
+/**
+ *  Subscribes to location updates
+ *
+ *  @param desiredAccuracy accuracy the subscriber needs
+ *  @param distanceFilter  minimum distance in meters between the locations
+ *                         delivered to this subscriber
+ *  @param handler         called with the new locations
+ */
+- (OSLocationSubscription *)subscribeWithDesiredAccuracy:(CLLocationAccuracy)desiredAccuracy distanceFilter:(CLLocationDistance)distanceFilter handler:(OSLocationSubscriptionHandler)handler;
+
+/**
+ *  Subscribes to location updates with additional filters
+ *
+ *  @param desiredAccuracy           accuracy the subscriber needs
+ *  @param distanceFilter            minimum distance in meters between the
+ *                                   locations delivered to this subscriber
+ *  @param minimumInterval           minimum time between the locations
+ *                                   delivered to this subscriber
+ *  @param maximumHorizontalAccuracy locations with a worse horizontal
+ *                                   accuracy are not delivered
+ *  @param handler                   called with the new locations
+ */
+- (OSLocationSubscription *)subscribeWithDesiredAccuracy:(CLLocationAccuracy)desiredAccuracy distanceFilter:(CLLocationDistance)distanceFilter minimumInterval:(NSTimeInterval)minimumInterval maximumHorizontalAccuracy:(CLLocationAccuracy)maximumHorizontalAccuracy handler:(OSLocationSubscriptionHandler)handler;
+
+/**
+ *  Subscribes to heading updates
+ */
+- (OSLocationSubscription *)subscribeToHeadingWithHandler:(OSHeadingSubscriptionHandler)handler;
+
+@end
+
+NS_ASSUME_NONNULL_END
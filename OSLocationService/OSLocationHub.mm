@@ -0,0 +1,259 @@
+//
+//  OSLocationHub.mm
+//  OSLocationService
+//
+//  Copyright © 2026 Ordnance Survey. All rights reserved.
+//
+
+#import "OSLocationHub.h"
+#import "OSCoreLocationBridge.h"
+#include "OSSubscriptionHub.h"
+
+@import UIKit.UIDevice;
+@import UIKit.UIApplication;
+
+@interface OSLocationSubscription ()
+
+@property (weak, nonatomic) OSLocationHub *hub;
+@property (assign, nonatomic) NSUInteger identifier;
+@property (assign, nonatomic) BOOL isHeadingSubscription;
+@property (assign, nonatomic, readwrite, getter=isActive) BOOL active;
+
+@end
+
+@interface OSLocationHub ()<CLLocationManagerDelegate>
+
+- (void)cancelSubscriptionWithIdentifier:(NSUInteger)identifier heading:(BOOL)heading;
+
+@end
+
+@implementation OSLocationSubscription
+
+- (void)cancel {
+    if (self.active) {
+        self.active = NO;
+        [self.hub cancelSubscriptionWithIdentifier:self.identifier heading:self.isHeadingSubscription];
+    }
+}
+
+- (void)dealloc {
+    if (_active) {
+        [_hub cancelSubscriptionWithIdentifier:_identifier heading:_isHeadingSubscription];
+    }
+}
+
+@end
+
+@implementation OSLocationHub {
+    oslocation::SubscriptionHub _hub;
+    oslocation::FixBuffer _fixBuffer;
+    CLLocationManager *_locationManager;
+    NSArray<CLLocation *> *_publishedLocations;
+    NSMutableDictionary<NSNumber *, OSHeadingSubscriptionHandler> *_headingHandlers;
+    NSUInteger _nextHeadingIdentifier;
+    BOOL _updatingLocation;
+    BOOL _updatingHeading;
+    BOOL _inBackground;
+}
+
++ (instancetype)sharedHub {
+    static OSLocationHub *sharedHub;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedHub = [[OSLocationHub alloc] init];
+    });
+    return sharedHub;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _requestedAuthorisationStatus = kCLAuthorizationStatusAuthorizedWhenInUse;
+        _headingHandlers = [NSMutableDictionary dictionary];
+        _locationManager = [[CLLocationManager alloc] init];
+        _locationManager.delegate = self;
+        _locationManager.activityType = CLActivityTypeFitness;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didEnterBackground:) name:UIApplicationDidEnterBackgroundNotification object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(willEnterForeground:) name:UIApplicationWillEnterForegroundNotification object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(orientationChanged) name:UIDeviceOrientationDidChangeNotification object:nil];
+    }
+    return self;
+}
+
+- (NSUInteger)subscriptionCount {
+    return _hub.subscriberCount() + _headingHandlers.count;
+}
+
+- (void)setContinueUpdatesInBackground:(BOOL)continueUpdatesInBackground {
+    _continueUpdatesInBackground = continueUpdatesInBackground;
+    _locationManager.allowsBackgroundLocationUpdates = continueUpdatesInBackground;
+}
+
+#pragma mark - Subscriptions
+- (OSLocationSubscription *)subscribeWithDesiredAccuracy:(CLLocationAccuracy)desiredAccuracy distanceFilter:(CLLocationDistance)distanceFilter handler:(OSLocationSubscriptionHandler)handler {
+    return [self subscribeWithDesiredAccuracy:desiredAccuracy distanceFilter:distanceFilter minimumInterval:0 maximumHorizontalAccuracy:CLLocationDistanceMax handler:handler];
+}
+
+- (OSLocationSubscription *)subscribeWithDesiredAccuracy:(CLLocationAccuracy)desiredAccuracy distanceFilter:(CLLocationDistance)distanceFilter minimumInterval:(NSTimeInterval)minimumInterval maximumHorizontalAccuracy:(CLLocationAccuracy)maximumHorizontalAccuracy handler:(OSLocationSubscriptionHandler)handler {
+    oslocation::SubscriptionOptions options;
+    const double minimumDistance = distanceFilter > 0 ? distanceFilter : 0;
+    options.settings = {OSLocationAccuracyFromAccuracy(desiredAccuracy), minimumDistance, false};
+    options.minimumDistance = minimumDistance;
+    options.minimumInterval = minimumInterval;
+    options.maximumAccuracy = maximumHorizontalAccuracy;
+
+    OSLocationSubscriptionHandler locationHandler = [handler copy];
+    __weak OSLocationHub *weakSelf = self;
+    OSLocationSubscription *subscription = [[OSLocationSubscription alloc] init];
+    subscription.hub = self;
+    subscription.active = YES;
+    subscription.identifier = _hub.subscribe(options, [weakSelf, locationHandler](const oslocation::FixBuffer &fixes) {
+        OSLocationHub *hub = weakSelf;
+        if (hub) {
+            locationHandler([hub locationsForFixes:fixes]);
+        }
+    });
+    [self updateLocationManager];
+    return subscription;
+}
+
+- (OSLocationSubscription *)subscribeToHeadingWithHandler:(OSHeadingSubscriptionHandler)handler {
+    OSLocationSubscription *subscription = [[OSLocationSubscription alloc] init];
+    subscription.hub = self;
+    subscription.active = YES;
+    subscription.isHeadingSubscription = YES;
+    subscription.identifier = ++_nextHeadingIdentifier;
+    _headingHandlers[@(subscription.identifier)] = [handler copy];
+    [self updateLocationManager];
+    return subscription;
+}
+
+- (void)cancelSubscriptionWithIdentifier:(NSUInteger)identifier heading:(BOOL)heading {
+    if (heading) {
+        [_headingHandlers removeObjectForKey:@(identifier)];
+    } else {
+        _hub.unsubscribe(static_cast<oslocation::SubscriptionId>(identifier));
+    }
+    [self updateLocationManager];
+}
+
+/**
+ *  The published locations that passed a subscription's filters, reusing
+ *  the published array when they all did
+ */
+- (NSArray<CLLocation *> *)locationsForFixes:(const oslocation::FixBuffer &)fixes {
+    if (fixes.size() == _publishedLocations.count) {
+        return _publishedLocations;
+    }
+    NSMutableArray<CLLocation *> *locations = [NSMutableArray arrayWithCapacity:fixes.size()];
+    for (const oslocation::Fix &fix : fixes) {
+        [locations addObject:_publishedLocations[fix.sourceIndex]];
+    }
+    return locations;
+}
+
+#pragma mark - Location manager
+/**
+ *  Configures the shared manager for what the subscriptions need, starting
+ *  and stopping updates as the first subscription arrives and the last
+ *  leaves
+ */
+- (void)updateLocationManager {
+    oslocation::LocationSettings settings;
+    if (_hub.mergedSettings(settings)) {
+        _locationManager.desiredAccuracy = OSAccuracyFromLocationAccuracy(settings.accuracy);
+        _locationManager.distanceFilter = settings.distanceFilter > 0 ? settings.distanceFilter : kCLDistanceFilterNone;
+        [self startLocationUpdates];
+    } else if (_updatingLocation) {
+        [_locationManager stopUpdatingLocation];
+        _updatingLocation = NO;
+        _hub.reset();
+    }
+
+    const BOOL wantsHeading = _headingHandlers.count > 0 && [CLLocationManager headingAvailable];
+    if (wantsHeading && !_updatingHeading && !_inBackground) {
+        [_locationManager startUpdatingHeading];
+        _updatingHeading = YES;
+    } else if (!wantsHeading && _updatingHeading) {
+        [_locationManager stopUpdatingHeading];
+        _updatingHeading = NO;
+    }
+}
+
+- (void)startLocationUpdates {
+    if (_updatingLocation || _inBackground || ![CLLocationManager locationServicesEnabled]) {
+        return;
+    }
+    CLAuthorizationStatus status = [CLLocationManager authorizationStatus];
+    if (status == kCLAuthorizationStatusAuthorizedAlways || status == kCLAuthorizationStatusAuthorizedWhenInUse) {
+        [_locationManager startUpdatingLocation];
+        _updatingLocation = YES;
+    } else if (status == kCLAuthorizationStatusNotDetermined) {
+        if (self.requestedAuthorisationStatus == kCLAuthorizationStatusAuthorizedAlways) {
+            [_locationManager requestAlwaysAuthorization];
+        } else {
+            [_locationManager requestWhenInUseAuthorization];
+        }
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didUpdateLocations:(NSArray<CLLocation *> *)locations {
+    _fixBuffer.clear();
+    [locations enumerateObjectsUsingBlock:^(CLLocation *location, NSUInteger idx, BOOL *stop) {
+        self->_fixBuffer.push_back(OSFixFromLocation(location, idx));
+    }];
+    _publishedLocations = locations;
+    _hub.publish(_fixBuffer);
+    _publishedLocations = nil;
+}
+
+- (void)locationManager:(CLLocationManager *)manager didUpdateHeading:(CLHeading *)newHeading {
+    // Copied so handlers can cancel subscriptions while being called
+    for (OSHeadingSubscriptionHandler handler in _headingHandlers.allValues) {
+        handler(newHeading);
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didChangeAuthorizationStatus:(CLAuthorizationStatus)status {
+    if (status == kCLAuthorizationStatusAuthorizedWhenInUse || status == kCLAuthorizationStatusAuthorizedAlways) {
+        [self updateLocationManager];
+    }
+}
+
+#pragma mark - Notifications
+- (void)didEnterBackground:(id)sender {
+    if (self.continueUpdatesInBackground) {
+        return;
+    }
+    _inBackground = YES;
+    if (_updatingLocation) {
+        [_locationManager stopUpdatingLocation];
+        _updatingLocation = NO;
+    }
+    if (_updatingHeading) {
+        [_locationManager stopUpdatingHeading];
+        _updatingHeading = NO;
+    }
+}
+
+- (void)willEnterForeground:(id)sender {
+    if (!_inBackground) {
+        return;
+    }
+    _inBackground = NO;
+    [self updateLocationManager];
+}
+
+- (void)orientationChanged {
+    _locationManager.headingOrientation = (CLDeviceOrientation)UIDevice.currentDevice.orientation;
+}
+
+- (void)dealloc {
+    _locationManager.delegate = nil;
+    [_locationManager stopUpdatingLocation];
+    [_locationManager stopUpdatingHeading];
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+@end
@@ -37,7 +37,17 @@ typedef NS_ENUM(NSInteger, OSLocationUpdatePurpose) {
      *  The provider is being used for an unknown purpose. `distanceFilter`
      *  and `desiredAccuracy` properties should be set as desired.
      */
-    OSLocationUpdatePurposeCustom
+    OSLocationUpdatePurposeCustom,
+    /**
+     *  The provider will be used to follow the user for long periods, such
+     *  as route recording on a day out. Accuracy, distance filter and heading
+     *  updates follow the user's motion: `kCLLocationAccuracyBest` with a 5
+     *  meters distance filter while walking, `kCLLocationAccuracyBestForNavigation`
+     *  with 15 meters while driving, and `kCLLocationAccuracyHundredMeters`
+     *  with 50 meters and no heading updates once the user has stayed within
+     *  20 meters for a minute.
+     */
+    OSLocationUpdatePurposeAdaptive
 };
 
 /**
@@ -62,6 +72,141 @@ typedef NS_OPTIONS(NSUInteger, OSLocationServiceUpdateOptions) {
     OSLocationServiceAllOptions = OSLocationServiceLocationUpdates | OSLocationServiceHeadingUpdates
 };
 
+/**
+ *  Processing applied to locations before they are delivered
+ */
+typedef NS_OPTIONS(NSUInteger, OSLocationProcessingOptions) {
+    /**
+     *  Locations are delivered as received from core location
+     */
+    OSLocationProcessingNone = 0,
+    /**
+     *  Positions are smoothed with a Kalman filter weighted by each
+     *  location's `horizontalAccuracy`. Smoothed locations report the
+     *  filter's uncertainty as their `horizontalAccuracy`.
+     */
+    OSLocationProcessingSmoothing = 1 << 0,
+    /**
+     *  Locations implying an impossible speed or acceleration, or with an
+     *  accuracy much worse than the recent ones, are dropped. Runs before
+     *  smoothing.
+     */
+    OSLocationProcessingRejectOutliers = 1 << 1,
+    /**
+     *  Only locations needed to describe the track to within
+     *  `simplificationTolerance` are delivered, for route recording. A
+     *  location is delivered once a later one shows it is needed, so
+     *  delivery lags by one location; the last is delivered when updates
+     *  stop.
+     */
+    OSLocationProcessingSimplify = 1 << 2,
+    /**
+     *  Once the user has stayed within 30 meters for two minutes, further
+     *  locations inside that radius are not delivered. The stay is reported
+     *  through `locationProvider:didBeginStayAtLocation:` and
+     *  `locationProvider:didEndStayAtLocation:departureDate:` instead.
+     */
+    OSLocationProcessingCollapseStays = 1 << 3,
+    /**
+     *  Distance, ascent and moving time are kept up to date in
+     *  `trackStatistics` as locations arrive, and each `splitDistance`
+     *  completed is reported through
+     *  `locationProvider:didCompleteSplit:date:`. Runs after stays are
+     *  collapsed and before simplification.
+     */
+    OSLocationProcessingTrackStatistics = 1 << 4
+};
+
+/**
+ *  Counts of locations dropped by `OSLocationProcessingRejectOutliers`
+ */
+typedef struct {
+    /**
+     *  Locations with an invalid coordinate
+     */
+    NSUInteger invalid;
+    /**
+     *  Locations implying an impossible speed from the last one kept
+     */
+    NSUInteger speed;
+    /**
+     *  Locations implying an impossible change in speed
+     */
+    NSUInteger acceleration;
+    /**
+     *  Locations much less accurate than the recent ones
+     */
+    NSUInteger accuracy;
+} OSLocationRejectionCounts;
+
+/**
+ *  Totals kept by `OSLocationProcessingTrackStatistics`
+ */
+typedef struct {
+    /**
+     *  Meters along the track
+     */
+    CLLocationDistance distance;
+    /**
+     *  Meters climbed and descended, ignoring altitude changes under 5 meters
+     */
+    CLLocationDistance ascent;
+    CLLocationDistance descent;
+    /**
+     *  Seconds from the first location, less any time updates were stopped
+     */
+    NSTimeInterval elapsedTime;
+    /**
+     *  Seconds spent moving faster than 0.5 meters per second
+     */
+    NSTimeInterval movingTime;
+} OSTrackStatistics;
+
+/**
+ *  How locations are converted to the British National Grid
+ */
+typedef NS_ENUM(NSInteger, OSGridConversionMode) {
+    /**
+     *  Locations are delivered as received from core location
+     */
+    OSGridConversionModeNone,
+    /**
+     *  Locations are delivered as `OSLocation` objects with a National Grid
+     *  position from a Helmert datum shift. Accurate to about 5 metres and
+     *  cheap enough for every update, suitable for live display.
+     */
+    OSGridConversionModeApproximate,
+    /**
+     *  Locations are delivered as `OSLocation` objects with a National Grid
+     *  position from the OSTN15 transformation, accurate to about 0.1 metres.
+     *  Requires `gridShiftFilePath`; falls back to
+     *  `OSGridConversionModeApproximate` until the grid is loaded.
+     */
+    OSGridConversionModePrecise
+};
+
+/**
+ *  What happens when locations and headings arrive faster than a
+ *  `deliveryQueue` delivers them
+ */
+typedef NS_ENUM(NSInteger, OSDeliveryBackpressure) {
+    /**
+     *  The oldest waiting locations and headings are discarded, so the
+     *  delegate always receives the most recent ones
+     */
+    OSDeliveryBackpressureDropOldest,
+    /**
+     *  Waiting locations and headings are kept and everything after them
+     *  collapses into the newest, delivered once the delegate catches up
+     */
+    OSDeliveryBackpressureCoalesce,
+    /**
+     *  The thread receiving updates from core location, usually the main
+     *  thread, waits for the delegate to catch up, so nothing is lost
+     */
+    OSDeliveryBackpressureBlock
+};
+
 /**
  * Wrapper around core location
  */
@@ -136,6 +281,317 @@ typedef NS_OPTIONS(NSUInteger, OSLocationServiceUpdateOptions) {
  */
 @property (assign, nonatomic) BOOL allowsDeferredUpdates;
 
+/**
+ *  Processing applied to locations before they are delivered. Defaults to
+ *  `OSLocationProcessingNone`.
+ */
+@property (assign, nonatomic) OSLocationProcessingOptions processingOptions;
+
+/**
+ *  Largest distance in metres between the recorded and the delivered track
+ *  with `OSLocationProcessingSimplify`. Defaults to 5 metres.
+ */
+@property (assign, nonatomic) CLLocationDistance simplificationTolerance;
+
+/**
+ *  With `OSLocationProcessingCollapseStays`, lowers the desired accuracy
+ *  and raises the distance filter during a stay so core location can power
+ *  down GPS until the user moves on, restoring them when the stay ends.
+ *  Ignored with `OSLocationUpdatePurposeAdaptive`, which manages both
+ *  itself. Defaults to NO.
+ */
+@property (assign, nonatomic) BOOL throttlesUpdatesDuringStays;
+
+/**
+ *  Locations dropped by `OSLocationProcessingRejectOutliers` over the
+ *  lifetime of the provider
+ */
+@property (assign, nonatomic, readonly) OSLocationRejectionCounts rejectionCounts;
+
+/**
+ *  Totals over the locations seen with `OSLocationProcessingTrackStatistics`
+ *  since the provider was created or `resetTrackStatistics` was called.
+ *  Stopping and restarting updates carries on the totals without counting
+ *  the distance between the last location before and the first after.
+ */
+@property (assign, nonatomic, readonly) OSTrackStatistics trackStatistics;
+
+/**
+ *  Distance between the splits reported with
+ *  `OSLocationProcessingTrackStatistics`, such as 1609.344 for miles. 0
+ *  turns splits off. Changing it restarts the statistics. Defaults to 1000
+ *  meters.
+ */
+@property (assign, nonatomic) CLLocationDistance splitDistance;
+
+/**
+ *  Starts `trackStatistics` and the split count again from zero
+ */
+- (void)resetTrackStatistics;
+
+/**
+ *  Whether delivered locations are kept in a recorded track. The track is
+ *  held natively as columns of values, about 44 bytes a location against
+ *  well over 100 for a `CLLocation`, so hours of updates can be kept
+ *  without accumulating objects. Turning it off keeps what has been
+ *  recorded. Defaults to NO.
+ */
+@property (assign, nonatomic) BOOL recordsTrack;
+
+/**
+ *  Number of locations in the recorded track
+ */
+@property (assign, nonatomic, readonly) NSUInteger recordedLocationCount;
+
+/**
+ *  A location from the recorded track, rebuilt as a `CLLocation`. Altitude,
+ *  accuracies, speed and course are kept to float precision.
+ */
+- (CLLocation *)recordedLocationAtIndex:(NSUInteger)index;
+
+/**
+ *  Copies coordinates from the recorded track, such as to build a polyline,
+ *  without creating a location for each
+ *
+ *  @param coordinates buffer for `range.length` coordinates
+ *  @param range       range of locations to copy, clipped to the track
+ *
+ *  @return number of coordinates copied
+ */
+- (NSUInteger)getRecordedCoordinates:(CLLocationCoordinate2D *)coordinates range:(NSRange)range;
+
+/**
+ *  Empties the recorded track and frees its memory
+ */
+- (void)clearRecordedTrack;
+
+/**
+ *  Seconds between flushes of the journal to storage. Locations written
+ *  to the journal survive the app being killed at once, but only survive
+ *  the device losing power once flushed. 0 flushes on every write. Takes
+ *  effect when journaling starts. Defaults to 10 seconds.
+ */
+@property (assign, nonatomic) NSTimeInterval journalSyncInterval;
+
+/**
+ *  Whether delivered locations are being journaled
+ */
+@property (assign, nonatomic, readonly, getter=isJournaling) BOOL journaling;
+
+/**
+ *  Starts appending every delivered location to a journal at the given
+ *  path, such as while recording a route with
+ *  `OSLocationUpdatePurposeRouteRecording`, so a crash or the system
+ *  ending the app loses at most the last second of the route. Locations
+ *  are checksummed fixed size records written in groups, so the cost per
+ *  location does not grow with the length of the route. An existing
+ *  journal is recovered and appended to.
+ *
+ *  @return NO if the file could not be created or is not a journal
+ */
+- (BOOL)startJournalingToFileAtPath:(NSString *)path;
+
+/**
+ *  Writes and flushes anything still held and closes the journal
+ */
+- (void)stopJournaling;
+
+/**
+ *  Reads the locations from a journal, such as one left by a crash,
+ *  dropping a record cut short by it. Altitude, accuracies, speed and
+ *  course are kept to float precision.
+ *
+ *  @return nil if the file could not be read or is not a journal
+ */
++ (nullable NSArray<CLLocation *> *)locationsFromJournalAtPath:(NSString *)path;
+
+/**
+ *  File in which the latest location is kept for the next session. When
+ *  set, starting updates calls
+ *  `locationProvider:didUpdateProvisionalLocation:` straight away with the
+ *  cached location, so a position shows while CoreLocation produces its
+ *  first fix. The file is written at most every ten seconds while
+ *  locations arrive, and when updates stop or the app enters the
+ *  background. nil, the default, turns the cache off.
+ */
+@property (copy, nonatomic, nullable) NSString *lastLocationCachePath;
+
+/**
+ *  Age beyond which the cached location is not used. Its accuracy is also
+ *  widened by 1.5 meters for every second of age, and it is not used once
+ *  that is worse than 2 km. Defaults to 30 minutes.
+ */
+@property (assign, nonatomic) NSTimeInterval maximumCachedLocationAge;
+
+/**
+ *  How delivered locations are converted to the National Grid. Defaults to
+ *  `OSGridConversionModeNone`.
+ */
+@property (assign, nonatomic) OSGridConversionMode gridConversionMode;
+
+/**
+ *  Path to an OSTN15 grid file written by OSTN15Convert, used by
+ *  `OSGridConversionModePrecise`. The file is memory mapped when set.
+ */
+@property (copy, nonatomic, nullable) NSString *gridShiftFilePath;
+
+/**
+ *  When YES, headings are delivered as `OSHeading` with `gridHeading` set
+ *  from the National Grid convergence at the last known location. A true
+ *  heading core location could not provide is filled in from the World
+ *  Magnetic Model. Headings received before any location have no grid
+ *  heading. Defaults to NO.
+ */
+@property (assign, nonatomic) BOOL providesGridHeadings;
+
+/**
+ *  When greater than zero, headings are smoothed with a low-pass filter
+ *  that reaches 63% of a turn in this many seconds. Headings are averaged as
+ *  directions, so readings either side of north settle on north. Device
+ *  orientation changes restart the filter rather than sweeping the
+ *  delivered heading round. Defaults to 0, delivering headings unfiltered.
+ */
+@property (assign, nonatomic) NSTimeInterval headingSmoothingTimeConstant;
+
+/**
+ *  Headings turning less than this from the last one delivered are not
+ *  delivered. Applied after `headingSmoothingTimeConstant`. Defaults to 0.
+ */
+@property (assign, nonatomic) CLLocationDegrees headingDeadBand;
+
+/**
+ *  When greater than zero, location and heading updates are merged into at
+ *  most one callback per interval, such as 1/60 for a display redrawn on
+ *  every callback. Every location is delivered but only the latest heading.
+ *  The delegate receives `locationProvider:didUpdateLocations:heading:` if
+ *  it implements it, or the separate location and heading methods. Defaults
+ *  to 0, delivering every update as it arrives.
+ */
+@property (assign, nonatomic) NSTimeInterval frameInterval;
+
+/**
+ *  With `frameInterval` set, a heading turning less than this from the last
+ *  one delivered waits for up to a second rather than making a callback of
+ *  its own. Defaults to 1 degree.
+ */
+@property (assign, nonatomic) CLLocationDegrees minimumHeadingChange;
+
+/**
+ *  With `frameInterval` set, locations less than this distance from the
+ *  last one delivered wait for up to a second rather than making a callback
+ *  of their own. Defaults to 1 meter.
+ */
+@property (assign, nonatomic) CLLocationDistance minimumLocationChange;
+
+/**
+ *  Where the user is predicted to be at a time between locations, for a
+ *  display redrawn from a display link rather than on each update. The
+ *  last location delivered moves on at its speed and course, or at the
+ *  velocity of recent locations if it has none, turning as the heading
+ *  turns, for up to five seconds. Predictions ease over half a second onto
+ *  each new location rather than jumping to it. Cheap enough to call on
+ *  every frame.
+ *
+ *  @param date usually the current date
+ *
+ *  @return kCLLocationCoordinate2DInvalid until a location has been
+ *  delivered
+ */
+- (CLLocationCoordinate2D)predictedCoordinateAtDate:(NSDate *)date;
+
+/**
+ *  Queue on which location and heading updates are delivered to the
+ *  delegate, so heavy work in the delegate does not hold up the main
+ *  thread. Locations and headings pass
+ *  to it through a fixed size lock-free buffer and are delivered as
+ *  `CLLocation`, `OSLocation` and `OSHeading` objects rebuilt from their
+ *  values. Other delegate methods are still called on the main thread.
+ *  Setting the main queue is the same as setting nil, the default, which
+ *  delivers directly on the thread receiving updates.
+ */
+@property (strong, nonatomic, nullable) dispatch_queue_t deliveryQueue;
+
+/**
+ *  What happens when the delegate falls behind on `deliveryQueue`. Defaults
+ *  to `OSDeliveryBackpressureDropOldest`.
+ */
+@property (assign, nonatomic) OSDeliveryBackpressure deliveryBackpressure;
+
+/**
+ *  Adds a circular geofence, replacing any geofence with the same
+ *  identifier. Geofences are evaluated in software on every location
+ *  update, so there is no limit on their number. Transitions are reported
+ *  through `locationProvider:didTransitionGeofence:transition:`.
+ *
+ *  @param identifier identifier reported with transitions
+ *  @param center     centre of the geofence
+ *  @param radius     radius in metres
+ *
+ *  @return NO if the centre or radius is invalid
+ */
+- (BOOL)addGeofenceWithIdentifier:(NSString *)identifier center:(CLLocationCoordinate2D)center radius:(CLLocationDistance)radius;
+
+/**
+ *  Adds a polygonal geofence, replacing any geofence with the same
+ *  identifier
+ *
+ *  @param identifier  identifier reported with transitions
+ *  @param coordinates vertices of the polygon, in order
+ *  @param count       number of vertices, at least 3
+ *
+ *  @return NO if there are too few vertices or a vertex is invalid
+ */
+- (BOOL)addGeofenceWithIdentifier:(NSString *)identifier coordinates:(const CLLocationCoordinate2D *)coordinates count:(NSUInteger)count;
+
+/**
+ *  Removes the geofence with the given identifier
+ */
+- (void)removeGeofenceWithIdentifier:(NSString *)identifier;
+
+/**
+ *  Removes all geofences
+ */
+- (void)removeAllGeofences;
+
+/**
+ *  Meters from the route beyond which locations count as off it. Locations
+ *  must come back within half this distance to rejoin. Setting it starts
+ *  matching the route afresh. Defaults to 30 meters.
+ */
+@property (assign, nonatomic) CLLocationDistance offRouteDistance;
+
+/**
+ *  Progress at the latest location matched to the route, zero until there
+ *  is one
+ */
+@property (assign, nonatomic, readonly) OSRouteProgress routeProgress;
+
+/**
+ *  Sets a route to follow, replacing any other. Every location update is
+ *  matched to it in software, searching only the stretch of route the
+ *  last match could have reached, and progress is reported through
+ *  `locationProvider:didUpdateRouteProgress:`.
+ *
+ *  @param coordinates vertices of the route, in order
+ *  @param count       number of vertices, at least 2
+ *
+ *  @return NO if fewer than two valid, distinct vertices were given
+ */
+- (BOOL)setRouteWithCoordinates:(const CLLocationCoordinate2D *)coordinates count:(NSUInteger)count;
+
+/**
+ *  Sets a route to follow from the route and track points of a GPX file,
+ *  or its waypoints if it has neither
+ *
+ *  @return NO if the file could not be read or has too few points
+ */
+- (BOOL)setRouteWithContentsOfGPXFile:(NSString *)path;
+
+/**
+ *  Stops following the route
+ */
+- (void)removeRoute;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,1371 @@
+//
+//  OSLocationProvider.mm
+//  OSLocationService
+//
+//  Created by Shrikantreddy Tekale on 25/09/2015.
+//  Copyright © 2015 Ordnance Survey. All rights reserved.
+//
+
+#import "OSLocationProvider.h"
+#import "OSLocationProvider+Private.h"
+#import "OSCoreLocationBridge.h"
+#include "OSAdaptiveScheduler.h"
+#include "OSDeliveryQueue.h"
+#include "OSFrameCoalescer.h"
+#include "OSGeofence.h"
+#include "OSHeadingFilter.h"
+#include "OSHelmertTransform.h"
+#include "OSKalmanFilter.h"
+#include "OSLastFixCache.h"
+#include "OSNorthConverter.h"
+#include "OSNationalGridStage.h"
+#include "OSOutlierFilter.h"
+#include "OSPipeline.h"
+#include "OSPositionPredictor.h"
+#include "OSRouteMatcher.h"
+#include "OSStayPointDetector.h"
+#include "OSTrackJournal.h"
+#include "OSTrackSimplifier.h"
+#include "OSTrackStatistics.h"
+#include "OSTrackStore.h"
+
+#include <atomic>
+#include <memory>
+
+@import UIKit.UIDevice;
+@import UIKit.UIApplication;
+
+const CLLocationDistance kDistanceFilterLow = 100;
+const CLLocationDistance kDistanceFilterMedium = 40;
+const CLLocationDistance kDistanceFilterHigh = 10;
+
+/**
+ *  How often the adaptive scheduler checks for a stay while the distance
+ *  filter is holding updates back
+ */
+static const NSTimeInterval kSchedulerTickInterval = 15;
+
+/**
+ *  Locations and headings below the frame thresholds are still delivered
+ *  after this long
+ */
+static const NSTimeInterval kFrameMaximumDelay = 1;
+
+/**
+ *  Locations and headings that can wait for the delegate on `deliveryQueue`
+ */
+static const std::size_t kDeliveryQueueCapacity = 64;
+
+/**
+ *  Years after which the magnetic model is advanced to the current date,
+ *  for providers running for months
+ */
+static const double kMagneticModelLifetime = 1.0 / 12;
+
+/**
+ *  The buffer feeding `deliveryQueue`, shared with the blocks draining it
+ *  so it outlives a change of queue or policy
+ */
+struct OSDeliveryChannel {
+    explicit OSDeliveryChannel(oslocation::Backpressure policy) : queue(kDeliveryQueueCapacity, policy) {}
+
+    oslocation::DeliveryQueue queue;
+    std::atomic<bool> drainScheduled{false};
+};
+
+static oslocation::Backpressure OSBackpressureFromDeliveryBackpressure(OSDeliveryBackpressure backpressure) {
+    switch (backpressure) {
+        case OSDeliveryBackpressureDropOldest:
+            return oslocation::Backpressure::DropOldest;
+        case OSDeliveryBackpressureCoalesce:
+            return oslocation::Backpressure::Coalesce;
+        case OSDeliveryBackpressureBlock:
+            return oslocation::Backpressure::Block;
+    }
+    return oslocation::Backpressure::DropOldest;
+}
+
+@implementation OSLocationProvider {
+    oslocation::Pipeline _pipeline;
+    oslocation::FixBuffer _fixBuffer;
+    oslocation::OSTN15Grid _gridShifts;
+    oslocation::OutlierStatistics _outlierStatistics;
+    oslocation::OutlierFilter *_outlierFilter;
+    oslocation::GeofenceEngine _geofences;
+    oslocation::GeofenceStage *_geofenceStage;
+    NSMutableDictionary<NSString *, NSNumber *> *_geofenceIds;
+    NSMutableDictionary<NSNumber *, NSString *> *_geofenceIdentifiers;
+    uint32_t _nextGeofenceId;
+    std::unique_ptr<oslocation::Route> _route;
+    std::unique_ptr<oslocation::RouteMatcher> _routeMatcher;
+    oslocation::RouteMatcherStage *_routeMatcherStage;
+    oslocation::AdaptiveScheduler *_scheduler;
+    oslocation::KalmanFilter *_kalmanFilter;
+    oslocation::TrackSimplifier *_simplifier;
+    oslocation::NationalGridStage *_gridStage;
+    dispatch_source_t _schedulerTimer;
+    oslocation::StayPointDetector *_stayDetector;
+    BOOL _throttledForStay;
+    oslocation::TrackStatistics _trackStatistics;
+    oslocation::TrackStatisticsStage *_trackStatisticsStage;
+    oslocation::TrackStore _recordedTrack;
+    oslocation::SystemClock _journalClock;
+    std::unique_ptr<oslocation::TrackJournalWriter> _journal;
+    std::unique_ptr<oslocation::LastFixCache> _lastFixCache;
+    BOOL _hasLiveLocation;
+    std::shared_ptr<OSDeliveryChannel> _deliveryChannel;
+    std::unique_ptr<oslocation::FrameCoalescer> _frameCoalescer;
+    oslocation::Frame _frame;
+    oslocation::FixBuffer _frameFixes;
+    NSMutableArray<CLLocation *> *_frameLocations;
+    CLHeading *_frameHeading;
+    double _scheduledFrameTime;
+    std::unique_ptr<oslocation::HeadingFilter> _headingFilter;
+    std::unique_ptr<oslocation::NorthConverter> _northConverter;
+    oslocation::PositionPredictor _positionPredictor;
+}
+
+- (CLLocationManager *)coreLocationManager {
+    if (!_coreLocationManager) {
+        _coreLocationManager = [[CLLocationManager alloc] init];
+        _coreLocationManager.delegate = self;
+        _coreLocationManager.distanceFilter = self.distanceFilter;
+        _coreLocationManager.desiredAccuracy = self.desiredAccuracy;
+        _coreLocationManager.activityType = CLActivityTypeFitness;
+    }
+    return _coreLocationManager;
+}
+
+-(instancetype)init {
+    return [self initWithDelegate:nil];
+}
+
+- (instancetype)initWithDelegate:(id<OSLocationProviderDelegate>)delegate {
+    return [self initWithDelegate:delegate options:OSLocationServiceLocationUpdates purpose:OSLocationUpdatePurposeCurrentLocation];
+}
+
+- (instancetype)initWithDelegate:(id<OSLocationProviderDelegate>)delegate options:(OSLocationServiceUpdateOptions)options purpose:(OSLocationUpdatePurpose)purpose {
+    self = [super init];
+    if (self) {
+        _delegate = delegate;
+        _updateOptions = options;
+        _distanceFilter = kCLDistanceFilterNone;
+        _updatePurpose = purpose;
+        _simplificationTolerance = 5;
+        _splitDistance = oslocation::kMetresPerKilometre;
+        _minimumHeadingChange = 1;
+        _minimumLocationChange = 1;
+        _frameLocations = [NSMutableArray array];
+        _scheduledFrameTime = INFINITY;
+        _geofenceIds = [NSMutableDictionary dictionary];
+        _geofenceIdentifiers = [NSMutableDictionary dictionary];
+        _offRouteDistance = oslocation::RouteMatcherOptions().offRouteDistance;
+        _journalSyncInterval = oslocation::TrackJournalOptions().syncInterval;
+        _maximumCachedLocationAge = oslocation::LastFixCacheOptions().maximumAge;
+        [self updateFiltersForPurpose:purpose];
+        if (purpose == OSLocationUpdatePurposeAdaptive) {
+            [self configurePipeline];
+        }
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didEnterBackground:) name:UIApplicationDidEnterBackgroundNotification object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(willEnterForeground:) name:UIApplicationWillEnterForegroundNotification object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(orientationChanged) name:UIDeviceOrientationDidChangeNotification object:nil];
+    }
+    return self;
+}
+
+- (void)updateFiltersForPurpose:(OSLocationUpdatePurpose)purpose {
+    switch (purpose) {
+        case OSLocationUpdatePurposeCurrentLocation:
+            _desiredAccuracy = kCLLocationAccuracyBest;
+            break;
+        case OSLocationUpdatePurposeNavigation:
+            _desiredAccuracy = kCLLocationAccuracyBestForNavigation;
+            break;
+        case OSLocationUpdatePurposeRouteRecording:
+            _desiredAccuracy = kCLLocationAccuracyBestForNavigation;
+            _distanceFilter = 5;
+            break;
+        case OSLocationUpdatePurposeCustom:
+            break;
+        case OSLocationUpdatePurposeAdaptive:
+            // Set by the scheduler when the pipeline is configured
+            break;
+    }
+}
+
+- (void)startLocationServiceUpdatesForAuthorisationStatus:(CLAuthorizationStatus)authorisationStatus {
+    if (self.hasRequestedToUpdateLocation && [OSLocationProvider canProvideLocationUpdates]) {
+        CLAuthorizationStatus existingAuthorisationStatus = [CLLocationManager authorizationStatus];
+        switch (authorisationStatus) {
+            case kCLAuthorizationStatusAuthorizedWhenInUse:
+                if (existingAuthorisationStatus == kCLAuthorizationStatusAuthorizedWhenInUse || existingAuthorisationStatus == kCLAuthorizationStatusAuthorizedAlways) {
+                    [self.coreLocationManager startUpdatingLocation];
+                } else {
+                    [self.coreLocationManager requestWhenInUseAuthorization];
+                }
+                break;
+            case kCLAuthorizationStatusAuthorizedAlways:
+                if (existingAuthorisationStatus == kCLAuthorizationStatusAuthorizedAlways) {
+                    [self.coreLocationManager startUpdatingLocation];
+                } else {
+                    [self.coreLocationManager requestAlwaysAuthorization];
+                }
+                break;
+            case kCLAuthorizationStatusDenied:
+            case kCLAuthorizationStatusNotDetermined:
+            case kCLAuthorizationStatusRestricted:
+                [NSException raise:NSInvalidArgumentException format:@"%@ is an invalid authorisation status. Request either kCLAuthorizationStatusAuthorizedWhenInUse or kCLAuthorizationStatusAuthorizedAlways", @(authorisationStatus)];
+                break;
+        }
+    }
+    if (self.hasRequestedToUpdateHeading && [OSLocationProvider canProvideHeadingUpdates]) {
+        [self.coreLocationManager startUpdatingHeading];
+    }
+    if (_scheduler) {
+        [self startSchedulerTimer];
+    }
+    if (self.hasRequestedToUpdateLocation) {
+        [self deliverProvisionalLocation];
+    }
+}
+
+- (void)stopLocationServiceUpdates {
+    if (self.hasRequestedToUpdateLocation && _coreLocationManager != nil) {
+        [self.coreLocationManager stopUpdatingLocation];
+        [self deliverHeldLocations];
+        if (_journal) {
+            _journal->sync();
+        }
+        if (_lastFixCache) {
+            _lastFixCache->flush();
+        }
+        _hasLiveLocation = NO;
+        _pipeline.reset();
+        [self stopSchedulerTimer];
+        if (_scheduler) {
+            [self applyLocationSettings:_scheduler->settings()];
+        }
+    }
+    if (self.hasRequestedToUpdateHeading && _coreLocationManager != nil) {
+        [self.coreLocationManager stopUpdatingHeading];
+    }
+    [self flushFrame];
+}
+
++ (BOOL)canProvideLocationUpdates {
+    CLAuthorizationStatus authorizationStatus = [CLLocationManager authorizationStatus];
+    return [CLLocationManager locationServicesEnabled] && (authorizationStatus != kCLAuthorizationStatusRestricted || authorizationStatus != kCLAuthorizationStatusDenied);
+}
+
++ (BOOL)canProvideHeadingUpdates {
+    return [CLLocationManager headingAvailable];
+}
+
+- (BOOL)hasRequestedToUpdateLocation {
+    return self.updateOptions & OSLocationServiceLocationUpdates;
+}
+
+- (BOOL)hasRequestedToUpdateHeading {
+    return self.updateOptions & OSLocationServiceHeadingUpdates;
+}
+
+#pragma mark - Setters
+- (void)setDistanceFilter:(CLLocationDistance)distanceFilter {
+    if (_distanceFilter != distanceFilter) {
+        if (self.updatePurpose == OSLocationUpdatePurposeCustom) {
+            _distanceFilter = distanceFilter;
+            self.coreLocationManager.distanceFilter = distanceFilter;
+        } else {
+            NSLog(@"Distance filter not updated. Instantiate the location provider with OSLocationUpdatePurposeCustom to use custom distance filter.");
+        }
+    }
+}
+
+- (void)setDesiredAccuracy:(CLLocationAccuracy)desiredAccuracy {
+    if (_desiredAccuracy != desiredAccuracy) {
+        if (self.updatePurpose == OSLocationUpdatePurposeCustom) {
+            _desiredAccuracy = desiredAccuracy;
+            self.coreLocationManager.desiredAccuracy = desiredAccuracy;
+        } else {
+            NSLog(@"Desired accuracy not updated. Instantiate the location provider with OSLocationUpdatePurposeCustom to use custom desired accuracy");
+        }
+    }
+}
+
+- (void)setContinueUpdatesInBackground:(BOOL)continueUpdatesInBackground {
+    _continueUpdatesInBackground = continueUpdatesInBackground;
+    self.coreLocationManager.allowsBackgroundLocationUpdates = _continueUpdatesInBackground;
+}
+
+- (void)setProcessingOptions:(OSLocationProcessingOptions)processingOptions {
+    if (_processingOptions != processingOptions) {
+        _processingOptions = processingOptions;
+        [self configurePipeline];
+    }
+}
+
+- (OSLocationRejectionCounts)rejectionCounts {
+    oslocation::OutlierStatistics statistics = _outlierStatistics;
+    if (_outlierFilter) {
+        statistics += _outlierFilter->statistics();
+    }
+    OSLocationRejectionCounts counts;
+    counts.invalid = static_cast<NSUInteger>(statistics.rejectedInvalid);
+    counts.speed = static_cast<NSUInteger>(statistics.rejectedSpeed);
+    counts.acceleration = static_cast<NSUInteger>(statistics.rejectedAcceleration);
+    counts.accuracy = static_cast<NSUInteger>(statistics.rejectedAccuracy);
+    return counts;
+}
+
+- (OSTrackStatistics)trackStatistics {
+    const oslocation::TrackSummary &summary = _trackStatistics.summary();
+    OSTrackStatistics statistics;
+    statistics.distance = summary.distance;
+    statistics.ascent = summary.ascent;
+    statistics.descent = summary.descent;
+    statistics.elapsedTime = summary.elapsedTime;
+    statistics.movingTime = summary.movingTime;
+    return statistics;
+}
+
+- (void)setSplitDistance:(CLLocationDistance)splitDistance {
+    if (_splitDistance != splitDistance) {
+        _splitDistance = splitDistance;
+        [self resetTrackStatistics];
+    }
+}
+
+- (void)resetTrackStatistics {
+    oslocation::TrackStatisticsOptions options;
+    options.splitDistance = self.splitDistance;
+    _trackStatistics = oslocation::TrackStatistics(options);
+    if (_trackStatisticsStage) {
+        _trackStatisticsStage->splits().clear();
+    }
+}
+
+- (void)setSimplificationTolerance:(CLLocationDistance)simplificationTolerance {
+    if (_simplificationTolerance != simplificationTolerance) {
+        _simplificationTolerance = simplificationTolerance;
+        [self configurePipeline];
+    }
+}
+
+- (void)setGridConversionMode:(OSGridConversionMode)gridConversionMode {
+    if (_gridConversionMode != gridConversionMode) {
+        _gridConversionMode = gridConversionMode;
+        [self configurePipeline];
+    }
+}
+
+- (void)setGridShiftFilePath:(NSString *)gridShiftFilePath {
+    _gridShiftFilePath = [gridShiftFilePath copy];
+    _gridShifts.close();
+    if (_gridShiftFilePath && !_gridShifts.open(_gridShiftFilePath.fileSystemRepresentation)) {
+        NSLog(@"Could not load the grid shift file at %@. Precise grid conversion will fall back to approximate.", _gridShiftFilePath);
+    }
+}
+
+- (void)setProvidesGridHeadings:(BOOL)providesGridHeadings {
+    _providesGridHeadings = providesGridHeadings;
+    if (!providesGridHeadings) {
+        _northConverter = nullptr;
+    }
+}
+
+- (void)setHeadingSmoothingTimeConstant:(NSTimeInterval)headingSmoothingTimeConstant {
+    if (_headingSmoothingTimeConstant != headingSmoothingTimeConstant) {
+        _headingSmoothingTimeConstant = headingSmoothingTimeConstant;
+        [self configureHeadingFilter];
+    }
+}
+
+- (void)setHeadingDeadBand:(CLLocationDegrees)headingDeadBand {
+    if (_headingDeadBand != headingDeadBand) {
+        _headingDeadBand = headingDeadBand;
+        [self configureHeadingFilter];
+    }
+}
+
+- (void)setFrameInterval:(NSTimeInterval)frameInterval {
+    if (_frameInterval != frameInterval) {
+        _frameInterval = frameInterval;
+        [self configureFrameCoalescer];
+    }
+}
+
+- (void)setMinimumHeadingChange:(CLLocationDegrees)minimumHeadingChange {
+    if (_minimumHeadingChange != minimumHeadingChange) {
+        _minimumHeadingChange = minimumHeadingChange;
+        [self configureFrameCoalescer];
+    }
+}
+
+- (void)setMinimumLocationChange:(CLLocationDistance)minimumLocationChange {
+    if (_minimumLocationChange != minimumLocationChange) {
+        _minimumLocationChange = minimumLocationChange;
+        [self configureFrameCoalescer];
+    }
+}
+
+- (void)setDeliveryQueue:(dispatch_queue_t)deliveryQueue {
+    _deliveryQueue = deliveryQueue == dispatch_get_main_queue() ? nil : deliveryQueue;
+    [self configureDeliveryChannel];
+}
+
+- (void)setDeliveryBackpressure:(OSDeliveryBackpressure)deliveryBackpressure {
+    if (_deliveryBackpressure != deliveryBackpressure) {
+        _deliveryBackpressure = deliveryBackpressure;
+        [self configureDeliveryChannel];
+    }
+}
+
+#pragma mark - Geofences
+- (BOOL)addGeofenceWithIdentifier:(NSString *)identifier center:(CLLocationCoordinate2D)center radius:(CLLocationDistance)radius {
+    if (!CLLocationCoordinate2DIsValid(center)) {
+        return NO;
+    }
+    const oslocation::GridPosition position = oslocation::approximateNationalGrid(center.latitude, center.longitude, 0);
+    if (!_geofences.addCircle(_nextGeofenceId, position.easting, position.northing, radius)) {
+        return NO;
+    }
+    [self replaceGeofenceIdentifier:identifier withId:_nextGeofenceId++];
+    return YES;
+}
+
+- (BOOL)addGeofenceWithIdentifier:(NSString *)identifier coordinates:(const CLLocationCoordinate2D *)coordinates count:(NSUInteger)count {
+    std::vector<double> eastings(count);
+    std::vector<double> northings(count);
+    for (NSUInteger i = 0; i < count; i++) {
+        if (!CLLocationCoordinate2DIsValid(coordinates[i])) {
+            return NO;
+        }
+        const oslocation::GridPosition position = oslocation::approximateNationalGrid(coordinates[i].latitude, coordinates[i].longitude, 0);
+        eastings[i] = position.easting;
+        northings[i] = position.northing;
+    }
+    if (!_geofences.addPolygon(_nextGeofenceId, eastings.data(), northings.data(), count)) {
+        return NO;
+    }
+    [self replaceGeofenceIdentifier:identifier withId:_nextGeofenceId++];
+    return YES;
+}
+
+/**
+ *  Points the identifier at a fence just added, removing any fence it named
+ *  before. A shape that fails to add leaves the old fence in place.
+ */
+- (void)replaceGeofenceIdentifier:(NSString *)identifier withId:(uint32_t)fenceId {
+    [self removeGeofenceWithIdentifier:identifier];
+    NSString *key = [identifier copy];
+    _geofenceIds[key] = @(fenceId);
+    _geofenceIdentifiers[@(fenceId)] = key;
+    if (!_geofenceStage) {
+        [self configurePipeline];
+    }
+}
+
+- (void)removeGeofenceWithIdentifier:(NSString *)identifier {
+    NSNumber *fenceId = _geofenceIds[identifier];
+    if (!fenceId) {
+        return;
+    }
+    _geofences.remove(fenceId.unsignedIntValue);
+    [_geofenceIds removeObjectForKey:identifier];
+    [_geofenceIdentifiers removeObjectForKey:fenceId];
+    if (_geofences.fenceCount() == 0) {
+        [self configurePipeline];
+    }
+}
+
+- (void)removeAllGeofences {
+    _geofences.removeAll();
+    [_geofenceIds removeAllObjects];
+    [_geofenceIdentifiers removeAllObjects];
+    [self configurePipeline];
+}
+
+/**
+ *  Reports the transitions found by the geofence stage since the last call
+ */
+- (void)deliverGeofenceEvents {
+    if (!_geofenceStage || _geofenceStage->events().empty()) {
+        return;
+    }
+    std::vector<oslocation::GeofenceEvent> events;
+    events.swap(_geofenceStage->events());
+    if (![self.delegate respondsToSelector:@selector(locationProvider:didTransitionGeofence:transition:)]) {
+        return;
+    }
+    for (const oslocation::GeofenceEvent &event : events) {
+        NSString *identifier = _geofenceIdentifiers[@(event.fenceId)];
+        if (!identifier) {
+            continue;
+        }
+        OSGeofenceTransition transition;
+        switch (event.transition) {
+            case oslocation::GeofenceTransition::Enter:
+                transition = OSGeofenceTransitionEnter;
+                break;
+            case oslocation::GeofenceTransition::Exit:
+                transition = OSGeofenceTransitionExit;
+                break;
+            case oslocation::GeofenceTransition::Dwell:
+                transition = OSGeofenceTransitionDwell;
+                break;
+        }
+        [self.delegate locationProvider:self didTransitionGeofence:identifier transition:transition];
+    }
+}
+
+#pragma mark - Routes
+- (BOOL)setRouteWithCoordinates:(const CLLocationCoordinate2D *)coordinates count:(NSUInteger)count {
+    std::vector<double> latitudes(count), longitudes(count);
+    for (NSUInteger i = 0; i < count; i++) {
+        latitudes[i] = coordinates[i].latitude;
+        longitudes[i] = coordinates[i].longitude;
+    }
+    auto route = std::make_unique<oslocation::Route>();
+    if (!route->assign(latitudes.data(), longitudes.data(), count)) {
+        return NO;
+    }
+    // The old route outlives the rebuild, which flushes the last locations
+    // through its matcher
+    _route.swap(route);
+    [self configureRouteMatcher];
+    return YES;
+}
+
+- (BOOL)setRouteWithContentsOfGPXFile:(NSString *)path {
+    auto route = std::make_unique<oslocation::Route>();
+    if (route->loadGPX(path.fileSystemRepresentation).status != oslocation::GPXStatus::Ok || route->segmentCount() == 0) {
+        return NO;
+    }
+    // The old route outlives the rebuild, which flushes the last locations
+    // through its matcher
+    _route.swap(route);
+    [self configureRouteMatcher];
+    return YES;
+}
+
+- (void)removeRoute {
+    std::unique_ptr<oslocation::Route> route = std::move(_route);
+    std::unique_ptr<oslocation::RouteMatcher> matcher = std::move(_routeMatcher);
+    [self configurePipeline];
+    _routeProgress = OSRouteProgress();
+}
+
+- (void)setOffRouteDistance:(CLLocationDistance)offRouteDistance {
+    if (_offRouteDistance != offRouteDistance) {
+        _offRouteDistance = offRouteDistance;
+        if (_route) {
+            [self configureRouteMatcher];
+        }
+    }
+}
+
+/**
+ *  Starts matching the route afresh with the current settings. The stage
+ *  using the old matcher is replaced before it sees another location, once
+ *  the locations it was holding back have been delivered.
+ */
+- (void)configureRouteMatcher {
+    oslocation::RouteMatcherOptions options;
+    options.offRouteDistance = self.offRouteDistance;
+    options.rejoinDistance = self.offRouteDistance / 2;
+    std::unique_ptr<oslocation::RouteMatcher> previous = std::move(_routeMatcher);
+    _routeMatcher = std::make_unique<oslocation::RouteMatcher>(*_route, options);
+    [self configurePipeline];
+    _routeProgress = OSRouteProgress();
+}
+
+/**
+ *  Reports the transitions and latest progress found by the route matcher
+ *  stage since the last call
+ */
+- (void)deliverRouteProgress {
+    if (!_routeMatcherStage) {
+        return;
+    }
+    std::vector<oslocation::RouteEvent> events;
+    events.swap(_routeMatcherStage->events());
+    if (!_routeMatcherStage->hasProgress()) {
+        return;
+    }
+    const oslocation::RouteProgress progress = _routeMatcherStage->takeProgress();
+    _routeProgress.distanceAlongRoute = progress.distanceAlongRoute;
+    _routeProgress.crossTrackError = progress.crossTrackError;
+    _routeProgress.remainingDistance = progress.remainingDistance;
+    _routeProgress.onRoute = progress.onRoute;
+    if ([self.delegate respondsToSelector:@selector(locationProvider:didTransitionRoute:date:)]) {
+        for (const oslocation::RouteEvent &event : events) {
+            const OSRouteTransition transition = event.transition == oslocation::RouteTransition::OnRoute ? OSRouteTransitionOnRoute : OSRouteTransitionOffRoute;
+            [self.delegate locationProvider:self didTransitionRoute:transition date:[NSDate dateWithTimeIntervalSince1970:event.timestamp]];
+        }
+    }
+    if ([self.delegate respondsToSelector:@selector(locationProvider:didUpdateRouteProgress:)]) {
+        [self.delegate locationProvider:self didUpdateRouteProgress:_routeProgress];
+    }
+}
+
+#pragma mark - Adaptive updates
+- (void)applyLocationSettings:(const oslocation::LocationSettings &)settings {
+    _desiredAccuracy = OSAccuracyFromLocationAccuracy(settings.accuracy);
+    _distanceFilter = settings.distanceFilter > 0 ? settings.distanceFilter : kCLDistanceFilterNone;
+    _coreLocationManager.desiredAccuracy = _desiredAccuracy;
+    _coreLocationManager.distanceFilter = _distanceFilter;
+}
+
+/**
+ *  Applies the scheduler's settings if it has changed state since they were
+ *  last applied
+ */
+- (void)applyScheduledSettings {
+    if (!_scheduler || _scheduler->log().empty()) {
+        return;
+    }
+    _scheduler->clearLog();
+    const oslocation::LocationSettings &settings = _scheduler->settings();
+    [self applyLocationSettings:settings];
+    if (self.hasRequestedToUpdateHeading && [OSLocationProvider canProvideHeadingUpdates]) {
+        if (settings.headingUpdates) {
+            [self.coreLocationManager startUpdatingHeading];
+        } else {
+            [self.coreLocationManager stopUpdatingHeading];
+        }
+    }
+}
+
+- (void)startSchedulerTimer {
+    if (_schedulerTimer) {
+        return;
+    }
+    _schedulerTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_main_queue());
+    dispatch_source_set_timer(_schedulerTimer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kSchedulerTickInterval * NSEC_PER_SEC)), (uint64_t)(kSchedulerTickInterval * NSEC_PER_SEC), NSEC_PER_SEC);
+    __weak OSLocationProvider *weakSelf = self;
+    dispatch_source_set_event_handler(_schedulerTimer, ^{
+        OSLocationProvider *provider = weakSelf;
+        if (provider && provider->_scheduler) {
+            provider->_scheduler->tick([NSDate date].timeIntervalSince1970);
+            [provider applyScheduledSettings];
+        }
+    });
+    dispatch_resume(_schedulerTimer);
+}
+
+- (void)stopSchedulerTimer {
+    if (_schedulerTimer) {
+        dispatch_source_cancel(_schedulerTimer);
+        _schedulerTimer = nil;
+    }
+}
+
+#pragma mark - Stays
+/**
+ *  Reports the stays begun and ended since the last call, throttling
+ *  updates during them if asked to
+ */
+- (void)deliverStayEvents {
+    if (!_stayDetector || _stayDetector->events().empty()) {
+        return;
+    }
+    std::vector<oslocation::StayEvent> events;
+    events.swap(_stayDetector->events());
+    for (const oslocation::StayEvent &event : events) {
+        CLLocation *location = [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(event.stay.latitude, event.stay.longitude)
+                                                             altitude:0
+                                                   horizontalAccuracy:event.stay.spread
+                                                     verticalAccuracy:-1
+                                                            timestamp:[NSDate dateWithTimeIntervalSince1970:event.stay.arrival]];
+        if (event.type == oslocation::StayEventType::Began) {
+            [self throttleUpdatesForStay:YES];
+            if ([self.delegate respondsToSelector:@selector(locationProvider:didBeginStayAtLocation:)]) {
+                [self.delegate locationProvider:self didBeginStayAtLocation:location];
+            }
+        } else {
+            [self throttleUpdatesForStay:NO];
+            if ([self.delegate respondsToSelector:@selector(locationProvider:didEndStayAtLocation:departureDate:)]) {
+                [self.delegate locationProvider:self didEndStayAtLocation:location departureDate:[NSDate dateWithTimeIntervalSince1970:event.stay.departure]];
+            }
+        }
+    }
+}
+
+- (void)throttleUpdatesForStay:(BOOL)throttle {
+    if (throttle == _throttledForStay) {
+        return;
+    }
+    if (throttle && (!self.throttlesUpdatesDuringStays || self.updatePurpose == OSLocationUpdatePurposeAdaptive)) {
+        return;
+    }
+    _throttledForStay = throttle;
+    if (throttle) {
+        // Updates beyond the departure radius are all that can end the stay
+        const oslocation::StayPointOptions options;
+        _coreLocationManager.desiredAccuracy = kCLLocationAccuracyHundredMeters;
+        _coreLocationManager.distanceFilter = MAX(self.distanceFilter, options.departureRadius);
+    } else {
+        _coreLocationManager.desiredAccuracy = self.desiredAccuracy;
+        _coreLocationManager.distanceFilter = self.distanceFilter;
+    }
+}
+
+#pragma mark - Track statistics
+/**
+ *  Reports the splits completed since the last call
+ */
+- (void)deliverTrackSplits {
+    if (!_trackStatisticsStage || _trackStatisticsStage->splits().empty()) {
+        return;
+    }
+    std::vector<oslocation::TrackSplit> splits;
+    splits.swap(_trackStatisticsStage->splits());
+    if (![self.delegate respondsToSelector:@selector(locationProvider:didCompleteSplit:date:)]) {
+        return;
+    }
+    for (const oslocation::TrackSplit &split : splits) {
+        OSTrackSplit completed;
+        completed.number = split.number;
+        completed.distance = split.distance;
+        completed.elapsedTime = split.elapsedTime;
+        completed.movingTime = split.movingTime;
+        completed.ascent = split.ascent;
+        completed.descent = split.descent;
+        [self.delegate locationProvider:self didCompleteSplit:completed date:[NSDate dateWithTimeIntervalSince1970:split.timestamp]];
+    }
+}
+
+#pragma mark - Recorded track
+- (NSUInteger)recordedLocationCount {
+    return _recordedTrack.size();
+}
+
+- (CLLocation *)recordedLocationAtIndex:(NSUInteger)index {
+    if (index >= _recordedTrack.size()) {
+        [NSException raise:NSRangeException format:@"Index %lu beyond recorded track of %lu locations", (unsigned long)index, (unsigned long)_recordedTrack.size()];
+    }
+    return OSLocationFromFix(_recordedTrack[index]);
+}
+
+- (NSUInteger)getRecordedCoordinates:(CLLocationCoordinate2D *)coordinates range:(NSRange)range {
+    const oslocation::TrackView view = _recordedTrack.view();
+    const NSUInteger end = MIN(NSMaxRange(range), view.size());
+    NSUInteger copied = 0;
+    for (NSUInteger index = range.location; index < end;) {
+        // A chunk's columns at a time rather than gathering whole fixes
+        const oslocation::TrackColumns columns = view.chunk(index / oslocation::kTrackChunkSize);
+        NSUInteger offset = index % oslocation::kTrackChunkSize;
+        for (; offset < columns.count && index < end; offset++, index++) {
+            coordinates[copied++] = CLLocationCoordinate2DMake(columns.latitudes[offset], columns.longitudes[offset]);
+        }
+    }
+    return copied;
+}
+
+- (void)clearRecordedTrack {
+    _recordedTrack.clear();
+}
+
+#pragma mark - Journal
+- (BOOL)isJournaling {
+    return _journal != nullptr;
+}
+
+- (BOOL)startJournalingToFileAtPath:(NSString *)path {
+    [self stopJournaling];
+    oslocation::TrackJournalOptions options;
+    options.syncInterval = self.journalSyncInterval;
+    auto journal = std::make_unique<oslocation::TrackJournalWriter>(_journalClock, options);
+    if (!journal->open(path.fileSystemRepresentation)) {
+        return NO;
+    }
+    _journal = std::move(journal);
+    return YES;
+}
+
+- (void)stopJournaling {
+    if (_journal) {
+        _journal->close();
+        _journal = nullptr;
+    }
+}
+
++ (NSArray<CLLocation *> *)locationsFromJournalAtPath:(NSString *)path {
+    oslocation::FixBuffer fixes;
+    oslocation::JournalRecovery recovery;
+    if (!oslocation::recoverTrackJournal(path.fileSystemRepresentation, &fixes, recovery)) {
+        return nil;
+    }
+    NSMutableArray<CLLocation *> *locations = [NSMutableArray arrayWithCapacity:fixes.size()];
+    for (const oslocation::Fix &fix : fixes) {
+        [locations addObject:OSLocationFromFix(fix)];
+    }
+    return locations;
+}
+
+#pragma mark - Last location cache
+- (void)setLastLocationCachePath:(NSString *)lastLocationCachePath {
+    _lastLocationCachePath = [lastLocationCachePath copy];
+    [self configureLastFixCache];
+}
+
+- (void)setMaximumCachedLocationAge:(NSTimeInterval)maximumCachedLocationAge {
+    if (_maximumCachedLocationAge != maximumCachedLocationAge) {
+        _maximumCachedLocationAge = maximumCachedLocationAge;
+        [self configureLastFixCache];
+    }
+}
+
+- (void)configureLastFixCache {
+    // Destroying the old cache writes out anything it still holds
+    _lastFixCache = nullptr;
+    if (!self.lastLocationCachePath) {
+        return;
+    }
+    oslocation::LastFixCacheOptions options;
+    options.maximumAge = self.maximumCachedLocationAge;
+    _lastFixCache = std::make_unique<oslocation::LastFixCache>(options);
+    _lastFixCache->open(self.lastLocationCachePath.fileSystemRepresentation);
+}
+
+/**
+ *  Reports the cached location until the first live one arrives. The
+ *  position predictor starts from it, so predictions ease from the cached
+ *  position onto the first live location rather than jumping.
+ */
+- (void)deliverProvisionalLocation {
+    oslocation::Fix fix;
+    if (_hasLiveLocation || !_lastFixCache || !_lastFixCache->provisionalFix([NSDate date].timeIntervalSince1970, fix)) {
+        return;
+    }
+    _positionPredictor.update(fix);
+    if ([self.delegate respondsToSelector:@selector(locationProvider:didUpdateProvisionalLocation:)]) {
+        [self.delegate locationProvider:self didUpdateProvisionalLocation:OSLocationFromFix(fix)];
+    }
+}
+
+#pragma mark - Delivery
+/**
+ *  Replaces the buffer feeding `deliveryQueue`. Anything waiting in the
+ *  old one is still delivered by the drain already scheduled for it.
+ */
+- (void)configureDeliveryChannel {
+    if (self.deliveryQueue) {
+        _deliveryChannel = std::make_shared<OSDeliveryChannel>(OSBackpressureFromDeliveryBackpressure(self.deliveryBackpressure));
+        // A batch bigger than the buffer fills it before `sendLocations`
+        // schedules its drain, so a blocked push has to schedule one itself
+        __weak OSLocationProvider *weakSelf = self;
+        _deliveryChannel->queue.setWakeHandler([weakSelf] {
+            [weakSelf scheduleDrain];
+        });
+    } else {
+        _deliveryChannel = nullptr;
+    }
+}
+
+/**
+ *  Delivers locations to the delegate, as part of a frame if frames are on
+ */
+- (void)deliverLocations:(NSArray<CLLocation *> *)locations {
+    [locations enumerateObjectsUsingBlock:^(CLLocation *location, NSUInteger idx, BOOL *stop) {
+        const oslocation::Fix fix = OSFixFromLocation(location, idx);
+        self->_positionPredictor.update(fix);
+        if (self.recordsTrack) {
+            self->_recordedTrack.append(fix);
+        }
+        if (self->_journal) {
+            self->_journal->append(fix);
+        }
+        if (self->_lastFixCache) {
+            self->_lastFixCache->update(fix);
+        }
+    }];
+    _hasLiveLocation = _hasLiveLocation || locations.count > 0;
+    if (_frameCoalescer) {
+        [self addLocationsToFrame:locations];
+    } else {
+        [self sendLocations:locations heading:nil];
+    }
+}
+
+- (void)deliverHeading:(CLHeading *)heading {
+    _positionPredictor.updateHeading(OSCoreHeadingFromHeading(heading));
+    if (_frameCoalescer) {
+        [self addHeadingToFrame:heading];
+    } else {
+        [self sendLocations:nil heading:heading];
+    }
+}
+
+/**
+ *  Passes locations and then a heading to the delegate, directly or through
+ *  `deliveryQueue`
+ */
+- (void)sendLocations:(NSArray<CLLocation *> *)locations heading:(CLHeading *)heading {
+    if (!_deliveryChannel) {
+        [self deliverToDelegateLocations:locations heading:heading combined:_frameCoalescer != nullptr];
+        return;
+    }
+    const double now = [NSProcessInfo processInfo].systemUptime;
+    [locations enumerateObjectsUsingBlock:^(CLLocation *location, NSUInteger idx, BOOL *stop) {
+        self->_deliveryChannel->queue.push(oslocation::makeRecord(OSFixFromLocation(location, idx), now));
+    }];
+    if (heading) {
+        _deliveryChannel->queue.push(oslocation::makeRecord(OSCoreHeadingFromHeading(heading), now));
+    }
+    [self scheduleDrain];
+}
+
+/**
+ *  Schedules a drain of the delivery buffer on `deliveryQueue` unless one is
+ *  already pending
+ */
+- (void)scheduleDrain {
+    std::shared_ptr<OSDeliveryChannel> channel = _deliveryChannel;
+    if (channel->drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    const BOOL combined = _frameCoalescer != nullptr;
+    __weak OSLocationProvider *weakSelf = self;
+    dispatch_async(self.deliveryQueue, ^{
+        // Cleared first so anything pushed from here on schedules another drain
+        channel->drainScheduled.store(false, std::memory_order_release);
+        OSLocationProvider *provider = weakSelf;
+        NSMutableArray<CLLocation *> *locations = [NSMutableArray array];
+        oslocation::DeliveryRecord record;
+        while (channel->queue.pop(record)) {
+            if (record.type == oslocation::RecordType::Fix) {
+                [locations addObject:OSLocationFromFix(record.fix)];
+                continue;
+            }
+            // A heading closes a frame, after the locations that came before it
+            [provider deliverToDelegateLocations:(locations.count > 0 ? locations : nil) heading:OSHeadingFromCoreHeading(record.heading) combined:combined];
+            locations = [NSMutableArray array];
+        }
+        if (locations.count > 0) {
+            [provider deliverToDelegateLocations:locations heading:nil combined:combined];
+        }
+    });
+}
+
+/**
+ *  Calls the delegate with either or both of locations and a heading, in a
+ *  single callback if `combined` and the delegate takes one
+ */
+- (void)deliverToDelegateLocations:(NSArray<CLLocation *> *)locations heading:(CLHeading *)heading combined:(BOOL)combined {
+    id<OSLocationProviderDelegate> delegate = self.delegate;
+    if (combined && [delegate respondsToSelector:@selector(locationProvider:didUpdateLocations:heading:)]) {
+        [delegate locationProvider:self didUpdateLocations:locations ?: @[] heading:heading];
+        return;
+    }
+    if (locations && [delegate respondsToSelector:@selector(locationProvider:didUpdateLocations:)]) {
+        [delegate locationProvider:self didUpdateLocations:locations];
+    }
+    if (heading && [delegate respondsToSelector:@selector(locationProvider:didUpdateHeading:)]) {
+        [delegate locationProvider:self didUpdateHeading:heading];
+    }
+}
+
+#pragma mark - Prediction
+- (CLLocationCoordinate2D)predictedCoordinateAtDate:(NSDate *)date {
+    CLLocationCoordinate2D coordinate;
+    if (!_positionPredictor.predict(date.timeIntervalSince1970, coordinate.latitude, coordinate.longitude)) {
+        return kCLLocationCoordinate2DInvalid;
+    }
+    return coordinate;
+}
+
+#pragma mark - Headings
+/**
+ *  Adds the grid heading, and the true heading if missing, for the last
+ *  known location
+ */
+- (oslocation::Heading)headingWithGridNorth:(const oslocation::Heading &)heading {
+    CLLocation *location = self.coreLocationManager.location;
+    if (!location || location.horizontalAccuracy < 0) {
+        return heading;
+    }
+    const double now = oslocation::MagneticModel::decimalYearForTime(heading.timestamp);
+    if (!_northConverter || fabs(now - _northConverter->model().decimalYear()) > kMagneticModelLifetime) {
+        _northConverter = std::make_unique<oslocation::NorthConverter>(oslocation::MagneticModel(now));
+    }
+    return _northConverter->apply(heading, location.coordinate.latitude, location.coordinate.longitude);
+}
+
+- (void)configureHeadingFilter {
+    if (self.headingSmoothingTimeConstant > 0 || self.headingDeadBand > 0) {
+        oslocation::HeadingFilterOptions options;
+        options.timeConstant = self.headingSmoothingTimeConstant;
+        options.deadBand = self.headingDeadBand;
+        _headingFilter = std::make_unique<oslocation::HeadingFilter>(options);
+    } else {
+        _headingFilter = nullptr;
+    }
+}
+
+#pragma mark - Frames
+/**
+ *  Replaces the frame coalescer after delivering anything it holds
+ */
+- (void)configureFrameCoalescer {
+    [self flushFrame];
+    if (self.frameInterval > 0) {
+        oslocation::FrameOptions options;
+        options.frameInterval = self.frameInterval;
+        options.minimumHeadingChange = self.minimumHeadingChange;
+        options.minimumDistance = self.minimumLocationChange;
+        options.maximumDelay = kFrameMaximumDelay;
+        _frameCoalescer = std::make_unique<oslocation::FrameCoalescer>(options);
+    } else {
+        _frameCoalescer = nullptr;
+    }
+}
+
+- (void)addLocationsToFrame:(NSArray<CLLocation *> *)locations {
+    _frameFixes.clear();
+    [locations enumerateObjectsUsingBlock:^(CLLocation *location, NSUInteger idx, BOOL *stop) {
+        self->_frameFixes.push_back(OSFixFromLocation(location, idx));
+    }];
+    _frameCoalescer->addFixes(_frameFixes, [NSProcessInfo processInfo].systemUptime);
+    [_frameLocations addObjectsFromArray:locations];
+    [self scheduleFrame];
+}
+
+- (void)addHeadingToFrame:(CLHeading *)heading {
+    _frameCoalescer->addHeading(OSCoreHeadingFromHeading(heading), [NSProcessInfo processInfo].systemUptime);
+    _frameHeading = heading;
+    [self scheduleFrame];
+}
+
+/**
+ *  Arranges for the next frame to be delivered when it falls due, unless
+ *  one is already arranged for then or earlier
+ */
+- (void)scheduleFrame {
+    const double due = _frameCoalescer->nextFrameTime();
+    if (isinf(due) || due >= _scheduledFrameTime) {
+        return;
+    }
+    _scheduledFrameTime = due;
+    const double delay = MAX(0, due - [NSProcessInfo processInfo].systemUptime);
+    __weak OSLocationProvider *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        OSLocationProvider *provider = weakSelf;
+        if (!provider) {
+            return;
+        }
+        if (provider->_scheduledFrameTime == due) {
+            provider->_scheduledFrameTime = INFINITY;
+        }
+        [provider deliverFrame];
+    });
+}
+
+- (void)deliverFrame {
+    if (!_frameCoalescer) {
+        return;
+    }
+    if (_frameCoalescer->takeFrame([NSProcessInfo processInfo].systemUptime, _frame)) {
+        [self sendFrame];
+    }
+    [self scheduleFrame];
+}
+
+/**
+ *  Delivers whatever the current frame holds without waiting for it to
+ *  fall due, as when updates stop
+ */
+- (void)flushFrame {
+    if (_frameCoalescer && _frameCoalescer->flush(_frame)) {
+        [self sendFrame];
+    }
+}
+
+- (void)sendFrame {
+    NSArray<CLLocation *> *locations = _frameLocations.count > 0 ? _frameLocations : nil;
+    CLHeading *heading = _frame.hasHeading ? _frameHeading : nil;
+    _frameLocations = [NSMutableArray array];
+    _frameHeading = nil;
+    [self sendLocations:locations heading:heading];
+}
+
+#pragma mark - Processing
+/**
+ *  Rebuilds the processing pipeline from the current configuration. Stages
+ *  run in the order they are added here. Stages whose settings have not
+ *  changed carry over with their state, and before any stage is dropped the
+ *  locations and events the pipeline holds are delivered.
+ */
+- (void)configurePipeline {
+    const OSLocationProcessingOptions options = self.processingOptions;
+    oslocation::GridConversion conversion = oslocation::GridConversion::None;
+    switch (self.gridConversionMode) {
+        case OSGridConversionModeNone:
+            break;
+        case OSGridConversionModeApproximate:
+            conversion = oslocation::GridConversion::Approximate;
+            break;
+        case OSGridConversionModePrecise:
+            conversion = oslocation::GridConversion::Precise;
+            break;
+    }
+    const BOOL usesOutlierFilter = (options & OSLocationProcessingRejectOutliers) != 0;
+    const BOOL usesKalmanFilter = (options & OSLocationProcessingSmoothing) != 0;
+    const BOOL usesGeofenceStage = _geofences.fenceCount() > 0;
+    // A new matcher needs a new stage
+    const BOOL keepsRouteMatcherStage = _routeMatcherStage && &_routeMatcherStage->matcher() == _routeMatcher.get();
+    const BOOL usesStayDetector = (options & OSLocationProcessingCollapseStays) != 0;
+    const BOOL usesTrackStatisticsStage = (options & OSLocationProcessingTrackStatistics) != 0;
+    const BOOL keepsSimplifier = (options & OSLocationProcessingSimplify) && _simplifier && _simplifier->tolerance() == self.simplificationTolerance;
+    const BOOL keepsGridStage = _gridStage && _gridStage->conversion() == conversion;
+
+    const BOOL dropsStage = (_outlierFilter && !usesOutlierFilter) || (_kalmanFilter && !usesKalmanFilter) ||
+                            (_geofenceStage && !usesGeofenceStage) || (_routeMatcherStage && !keepsRouteMatcherStage) ||
+                            (_stayDetector && !usesStayDetector) || (_trackStatisticsStage && !usesTrackStatisticsStage) ||
+                            (_simplifier && !keepsSimplifier) || (_gridStage && !keepsGridStage);
+    if (dropsStage) {
+        [self deliverHeldLocations];
+    }
+
+    // Take out the stages being kept, then discard the rest
+    std::unique_ptr<oslocation::Stage> outlierFilter = usesOutlierFilter ? _pipeline.removeStage(_outlierFilter) : nullptr;
+    std::unique_ptr<oslocation::Stage> scheduler = _pipeline.removeStage(_scheduler);
+    std::unique_ptr<oslocation::Stage> kalmanFilter = usesKalmanFilter ? _pipeline.removeStage(_kalmanFilter) : nullptr;
+    std::unique_ptr<oslocation::Stage> geofenceStage = usesGeofenceStage ? _pipeline.removeStage(_geofenceStage) : nullptr;
+    std::unique_ptr<oslocation::Stage> routeMatcherStage = keepsRouteMatcherStage ? _pipeline.removeStage(_routeMatcherStage) : nullptr;
+    std::unique_ptr<oslocation::Stage> stayDetector = usesStayDetector ? _pipeline.removeStage(_stayDetector) : nullptr;
+    std::unique_ptr<oslocation::Stage> trackStatisticsStage = usesTrackStatisticsStage ? _pipeline.removeStage(_trackStatisticsStage) : nullptr;
+    std::unique_ptr<oslocation::Stage> simplifier = keepsSimplifier ? _pipeline.removeStage(_simplifier) : nullptr;
+    std::unique_ptr<oslocation::Stage> gridStage = keepsGridStage ? _pipeline.removeStage(_gridStage) : nullptr;
+    // Dropping the filter loses its counts, so bank them first
+    if (_outlierFilter && !outlierFilter) {
+        _outlierStatistics += _outlierFilter->statistics();
+    }
+    if (_stayDetector && !stayDetector) {
+        [self throttleUpdatesForStay:NO];
+    }
+    _pipeline.removeAllStages();
+
+    if (outlierFilter) {
+        _pipeline.addStage(std::move(outlierFilter));
+    } else if (usesOutlierFilter) {
+        _outlierFilter = _pipeline.addStage(std::make_unique<oslocation::OutlierFilter>());
+    } else {
+        _outlierFilter = nullptr;
+    }
+    // The scheduler sees outliers removed but positions as reported
+    if (scheduler) {
+        _pipeline.addStage(std::move(scheduler));
+    } else if (self.updatePurpose == OSLocationUpdatePurposeAdaptive) {
+        _scheduler = _pipeline.addStage(std::make_unique<oslocation::AdaptiveScheduler>());
+        [self applyLocationSettings:_scheduler->settings()];
+    } else {
+        _scheduler = nullptr;
+    }
+    if (kalmanFilter) {
+        _pipeline.addStage(std::move(kalmanFilter));
+    } else if (usesKalmanFilter) {
+        _kalmanFilter = _pipeline.addStage(std::make_unique<oslocation::KalmanFilter>());
+    } else {
+        _kalmanFilter = nullptr;
+    }
+    // Geofences see every smoothed location, before simplification drops any
+    if (geofenceStage) {
+        _pipeline.addStage(std::move(geofenceStage));
+    } else if (usesGeofenceStage) {
+        _geofenceStage = _pipeline.addStage(std::make_unique<oslocation::GeofenceStage>(_geofences));
+    } else {
+        _geofenceStage = nullptr;
+    }
+    // The route is matched alongside geofences, before stays hold locations back
+    if (routeMatcherStage) {
+        _pipeline.addStage(std::move(routeMatcherStage));
+    } else if (_routeMatcher) {
+        _routeMatcherStage = _pipeline.addStage(std::make_unique<oslocation::RouteMatcherStage>(*_routeMatcher));
+    } else {
+        _routeMatcherStage = nullptr;
+    }
+    // Stays collapse after geofences so dwell transitions still see every location
+    if (stayDetector) {
+        _pipeline.addStage(std::move(stayDetector));
+    } else if (usesStayDetector) {
+        _stayDetector = _pipeline.addStage(std::make_unique<oslocation::StayPointDetector>());
+    } else {
+        _stayDetector = nullptr;
+    }
+    // Statistics see the track as it happened, before simplification
+    if (trackStatisticsStage) {
+        _pipeline.addStage(std::move(trackStatisticsStage));
+    } else if (usesTrackStatisticsStage) {
+        _trackStatisticsStage = _pipeline.addStage(std::make_unique<oslocation::TrackStatisticsStage>(_trackStatistics));
+    } else {
+        _trackStatisticsStage = nullptr;
+    }
+    if (simplifier) {
+        _pipeline.addStage(std::move(simplifier));
+    } else if (options & OSLocationProcessingSimplify) {
+        _simplifier = _pipeline.addStage(std::make_unique<oslocation::TrackSimplifier>(self.simplificationTolerance));
+    } else {
+        _simplifier = nullptr;
+    }
+    // Grid conversion comes last so it sees the final positions
+    if (gridStage) {
+        _pipeline.addStage(std::move(gridStage));
+    } else if (conversion != oslocation::GridConversion::None) {
+        const oslocation::OSTN15Grid *grid = conversion == oslocation::GridConversion::Precise ? &_gridShifts : nullptr;
+        _gridStage = _pipeline.addStage(std::make_unique<oslocation::NationalGridStage>(conversion, grid));
+    } else {
+        _gridStage = nullptr;
+    }
+}
+
+- (NSArray<CLLocation *> *)processedLocations:(NSArray<CLLocation *> *)locations {
+    if (_pipeline.empty()) {
+        return locations;
+    }
+    _fixBuffer.clear();
+    [locations enumerateObjectsUsingBlock:^(CLLocation *location, NSUInteger idx, BOOL *stop) {
+        self->_fixBuffer.push_back(OSFixFromLocation(location, idx));
+    }];
+    _pipeline.process(_fixBuffer);
+
+    BOOL unchanged = _fixBuffer.size() == locations.count && self.gridConversionMode == OSGridConversionModeNone;
+    for (NSUInteger i = 0; unchanged && i < _fixBuffer.size(); i++) {
+        unchanged = _fixBuffer[i].sourceIndex == static_cast<int32_t>(i) && _fixBuffer[i].flags == oslocation::FixFlagNone;
+    }
+    if (unchanged) {
+        return locations;
+    }
+
+    NSMutableArray<CLLocation *> *processed = [NSMutableArray arrayWithCapacity:_fixBuffer.size()];
+    for (const oslocation::Fix &fix : _fixBuffer) {
+        BOOL isOriginal = !oslocation::hasGridPosition(fix) && fix.sourceIndex >= 0 && fix.sourceIndex < static_cast<int32_t>(locations.count) && !(fix.flags & oslocation::FixFlagModified);
+        [processed addObject:isOriginal ? locations[fix.sourceIndex] : OSLocationFromFix(fix)];
+    }
+    return processed;
+}
+
+/**
+ *  Delivers the locations stages are holding back, such as the end of a
+ *  simplified track
+ */
+- (void)deliverHeldLocations {
+    _pipeline.flush(_fixBuffer);
+    if (_fixBuffer.empty()) {
+        [self deliverGeofenceEvents];
+        [self deliverRouteProgress];
+        [self deliverStayEvents];
+        [self deliverTrackSplits];
+        return;
+    }
+    NSMutableArray<CLLocation *> *locations = [NSMutableArray arrayWithCapacity:_fixBuffer.size()];
+    for (const oslocation::Fix &fix : _fixBuffer) {
+        [locations addObject:OSLocationFromFix(fix)];
+    }
+    [self deliverLocations:locations];
+    [self deliverGeofenceEvents];
+    [self deliverRouteProgress];
+    [self deliverStayEvents];
+    [self deliverTrackSplits];
+}
+
+#pragma mark - Delegate methods
+- (void)locationManager:(CLLocationManager *)manager didUpdateLocations:(NSArray<CLLocation *> *)locations {
+    [self deliverLocations:[self processedLocations:locations]];
+    [self deliverGeofenceEvents];
+    [self deliverRouteProgress];
+    [self deliverStayEvents];
+    [self deliverTrackSplits];
+    [self applyScheduledSettings];
+    if (self.allowsDeferredUpdates) {
+        [self.coreLocationManager allowDeferredLocationUpdatesUntilTraveled:CLLocationDistanceMax timeout:CLTimeIntervalMax];
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didUpdateHeading:(CLHeading *)newHeading {
+    if (!_headingFilter && !self.providesGridHeadings) {
+        [self deliverHeading:newHeading];
+        return;
+    }
+    oslocation::Heading heading = OSCoreHeadingFromHeading(newHeading);
+    if (self.providesGridHeadings) {
+        heading = [self headingWithGridNorth:heading];
+    }
+    oslocation::Heading smoothed;
+    if (!_headingFilter) {
+        [self deliverHeading:OSHeadingFromCoreHeading(heading)];
+    } else if (_headingFilter->update(heading, smoothed)) {
+        [self deliverHeading:OSHeadingFromCoreHeading(smoothed)];
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didFailWithError:(NSError *)error {
+    if ([self.delegate respondsToSelector:@selector(locationProvider:didFailWithError:)]) {
+        [self.delegate locationProvider:self didFailWithError:error];
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didChangeAuthorizationStatus:(CLAuthorizationStatus)status {
+    if ([self.delegate respondsToSelector:@selector(locationProvider:didChangeAuthorizationStatus:)]) {
+        [self.delegate locationProvider:self didChangeAuthorizationStatus:status];
+    }
+
+    if (status == kCLAuthorizationStatusAuthorizedWhenInUse || status == kCLAuthorizationStatusAuthorizedAlways) {
+        [self.coreLocationManager startUpdatingLocation];
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didFinishDeferredUpdatesWithError:(NSError *)error {
+    NSLog(@"Finished deferred updates: %@", error);
+}
+
+#pragma mark - Notifications
+- (void)didEnterBackground:(id)sender {
+    // The app may be suspended and ended without warning from here
+    if (_journal) {
+        _journal->sync();
+    }
+    if (_lastFixCache) {
+        _lastFixCache->flush();
+    }
+    if (self.coreLocationManager && !self.continueUpdatesInBackground) {
+        [self.coreLocationManager stopUpdatingLocation];
+        [self.coreLocationManager stopUpdatingHeading];
+    }
+}
+
+- (void)willEnterForeground:(id)sender {
+    if (self.coreLocationManager && !self.continueUpdatesInBackground) {
+        if (self.hasRequestedToUpdateLocation) {
+            [self.coreLocationManager startUpdatingLocation];
+        }
+        if (self.hasRequestedToUpdateHeading) {
+            [self.coreLocationManager startUpdatingHeading];
+        }
+    }
+}
+
+- (void)orientationChanged {
+    const CLDeviceOrientation orientation = (CLDeviceOrientation)UIDevice.currentDevice.orientation;
+    if (self.coreLocationManager.headingOrientation != orientation) {
+        self.coreLocationManager.headingOrientation = orientation;
+        if (_headingFilter) {
+            _headingFilter->reorient();
+        }
+    }
+}
+
+- (void)dealloc {
+    _coreLocationManager.delegate = nil;
+    // Anything still held is delivered directly, as no weak reference to
+    // self can be made for a drain or a frame from here
+    _deliveryChannel = nullptr;
+    [self flushFrame];
+    _frameCoalescer = nullptr;
+    [self stopLocationServiceUpdates];
+    [self stopSchedulerTimer];
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+@end
@@ -11,6 +11,80 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ *  Transitions reported for geofences added to an `OSLocationProvider`
+ */
+typedef NS_ENUM(NSInteger, OSGeofenceTransition) {
+    /**
+     *  The location moved inside the geofence
+     */
+    OSGeofenceTransitionEnter,
+    /**
+     *  The location moved outside the geofence
+     */
+    OSGeofenceTransitionExit,
+    /**
+     *  The location has stayed inside the geofence for the dwell time
+     */
+    OSGeofenceTransitionDwell
+};
+
+/**
+ *  One `splitDistance` completed with `OSLocationProcessingTrackStatistics`
+ */
+typedef struct {
+    /**
+     *  1 for the first split
+     */
+    NSUInteger number;
+    /**
+     *  Distance along the track at the end of the split
+     */
+    CLLocationDistance distance;
+    /**
+     *  Seconds the split took, its pace
+     */
+    NSTimeInterval elapsedTime;
+    NSTimeInterval movingTime;
+    CLLocationDistance ascent;
+    CLLocationDistance descent;
+} OSTrackSplit;
+
+/**
+ *  Transitions reported for the route set on an `OSLocationProvider`
+ */
+typedef NS_ENUM(NSInteger, OSRouteTransition) {
+    /**
+     *  The first location near the route, or the first back near it after
+     *  leaving
+     */
+    OSRouteTransitionOnRoute,
+    /**
+     *  Locations have stayed beyond `offRouteDistance` for five seconds
+     */
+    OSRouteTransitionOffRoute
+};
+
+/**
+ *  A location matched to the route set on an `OSLocationProvider`
+ */
+typedef struct {
+    /**
+     *  Meters along the route to the matched point
+     */
+    CLLocationDistance distanceAlongRoute;
+    /**
+     *  Meters from the route, positive to its right in the direction of
+     *  travel
+     */
+    CLLocationDistance crossTrackError;
+    /**
+     *  Meters along the route from the matched point to its end
+     */
+    CLLocationDistance remainingDistance;
+    BOOL onRoute;
+} OSRouteProgress;
+
 @protocol OSLocationProviderDelegate<NSObject>
 
 @optional
@@ -22,6 +96,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)locationProvider:(OSLocationProvider *)provider didUpdateLocations:(NSArray<CLLocation *> *)locations;
 
+/**
+ *  Invoked as updates start, before the first location arrives, with the
+ *  last location cached by an earlier session when `lastLocationCachePath`
+ *  is set. Its timestamp is when it was taken and its horizontal accuracy
+ *  is widened for its age. It is never passed to
+ *  `locationProvider:didUpdateLocations:` and should be replaced by the
+ *  first location that is.
+ *
+ *  @param provider `OSLocationProvider` invoking the method
+ *  @param location the provisional location
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didUpdateProvisionalLocation:(CLLocation *)location;
+
 /**
  *  Invoked when a new heading is available
  *
@@ -30,6 +117,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)locationProvider:(OSLocationProvider *)provider didUpdateHeading:(CLHeading *)newHeading;
 
+/**
+ *  Invoked once per frame when `frameInterval` is set, in place of
+ *  `locationProvider:didUpdateLocations:` and
+ *  `locationProvider:didUpdateHeading:`
+ *
+ *  @param provider  `OSLocationProvider` invoking the method
+ *  @param locations every location since the last frame in chronological
+ *                   order, possibly none
+ *  @param heading   the latest heading since the last frame, or nil if
+ *                   there has been none
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didUpdateLocations:(NSArray<CLLocation *> *)locations heading:(nullable CLHeading *)heading;
+
 /**
  *  Invoked when an error has occurred.
  *
@@ -46,6 +146,70 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)locationProvider:(OSLocationProvider *)provider didChangeAuthorizationStatus:(CLAuthorizationStatus)status;
 
+/**
+ *  Invoked when the user has stayed in one place long enough for a stay
+ *  with `OSLocationProcessingCollapseStays`. Locations within the stay are
+ *  not delivered until it ends.
+ *
+ *  @param provider `OSLocationProvider` invoking the method
+ *  @param location centre of the stay, timestamped with the arrival time.
+ *                  Its horizontal accuracy is the spread of the locations
+ *                  around the centre.
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didBeginStayAtLocation:(CLLocation *)location;
+
+/**
+ *  Invoked when a stay ends because the user has moved on or updates have
+ *  stopped
+ *
+ *  @param provider      `OSLocationProvider` invoking the method
+ *  @param location      centre of the stay over its whole duration,
+ *                       timestamped with the arrival time
+ *  @param departureDate time of the last location within the stay
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didEndStayAtLocation:(CLLocation *)location departureDate:(NSDate *)departureDate;
+
+/**
+ *  Invoked when the track passes each `splitDistance` with
+ *  `OSLocationProcessingTrackStatistics`, after the locations themselves
+ *  have been delivered
+ *
+ *  @param provider `OSLocationProvider` invoking the method
+ *  @param split    the split completed
+ *  @param date     when the split distance was reached, interpolated
+ *                  between locations
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didCompleteSplit:(OSTrackSplit)split date:(NSDate *)date;
+
+/**
+ *  Invoked when a location update crosses a geofence, after the locations
+ *  themselves have been delivered
+ *
+ *  @param provider   `OSLocationProvider` invoking the method
+ *  @param identifier the identifier the geofence was added with
+ *  @param transition the transition that occurred
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didTransitionGeofence:(NSString *)identifier transition:(OSGeofenceTransition)transition;
+
+/**
+ *  Invoked with the progress along the route after each location update
+ *  matched to it, once the locations themselves have been delivered
+ *
+ *  @param provider `OSLocationProvider` invoking the method
+ *  @param progress progress at the latest location
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didUpdateRouteProgress:(OSRouteProgress)progress;
+
+/**
+ *  Invoked when locations join or leave the route, before the progress for
+ *  the same update
+ *
+ *  @param provider   `OSLocationProvider` invoking the method
+ *  @param transition the transition that occurred
+ *  @param date       time of the location that made the transition
+ */
+- (void)locationProvider:(OSLocationProvider *)provider didTransitionRoute:(OSRouteTransition)transition date:(NSDate *)date;
+
 @end
 
 NS_ASSUME_NONNULL_END
\ No newline at end of file
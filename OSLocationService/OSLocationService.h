@@ -14,5 +14,8 @@ FOUNDATION_EXPORT double OSLocationServiceVersionNumber;
 //! Project version string for OSLocationService.
 FOUNDATION_EXPORT const unsigned char OSLocationServiceVersionString[];
 
+#import "OSHeading.h"
+#import "OSLocation.h"
+#import "OSLocationHub.h"
 #import "OSLocationProvider.h"
 #import "OSLocationProviderDelegate.h"